@@ -2,6 +2,14 @@
 
 #include "Blueprint/UtilityExtendBPLibrary.h"
 #include "Notification/UtilityLoadingNotification.h"
+#include "Notification/UtilityProgressGroup.h"
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "File/UtilityExtendTextFile.h"
+#include "File/UtilityExtendTextFileReader.h"
+#include "File/UtilityExtendMappedFile.h"
+#include "Notification/SUtilityExtendNotificationHistory.h"
+#include "UObject/Script.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Application/SlateApplication.h"
@@ -69,9 +77,24 @@
 #endif
 
 // 静态成员变量定义
-TArray<TSharedPtr<SNotificationItem>> UUtilityExtendBPLibrary::CreatedNotifications;
 FOnNotificationButtonClicked UUtilityExtendBPLibrary::OnNotificationButtonClicked;
-TMap<FString, TSharedPtr<SNotificationItem>> UUtilityExtendBPLibrary::NotificationMap;
+
+namespace UtilityExtendBPLibraryUtils
+{
+    /** 获取调用当前蓝图函数的脚本名称（蓝图类名.函数名），从Python或C++调用时返回空字符串 */
+    FString GetCallingScriptName()
+    {
+#if DO_BLUEPRINT_GUARD
+        const TArrayView<const FFrame* const> ScriptStack = FBlueprintContextTracker::Get().GetCurrentScriptStack();
+        if (ScriptStack.Num() > 0 && ScriptStack.Last() && ScriptStack.Last()->Node)
+        {
+            const UFunction* Function = ScriptStack.Last()->Node;
+            return FString::Printf(TEXT("%s.%s"), *GetNameSafe(Function->GetOuter()), *Function->GetName());
+        }
+#endif
+        return FString();
+    }
+}
 TArray<TWeakObjectPtr<UObject>> UUtilityExtendBPLibrary::NotificationEventReceivers;
 
 // 创建常规通知函数（不带按钮）
@@ -79,18 +102,20 @@ FString UUtilityExtendBPLibrary::CreateEditorNotification(
     const FString& Message,
     EEditorNotificationType NotificationType,
     float Duration,
-    bool bAutoExpire)
+    bool bAutoExpire,
+    const FString& CoalesceKey)
 {
-    // 检查Slate系统是否可用
-    if (!FSlateApplication::IsInitialized())
+    // 没有Slate时（命令行工具、-nullrhi自动化）改为无界面输出
+    if (FUtilityExtendHeadlessNotifications::IsHeadless())
     {
-        UE_LOG(LogTemp, Warning, TEXT("Slate系统未初始化，无法显示通知"));
-        return FString();
+        const FString Source = UtilityExtendBPLibraryUtils::GetCallingScriptName();
+        if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+        {
+            NotificationSubsystem->AddHistoryRecord(Message, NotificationType, Source);
+        }
+        return FUtilityExtendHeadlessNotifications::Get().Notify(Message, NotificationType, Source);
     }
 
-    // 生成唯一的通知ID
-    FString NotificationId = FGuid::NewGuid().ToString();
-
     // 创建通知信息
     FNotificationInfo Info(FText::FromString(Message));
     
@@ -125,22 +150,20 @@ FString UUtilityExtendBPLibrary::CreateEditorNotification(
 
     // 常规通知不支持按钮
 
-    // 显示通知
+    // 通过通知子系统显示，经过合并和频率限制；自动过期的通知淡出后由子系统回收
+    if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+    {
+        return NotificationSubsystem->ShowNotification(Info, CompletionState, CoalesceKey, UtilityExtendBPLibraryUtils::GetCallingScriptName()).ToString();
+    }
+
+    // 没有编辑器子系统时直接显示，不跟踪
     TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
-    
     if (NotificationItem.IsValid())
     {
-        // 添加到跟踪数组
-        CreatedNotifications.Add(NotificationItem);
-        
-        // 添加到ID映射表
-        NotificationMap.Add(NotificationId, NotificationItem);
-        
-        // 设置完成状态
         NotificationItem->SetCompletionState(CompletionState);
     }
 
-    return NotificationId;
+    return FString();
 }
 
 // 创建带加载动画的通知函数（支持按钮）
@@ -151,19 +174,11 @@ FString UUtilityExtendBPLibrary::CreateEditorLoadingNotification(
     const FString& ButtonText,
     const FString& ButtonTooltip)
 {
-    // 检查Slate系统是否可用
-    if (!FSlateApplication::IsInitialized())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Slate系统未初始化，无法显示通知"));
-        OutNotificationObject = nullptr;
-        return FString();
-    }
-
-    // 生成唯一的通知ID
-    FString NotificationId = FGuid::NewGuid().ToString();
-
-    // 创建通知对象
-    OutNotificationObject = NewObject<UUtilityLoadingNotification>();
+    // 从通知子系统的对象池取出通知对象，子系统不可用时直接创建
+    UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+    OutNotificationObject = NotificationSubsystem
+        ? NotificationSubsystem->AcquireLoadingNotification()
+        : NewObject<UUtilityLoadingNotification>();
     if (!OutNotificationObject)
     {
         UE_LOG(LogTemp, Error, TEXT("无法创建 UUtilityLoadingNotification 对象"));
@@ -171,9 +186,22 @@ FString UUtilityExtendBPLibrary::CreateEditorLoadingNotification(
     }
 
     // 设置通知对象的基本信息
-    OutNotificationObject->NotificationId = NotificationId;
     OutNotificationObject->Message = Message;
 
+    // 没有Slate时改为无界面输出，之后对通知对象的更新同样输出到无界面通知；按钮无法点击，不再添加
+    if (FUtilityExtendHeadlessNotifications::IsHeadless())
+    {
+        const FString Source = UtilityExtendBPLibraryUtils::GetCallingScriptName();
+        FUtilityExtendHeadlessNotifications& Headless = FUtilityExtendHeadlessNotifications::Get();
+        OutNotificationObject->BindHeadless(Headless.AllocateId());
+        Headless.Begin(OutNotificationObject->NotificationId, Message, Source);
+        if (NotificationSubsystem)
+        {
+            NotificationSubsystem->AddHistoryRecord(Message, EEditorNotificationType::Default, Source);
+        }
+        return OutNotificationObject->NotificationId;
+    }
+
     // 创建通知信息
     FNotificationInfo Info(FText::FromString(Message));
     
@@ -192,15 +220,16 @@ FString UUtilityExtendBPLibrary::CreateEditorLoadingNotification(
     // 如果显示按钮，添加按钮
     if (bShowButton && !ButtonText.IsEmpty())
     {
-        // 创建按钮回调函数，使用弱引用避免悬空指针
+        // 创建按钮回调函数，使用弱引用避免悬空指针；对象复用后使用序号变化，忽略旧通知上的点击
         TWeakObjectPtr<UUtilityLoadingNotification> WeakNotificationObject = OutNotificationObject;
         FString CapturedButtonText = ButtonText;
+        const uint32 CapturedUseSerial = OutNotificationObject->GetUseSerial();
         
-        auto ButtonCallback = [WeakNotificationObject, CapturedButtonText]()
+        auto ButtonCallback = [WeakNotificationObject, CapturedButtonText, CapturedUseSerial]()
         {
             UE_LOG(LogTemp, Warning, TEXT("Button clicked with text: %s"), *CapturedButtonText);
             
-            if (WeakNotificationObject.IsValid())
+            if (WeakNotificationObject.IsValid() && WeakNotificationObject->GetUseSerial() == CapturedUseSerial)
             {
                 UUtilityLoadingNotification* NotificationObject = WeakNotificationObject.Get();
                 if (NotificationObject && NotificationObject->OnButtonClicked.IsBound())
@@ -230,24 +259,44 @@ FString UUtilityExtendBPLibrary::CreateEditorLoadingNotification(
     // 显示通知
     TSharedPtr<SNotificationItem> NotificationItem = FSlateNotificationManager::Get().AddNotification(Info);
     
+    FString NotificationId;
     if (NotificationItem.IsValid())
     {
-        // 将通知项保存到对象中
-        OutNotificationObject->NotificationItem = NotificationItem;
-        
-        // 添加到跟踪数组
-        CreatedNotifications.Add(NotificationItem);
-        
-        // 添加到ID映射表
-        NotificationMap.Add(NotificationId, NotificationItem);
-        
         // 设置完成状态
         NotificationItem->SetCompletionState(CompletionState);
+        
+        // 登记到通知子系统，通知淡出后子系统把对象归还对象池；对象只保存通知项的弱引用，不延长通知的生命周期
+        FUtilityNotificationHandle Handle;
+        if (NotificationSubsystem)
+        {
+            Handle = NotificationSubsystem->Register(NotificationItem, Info.bFireAndForget, OutNotificationObject);
+            NotificationSubsystem->AddHistoryRecord(Message, EEditorNotificationType::Default, UtilityExtendBPLibraryUtils::GetCallingScriptName());
+            NotificationId = Handle.ToString();
+        }
+        OutNotificationObject->BindNotificationItem(NotificationItem, Handle);
+        OutNotificationObject->NotificationId = NotificationId;
+    }
+    else if (NotificationSubsystem)
+    {
+        // 通知没有显示出来，立即归还对象池
+        NotificationSubsystem->ReleaseLoadingNotification(OutNotificationObject);
+        OutNotificationObject = nullptr;
     }
 
     return NotificationId;
 }
 
+// 创建进度组通知
+UUtilityProgressGroup* UUtilityExtendBPLibrary::CreateProgressGroupNotification(const FString& Title)
+{
+    UUtilityProgressGroup* ProgressGroup = NewObject<UUtilityProgressGroup>();
+    if (!ProgressGroup->Start(Title))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("通知创建失败，无法显示进度组通知"));
+    }
+    return ProgressGroup;
+}
+
 // // 创建复杂通知
 // UUtilityLoadingNotification* UUtilityExtendBPLibrary::CreateComplexNotification(const FString& Title, const FString& Text, const TArray<FString>& ButtonTexts, bool bShowProgressBar)
 // {
@@ -277,38 +326,69 @@ FString UUtilityExtendBPLibrary::CreateEditorLoadingNotification(
 // 统一的清除通知函数
 bool UUtilityExtendBPLibrary::RemoveEditorNotification(const FString& NotificationId, bool bRemoveAll)
 {
+    UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+    if (!NotificationSubsystem)
+    {
+        return false;
+    }
+    
     // 如果指定了清除全部或者NotificationId为空
     if (bRemoveAll || NotificationId.IsEmpty())
     {
-        // 移除所有创建的通知
-        for (TSharedPtr<SNotificationItem>& NotificationItem : CreatedNotifications)
-        {
-            if (NotificationItem.IsValid())
-            {
-                NotificationItem->ExpireAndFadeout();
-            }
-        }
-        
-        CreatedNotifications.Empty();
-        NotificationMap.Empty();
+        NotificationSubsystem->RemoveAll();
         return true;
     }
     
     // 按ID移除指定通知
-    if (NotificationMap.Contains(NotificationId))
+    return NotificationSubsystem->Remove(FUtilityNotificationHandle::FromString(NotificationId));
+}
+
+// 获取通知历史
+TArray<FUtilityNotificationRecord> UUtilityExtendBPLibrary::GetNotificationHistory(int32 MaxCount)
+{
+    const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+    return NotificationSubsystem ? NotificationSubsystem->QueryHistory(FString(), FString(), TOptional<EEditorNotificationType>(), MaxCount) : TArray<FUtilityNotificationRecord>();
+}
+
+// 查询通知历史
+TArray<FUtilityNotificationRecord> UUtilityExtendBPLibrary::QueryNotificationHistory(
+    const FString& Keyword,
+    const FString& Source,
+    bool bFilterByType,
+    EEditorNotificationType NotificationType,
+    int32 MaxCount)
+{
+    const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+    if (!NotificationSubsystem)
     {
-        TSharedPtr<SNotificationItem> NotificationItem = NotificationMap[NotificationId];
-        if (NotificationItem.IsValid())
-        {
-            NotificationItem->ExpireAndFadeout();
-            NotificationMap.Remove(NotificationId);
-            CreatedNotifications.Remove(NotificationItem);
-        return true;
+        return TArray<FUtilityNotificationRecord>();
     }
-        NotificationMap.Remove(NotificationId);
+
+    TOptional<EEditorNotificationType> TypeFilter;
+    if (bFilterByType)
+    {
+        TypeFilter = NotificationType;
     }
-        return false;
+    return NotificationSubsystem->QueryHistory(Keyword, Source, TypeFilter, MaxCount);
+}
+
+// 清空通知历史
+void UUtilityExtendBPLibrary::ClearNotificationHistory()
+{
+    if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+    {
+        NotificationSubsystem->ClearHistory();
+    }
+}
+
+// 打开通知历史面板
+void UUtilityExtendBPLibrary::OpenNotificationHistoryPanel()
+{
+    if (FSlateApplication::IsInitialized())
+    {
+        FGlobalTabmanager::Get()->TryInvokeTab(SUtilityExtendNotificationHistory::TabId);
     }
+}
 
 // ------------------------------------编辑器操作相关函数------------------------------------
 // 重启引擎
@@ -460,119 +540,26 @@ bool UUtilityExtendBPLibrary::CloseUtilityWidgetTab(const FString& TabId)
 // 文件读写相关函数实现
 bool UUtilityExtendBPLibrary::ReadTextFile(const FString& FilePath, FString& OutContent, FString& OutErrorMessage)
 {
-    // 清空输出参数
-    OutContent.Empty();
-    OutErrorMessage.Empty();
-    
-    // 检查文件路径是否为空
-    if (FilePath.IsEmpty())
-    {
-        OutErrorMessage = TEXT("文件路径不能为空");
-        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: File path is empty"));
-        return false;
-    }
-    
-    // 处理相对路径和绝对路径
-    FString FullPath = FilePath;
-    if (!FPaths::IsRelative(FilePath))
-    {
-        // 绝对路径，直接使用
-        FullPath = FilePath;
-    }
-    else
-    {
-        // 相对路径，转换为项目相对路径
-        FullPath = FPaths::ProjectDir() + FilePath;
-    }
-    
-    // 规范化路径
-    FPaths::NormalizeFilename(FullPath);
-    
-    // 检查文件是否存在
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (!PlatformFile.FileExists(*FullPath))
-    {
-        OutErrorMessage = FString::Printf(TEXT("文件不存在: %s"), *FullPath);
-        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: File does not exist: %s"), *FullPath);
-        return false;
-    }
-    
-    // 读取文件内容
-    if (!FFileHelper::LoadFileToString(OutContent, *FullPath))
-    {
-        OutErrorMessage = FString::Printf(TEXT("读取文件失败: %s"), *FullPath);
-        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: Failed to load file: %s"), *FullPath);
-        return false;
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("ReadTextFile: Successfully read file: %s (%d characters)"), *FullPath, OutContent.Len());
-    return true;
+    // 与异步读取节点共用实现，路径解析和错误信息保持一致
+    return FUtilityExtendTextFile::Read(FilePath, OutContent, OutErrorMessage);
 }
 
 bool UUtilityExtendBPLibrary::WriteTextFile(const FString& FilePath, const FString& Content, FString& OutErrorMessage, bool bOverwrite, bool bCreateDirectories)
 {
-    // 清空输出参数
-    OutErrorMessage.Empty();
-    
-    // 检查文件路径是否为空
-    if (FilePath.IsEmpty())
-    {
-        OutErrorMessage = TEXT("文件路径不能为空");
-        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: File path is empty"));
-        return false;
-    }
-    
-    // 处理相对路径和绝对路径
-    FString FullPath = FilePath;
-    if (!FPaths::IsRelative(FilePath))
-    {
-        // 绝对路径，直接使用
-        FullPath = FilePath;
-    }
-    else
-    {
-        // 相对路径，转换为项目相对路径
-        FullPath = FPaths::ProjectDir() + FilePath;
-    }
-    
-    // 规范化路径
-    FPaths::NormalizeFilename(FullPath);
-    
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    
-    // 检查文件是否存在，如果存在且不允许覆盖，则返回错误
-    if (PlatformFile.FileExists(*FullPath) && !bOverwrite)
-    {
-        OutErrorMessage = FString::Printf(TEXT("文件已存在且不允许覆盖: %s"), *FullPath);
-        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: File exists and overwrite is disabled: %s"), *FullPath);
-        return false;
-    }
-    
-    // 如果需要创建目录，先创建目录
-    if (bCreateDirectories)
-    {
-        FString Directory = FPaths::GetPath(FullPath);
-        if (!Directory.IsEmpty() && !PlatformFile.DirectoryExists(*Directory))
-        {
-            if (!PlatformFile.CreateDirectoryTree(*Directory))
-            {
-                OutErrorMessage = FString::Printf(TEXT("创建目录失败: %s"), *Directory);
-                UE_LOG(LogTemp, Error, TEXT("WriteTextFile: Failed to create directory: %s"), *Directory);
-                return false;
-            }
-        }
-    }
-    
-    // 写入文件内容
-    if (!FFileHelper::SaveStringToFile(Content, *FullPath))
-    {
-        OutErrorMessage = FString::Printf(TEXT("写入文件失败: %s"), *FullPath);
-        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: Failed to save file: %s"), *FullPath);
-        return false;
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("WriteTextFile: Successfully wrote file: %s (%d characters)"), *FullPath, Content.Len());
-    return true;
+    // 与异步写入节点共用实现，路径解析和错误信息保持一致
+    return FUtilityExtendTextFile::Write(FilePath, Content, OutErrorMessage, bOverwrite, bCreateDirectories);
+}
+
+UUtilityExtendTextFileReader* UUtilityExtendBPLibrary::OpenTextFileReader(const FString& FilePath, FString& OutErrorMessage)
+{
+    UUtilityExtendTextFileReader* Reader = NewObject<UUtilityExtendTextFileReader>();
+    return Reader->Open(FilePath, OutErrorMessage) ? Reader : nullptr;
+}
+
+UUtilityExtendMappedFile* UUtilityExtendBPLibrary::OpenMappedFile(const FString& FilePath, FString& OutErrorMessage)
+{
+    UUtilityExtendMappedFile* MappedFile = NewObject<UUtilityExtendMappedFile>();
+    return MappedFile->Open(FilePath, OutErrorMessage) ? MappedFile : nullptr;
 }
 
 bool UUtilityExtendBPLibrary::CheckFileExists(const FString& FilePath)
@@ -584,18 +571,7 @@ bool UUtilityExtendBPLibrary::CheckFileExists(const FString& FilePath)
     }
     
     // 处理相对路径和绝对路径
-    FString FullPath = FilePath;
-    if (!FPaths::IsRelative(FilePath))
-    {
-        FullPath = FilePath;
-    }
-    else
-    {
-        FullPath = FPaths::ProjectDir() + FilePath;
-    }
-    
-    // 规范化路径
-    FPaths::NormalizeFilename(FullPath);
+    const FString FullPath = FUtilityExtendTextFile::ResolvePath(FilePath);
     
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     return PlatformFile.FileExists(*FullPath);
@@ -610,18 +586,7 @@ int64 UUtilityExtendBPLibrary::GetFileSize(const FString& FilePath)
     }
     
     // 处理相对路径和绝对路径
-    FString FullPath = FilePath;
-    if (!FPaths::IsRelative(FilePath))
-    {
-        FullPath = FilePath;
-    }
-    else
-    {
-        FullPath = FPaths::ProjectDir() + FilePath;
-    }
-    
-    // 规范化路径
-    FPaths::NormalizeFilename(FullPath);
+    const FString FullPath = FUtilityExtendTextFile::ResolvePath(FilePath);
     
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     
@@ -647,18 +612,7 @@ bool UUtilityExtendBPLibrary::DeleteFile(const FString& FilePath, FString& OutEr
     }
     
     // 处理相对路径和绝对路径
-    FString FullPath = FilePath;
-    if (!FPaths::IsRelative(FilePath))
-    {
-        FullPath = FilePath;
-    }
-    else
-    {
-        FullPath = FPaths::ProjectDir() + FilePath;
-    }
-    
-    // 规范化路径
-    FPaths::NormalizeFilename(FullPath);
+    const FString FullPath = FUtilityExtendTextFile::ResolvePath(FilePath);
     
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     
@@ -948,6 +902,40 @@ TArray<FString> UUtilityExtendBPLibrary::OpenFileDialog(
     return SelectedFiles;
 }
 
+// 图标导入相关函数实现
+bool UUtilityExtendBPLibrary::ImportIconFiles(const TArray<FString>& FilePaths, const FOnIconImportCompleted& OnCompleted)
+{
+    TArray<FString> FullPaths;
+    FullPaths.Reserve(FilePaths.Num());
+    for (const FString& FilePath : FilePaths)
+    {
+        FString FullPath = FPaths::IsRelative(FilePath) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), FilePath) : FilePath;
+        FPaths::NormalizeFilename(FullPath);
+        FullPaths.Add(FullPath);
+    }
+    
+    const bool bStarted = FUtilityExtendIconImporter::ImportFiles(FullPaths, FUtilityExtendIconImportOptions(),
+        [OnCompleted](const FUtilityExtendIconImportResult& Result)
+        {
+            OnCompleted.ExecuteIfBound(Result);
+        });
+    
+    UE_LOG(LogTemp, Log, TEXT("ImportIconFiles: %s importing %d files"), bStarted ? TEXT("Started") : TEXT("Failed to start"), FullPaths.Num());
+    return bStarted;
+}
+
+bool UUtilityExtendBPLibrary::ImportIconFolder(const FString& FolderPath, bool bRecursive, const FOnIconImportCompleted& OnCompleted)
+{
+    const TArray<FString> Files = FUtilityExtendIconImporter::CollectIconFiles(FolderPath, bRecursive);
+    if (Files.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("ImportIconFolder: No SVG/PNG files found in: %s"), *FolderPath);
+        return false;
+    }
+    
+    return ImportIconFiles(Files, OnCompleted);
+}
+
 
 
 
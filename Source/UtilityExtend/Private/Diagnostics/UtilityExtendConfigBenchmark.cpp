@@ -0,0 +1,1400 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Persistent/UtilityExtendConfigArchive.h"
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "Persistent/UtilityExtendConfigJournal.h"
+#include "Persistent/UtilityExtendConfigResolver.h"
+#include "Persistent/UtilityExtendConfigSchema.h"
+#include "Persistent/UtilityExtendConfigText.h"
+#include "Persistent/UtilityExtendPersistentSettings.h"
+#include "UtilityExtendIconRegistry.h"
+#include "UtilityToolbarManager.h"
+#include "ToolMenu.h"
+#include "ToolMenuSection.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+/**
+ * 配置解析性能诊断
+ * 控制台命令只在编辑器中手动执行，用于对比各配置读写路径在大配置下的耗时和内存、
+ * 对所有配置解析器做模糊测试，以及在万级按钮规模下检查各路径的耗时预算；
+ * 模糊测试、吞吐量和压力测试结果追加到Saved/UtilityExtend/Benchmarks下的CSV文件，便于对比历次运行；
+ * 配置文本、配置结构、变更日志的正确性校验和默认参数的模糊测试注册为自动化测试
+ */
+namespace UtilityExtendConfigBenchmark
+{
+    /** 生成指定规模的按钮配置 */
+    TArray<FToolbarButtonConfig> MakeConfigs(int32 ButtonCount, int32 ItemsPerButton)
+    {
+        TArray<FToolbarButtonConfig> Configs;
+        Configs.Reserve(ButtonCount);
+        for (int32 ButtonIndex = 0; ButtonIndex < ButtonCount; ++ButtonIndex)
+        {
+            FToolbarButtonConfig& Config = Configs.AddDefaulted_GetRef();
+            Config.ButtonName = FString::Printf(TEXT("按钮_%d"), ButtonIndex);
+            Config.ButtonType = ItemsPerButton > 0 ? EToolbarButtonType::DropdownButton : EToolbarButtonType::SingleButton;
+            Config.ButtonIconName = TEXT("工具箱");
+            Config.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(
+                FString::Printf(TEXT("/Game/Bench/BS_Button_%d.BS_Button_%d_C"), ButtonIndex, ButtonIndex));
+
+            Config.DropdownItems.Reserve(ItemsPerButton);
+            for (int32 ItemIndex = 0; ItemIndex < ItemsPerButton; ++ItemIndex)
+            {
+                FToolbarDropdownItem& Item = Config.DropdownItems.AddDefaulted_GetRef();
+                Item.ItemName = FString::Printf(TEXT("菜单项_%d_%d"), ButtonIndex, ItemIndex);
+                Item.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(
+                    FString::Printf(TEXT("/Game/Bench/BS_Item_%d_%d.BS_Item_%d_%d_C"), ButtonIndex, ItemIndex, ButtonIndex, ItemIndex));
+            }
+        }
+        return Configs;
+    }
+
+    /** 统计DOM中的节点数量（每个节点至少对应一次堆分配） */
+    int32 CountJsonNodes(const TSharedPtr<FJsonValue>& Value)
+    {
+        int32 Count = 1;
+        if (Value->Type == EJson::Object)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
+            {
+                Count += CountJsonNodes(Field.Value);
+            }
+        }
+        else if (Value->Type == EJson::Array)
+        {
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                Count += CountJsonNodes(Element);
+            }
+        }
+        return Count;
+    }
+
+    /** 当前进程已使用的物理内存 */
+    int64 GetUsedPhysical()
+    {
+        return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+    }
+
+    void RunJsonBenchmark(const TArray<FString>& Args)
+    {
+        const int32 ButtonCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+        const int32 ItemsPerButton = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 10;
+        const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 5;
+
+        FString Json;
+        FUtilityExtendConfigJson::WriteButtonConfigs(MakeConfigs(ButtonCount, ItemsPerButton), Json);
+        const FTCHARToUTF8 Utf8Json(*Json);
+        const FUtf8StringView Utf8View(reinterpret_cast<const UTF8CHAR*>(Utf8Json.Get()), Utf8Json.Length());
+
+        double DomParseSeconds = 0.0;
+        double StreamParseSeconds = 0.0;
+        int64 DomPeakBytes = 0;
+        int64 StreamPeakBytes = 0;
+        int32 DomNodeCount = 0;
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            // DOM：原先的实现需要先把文件转换为FString，再构建完整的FJsonObject树
+            {
+                const int64 MemoryBefore = GetUsedPhysical();
+                const double StartTime = FPlatformTime::Seconds();
+                const FString JsonString(UTF8_TO_TCHAR(Utf8Json.Get()));
+                TSharedPtr<FJsonValue> Root;
+                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+                FJsonSerializer::Deserialize(Reader, Root);
+                DomParseSeconds += FPlatformTime::Seconds() - StartTime;
+                DomPeakBytes = FMath::Max(DomPeakBytes, GetUsedPhysical() - MemoryBefore);
+                DomNodeCount = Root.IsValid() ? CountJsonNodes(Root) : 0;
+            }
+
+            // 流式：直接从UTF-8文本填充结构体
+            {
+                const int64 MemoryBefore = GetUsedPhysical();
+                const double StartTime = FPlatformTime::Seconds();
+                TArray<FToolbarButtonConfig> Configs;
+                FString Error;
+                if (!FUtilityExtendConfigJson::ReadButtonConfigs(Utf8View, Configs, Error))
+                {
+                    UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 流式解析失败: %s"), *Error);
+                    return;
+                }
+                StreamParseSeconds += FPlatformTime::Seconds() - StartTime;
+                StreamPeakBytes = FMath::Max(StreamPeakBytes, GetUsedPhysical() - MemoryBefore);
+            }
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend: JSON基准测试 按钮 %d，每个按钮 %d 个下拉项，文件 %.1f KB，迭代 %d 次"),
+            ButtonCount, ItemsPerButton, Utf8Json.Length() / 1024.0, Iterations);
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   DOM解析  平均 %.2f ms，内存增量峰值 %.1f KB，DOM节点 %d 个"),
+            DomParseSeconds * 1000.0 / Iterations, DomPeakBytes / 1024.0, DomNodeCount);
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   流式解析 平均 %.2f ms，内存增量峰值 %.1f KB"),
+            StreamParseSeconds * 1000.0 / Iterations, StreamPeakBytes / 1024.0);
+    }
+
+    /** 比较两个按钮配置的所有字段 */
+    bool ConfigsEqual(const FToolbarButtonConfig& A, const FToolbarButtonConfig& B)
+    {
+        if (A.ButtonName != B.ButtonName || A.ButtonType != B.ButtonType || A.ButtonIconName != B.ButtonIconName
+            || A.bShowButtonText != B.bShowButtonText || A.BoundClass != B.BoundClass
+            || A.DropdownItems.Num() != B.DropdownItems.Num())
+        {
+            return false;
+        }
+
+        for (int32 ItemIndex = 0; ItemIndex < A.DropdownItems.Num(); ++ItemIndex)
+        {
+            if (A.DropdownItems[ItemIndex].ItemName != B.DropdownItems[ItemIndex].ItemName
+                || A.DropdownItems[ItemIndex].BoundClass != B.DropdownItems[ItemIndex].BoundClass)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** 逐个比较两组按钮配置 */
+    bool AllConfigsEqual(const TArray<FToolbarButtonConfig>& A, const TArray<FToolbarButtonConfig>& B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < A.Num(); ++Index)
+        {
+            if (!ConfigsEqual(A[Index], B[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** 配置文本导出 */
+    FString ExportConfigText(const FToolbarButtonConfig& Config)
+    {
+        FString Text;
+        Config.ExportTextItem(Text, FToolbarButtonConfig(), nullptr, 0, nullptr);
+        return Text;
+    }
+
+    /** 导入一段配置文本，要求读取器正好停在文本末尾 */
+    bool ImportConfigText(const FString& Text, FToolbarButtonConfig& OutConfig, FString& OutError)
+    {
+        FUtilityExtendConfigTextReader Reader(*Text);
+        if (!OutConfig.ImportFromReader(Reader))
+        {
+            OutError = Reader.GetError();
+            return false;
+        }
+        if (Reader.GetOffset() != Text.Len())
+        {
+            OutError = FString::Printf(TEXT("读取停在位置 %d，文本长度 %d"), Reader.GetOffset(), Text.Len());
+            return false;
+        }
+        return true;
+    }
+
+#if WITH_DEV_AUTOMATION_TESTS
+    /** 校验结果统计，失败的用例逐条记录为自动化测试的错误 */
+    struct FVerificationReport
+    {
+        FAutomationTestBase& Test;
+        const TCHAR* Subject;
+        int32 PassedCount = 0;
+        int32 FailedCount = 0;
+
+        FVerificationReport(FAutomationTestBase& InTest, const TCHAR* InSubject)
+            : Test(InTest)
+            , Subject(InSubject)
+        {
+        }
+
+        void Check(bool bCondition, const TCHAR* CaseName, const FString& Detail)
+        {
+            if (bCondition)
+            {
+                ++PassedCount;
+            }
+            else
+            {
+                ++FailedCount;
+                Test.AddError(FString::Printf(TEXT("%s校验失败 [%s] %s"), Subject, CaseName, *Detail));
+            }
+        }
+
+        void LogSummary() const
+        {
+            Test.AddInfo(FString::Printf(TEXT("%s校验完成，通过 %d 项，失败 %d 项"), Subject, PassedCount, FailedCount));
+        }
+    };
+
+    void RunTextVerification(FAutomationTestBase& Test)
+    {
+        FVerificationReport Report(Test, TEXT("配置文本"));
+
+        // 值中带逗号、括号、引号和反斜杠时导出后能原样读回
+        {
+            FToolbarButtonConfig Config;
+            Config.ButtonName = TEXT("工具, (实验) \"版本\" C:\\Temp");
+            Config.ButtonType = EToolbarButtonType::DropdownButton;
+            Config.ButtonIconName = TEXT("工具箱");
+            Config.bShowButtonText = false;
+            Config.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(TEXT("/Game/Tools/BS_Tool.BS_Tool_C"));
+            FToolbarDropdownItem& ItemA = Config.DropdownItems.AddDefaulted_GetRef();
+            ItemA.ItemName = TEXT("打开 (a,b)");
+            ItemA.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(TEXT("/Game/Tools/BS_A.BS_A_C"));
+            FToolbarDropdownItem& ItemB = Config.DropdownItems.AddDefaulted_GetRef();
+            ItemB.ItemName = TEXT(")),((\"");
+
+            const FString Text = ExportConfigText(Config);
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const bool bImported = ImportConfigText(Text, Imported, Error);
+            Report.Check(bImported && ConfigsEqual(Config, Imported), TEXT("RoundTripSpecialChars"), bImported ? Text : Error);
+        }
+
+        // 手写的旧格式：无引号值、枚举前缀、空白和多余的逗号
+        {
+            const FString Text = TEXT("( ButtonName = 旧按钮 , ButtonType=EToolbarButtonType::DropdownButton, bShowButtonText=1,")
+                TEXT(" DropdownItems=( (ItemName=\"甲,乙\", BoundClass=None) , (ItemName=丙) , ), )");
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const bool bImported = ImportConfigText(Text, Imported, Error);
+            Report.Check(bImported && Imported.ButtonName == TEXT("旧按钮") && Imported.ButtonType == EToolbarButtonType::DropdownButton
+                && Imported.bShowButtonText && Imported.DropdownItems.Num() == 2
+                && Imported.DropdownItems[0].ItemName == TEXT("甲,乙") && Imported.DropdownItems[1].ItemName == TEXT("丙"),
+                TEXT("LegacyLayout"), bImported ? Text : Error);
+        }
+
+        // 空下拉列表和未知字段
+        {
+            const FString Text = TEXT("(ButtonName=\"A\",Unknown=(x=\")\",y=(1,2)),DropdownItems=(),Extra=\"q\")");
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const bool bImported = ImportConfigText(Text, Imported, Error);
+            Report.Check(bImported && Imported.ButtonName == TEXT("A") && Imported.DropdownItems.Num() == 0, TEXT("EmptyListUnknownFields"), bImported ? Text : Error);
+        }
+
+        // 数组中的多个元素：读取器必须停在当前元素的')'之后
+        {
+            const FString Text = TEXT("(ItemName=\"x)\"),(ItemName=\"y\")");
+            FToolbarDropdownItem Item;
+            const TCHAR* Buffer = *Text;
+            const bool bImported = Item.ImportTextItem(Buffer, 0, nullptr, nullptr);
+            Report.Check(bImported && Item.ItemName == TEXT("x)") && *Buffer == TEXT(','), TEXT("StopsAfterElement"), Text);
+        }
+
+        // 没有格式标记的旧配置没有转义，反斜杠原样保留，包括结尾的反斜杠
+        {
+            const FString Text = TEXT("(ButtonName=\"C:\\\\Path\",DropdownItems=((ItemName=\"D:\\Tools\\\")))");
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const bool bImported = ImportConfigText(Text, Imported, Error);
+            Report.Check(bImported && Imported.ButtonName == TEXT("C:\\\\Path") && Imported.DropdownItems.Num() == 1
+                && Imported.DropdownItems[0].ItemName == TEXT("D:\\Tools\\"), TEXT("LegacyBackslash"), bImported ? Text : Error);
+        }
+
+        // 带格式标记时按转义读取，格式标记不作为字段出现
+        {
+            const FString Text = TEXT("(TextFormat=1,ButtonName=\"C:\\\\Path \\\"A\\\"\")");
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const bool bImported = ImportConfigText(Text, Imported, Error);
+            Report.Check(bImported && Imported.ButtonName == TEXT("C:\\Path \"A\""), TEXT("MarkedEscapes"), bImported ? Text : Error);
+        }
+
+        // 格式错误的输入必须报错，且不能越界读取
+        const TCHAR* MalformedInputs[] = {
+            TEXT(""),
+            TEXT("ButtonName=A"),
+            TEXT("(ButtonName=\"A"),
+            TEXT("(ButtonName=A"),
+            TEXT("(ButtonName=A,DropdownItems=((ItemName=B)"),
+            TEXT("(DropdownItems=(ItemName=B))"),
+            TEXT("(=A)"),
+        };
+        for (const TCHAR* Input : MalformedInputs)
+        {
+            FToolbarButtonConfig Imported;
+            FString Error;
+            Report.Check(!ImportConfigText(Input, Imported, Error), TEXT("RejectMalformed"), Input);
+        }
+
+        // 生成的配置整体往返
+        for (const FToolbarButtonConfig& Config : MakeConfigs(50, 5))
+        {
+            FToolbarButtonConfig Imported;
+            FString Error;
+            const FString Text = ExportConfigText(Config);
+            Report.Check(ImportConfigText(Text, Imported, Error) && ConfigsEqual(Config, Imported), TEXT("RoundTripGenerated"), Text);
+        }
+
+        Report.LogSummary();
+    }
+
+    void RunSchemaVerification(FAutomationTestBase& Test)
+    {
+        FVerificationReport Report(Test, TEXT("配置结构"));
+
+        const TArray<FToolbarIconInfo> IconInfos = FUtilityExtendIconRegistry::GetAllAvailableIconInfos();
+        const FToolbarIconInfo FirstIcon = IconInfos.Num() > 0 ? IconInfos[0] : FToolbarIconInfo();
+
+        // 没有SchemaVersion的旧文件：名称带空白、图标写技术名称
+        const FString LegacyJson = FString::Printf(TEXT("{\"PersistentButtonConfigs\":[")
+            TEXT("{\"ButtonName\":\"  旧按钮 \",\"ButtonType\":\"DropdownButton\",\"ButtonIconName\":\"%s\",")
+            TEXT("\"DropdownItems\":[{\"ItemName\":\" 项 \",\"BoundClass\":\"None\"}]}]}"), *FirstIcon.IconName.ToString());
+        const FTCHARToUTF8 LegacyUtf8(*LegacyJson);
+
+        TArray<FToolbarButtonConfig> Configs;
+        FString Error;
+        int32 FileVersion = INDEX_NONE;
+        const bool bRead = FUtilityExtendConfigJson::ReadButtonConfigs(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(LegacyUtf8.Get()), LegacyUtf8.Length()), Configs, Error, &FileVersion);
+        Report.Check(bRead && FileVersion == 0 && Configs.Num() == 1, TEXT("ReadLegacy"), bRead ? LegacyJson : Error);
+
+        if (bRead && Configs.Num() == 1)
+        {
+            Report.Check(FUtilityExtendConfigSchema::Migrate(FileVersion, Configs), TEXT("MigrateLegacy"), LegacyJson);
+            Report.Check(Configs[0].ButtonName == TEXT("旧按钮") && Configs[0].DropdownItems[0].ItemName == TEXT("项"), TEXT("MigrateTrimNames"), Configs[0].ButtonName);
+            Report.Check(IconInfos.Num() == 0 || Configs[0].ButtonIconName == FName(*FirstIcon.DisplayName), TEXT("MigrateIconName"), Configs[0].ButtonIconName.ToString());
+
+            // 回写后是当前版本，再次读取不会重复迁移
+            FString Rewritten;
+            FUtilityExtendConfigJson::WriteButtonConfigs(Configs, Rewritten);
+            const FTCHARToUTF8 RewrittenUtf8(*Rewritten);
+            TArray<FToolbarButtonConfig> Reloaded;
+            const bool bReloaded = FUtilityExtendConfigJson::ReadButtonConfigs(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(RewrittenUtf8.Get()), RewrittenUtf8.Length()), Reloaded, Error, &FileVersion);
+            Report.Check(bReloaded && FileVersion == FUtilityExtendConfigSchema::CurrentVersion && !FUtilityExtendConfigSchema::Migrate(FileVersion, Reloaded),
+                TEXT("MigrateOnce"), bReloaded ? Rewritten : Error);
+        }
+
+        // 校验结果只记录问题位置
+        {
+            TArray<FToolbarButtonConfig> Invalid = MakeConfigs(3, 2);
+            Invalid[1].ButtonName = Invalid[0].ButtonName;
+            Invalid[2].DropdownItems[1].ItemName.Empty();
+            Invalid[2].ButtonIconName = TEXT("不存在的图标");
+
+            TArray<FUtilityExtendConfigDiagnostic> Diagnostics;
+            FUtilityExtendConfigSchema::Validate(Invalid, Diagnostics);
+            auto HasIssue = [&Diagnostics](EUtilityExtendConfigIssue Issue, int32 ButtonIndex, int32 ItemIndex)
+            {
+                return Diagnostics.ContainsByPredicate([Issue, ButtonIndex, ItemIndex](const FUtilityExtendConfigDiagnostic& Diagnostic)
+                {
+                    return Diagnostic.Issue == Issue && Diagnostic.ButtonIndex == ButtonIndex && Diagnostic.ItemIndex == ItemIndex;
+                });
+            };
+            Report.Check(HasIssue(EUtilityExtendConfigIssue::DuplicateButtonName, 1, INDEX_NONE), TEXT("ValidateDuplicate"), FString::FromInt(Diagnostics.Num()));
+            Report.Check(HasIssue(EUtilityExtendConfigIssue::EmptyItemName, 2, 1), TEXT("ValidateEmptyItem"), FString::FromInt(Diagnostics.Num()));
+            Report.Check(HasIssue(EUtilityExtendConfigIssue::UnknownIcon, 2, INDEX_NONE), TEXT("ValidateUnknownIcon"), FString::FromInt(Diagnostics.Num()));
+        }
+
+        // 同一配置版本重复获取校验结果不会重新校验，配置变化后重新校验；
+        // 在临时的设置对象上修改配置，不影响插件正在使用的设置
+        {
+            UUtilityExtendPersistentSettings* Settings = NewObject<UUtilityExtendPersistentSettings>(GetTransientPackage());
+            Settings->SetPersistentButtonConfigs(MakeConfigs(3, 2));
+
+            const int32 BaseCount = Settings->GetValidationCount();
+            Settings->GetConfigDiagnostics();
+            const double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < 1000; ++Index)
+            {
+                Settings->GetConfigDiagnostics();
+            }
+            const double CachedSeconds = FPlatformTime::Seconds() - StartTime;
+            Report.Check(Settings->GetValidationCount() == BaseCount + 1, TEXT("DiagnosticsCached"),
+                FString::Printf(TEXT("校验 %d 次"), Settings->GetValidationCount() - BaseCount));
+
+            // 追加一个同名按钮，下次获取时重新校验并报告重复
+            Settings->AddPersistentButtonConfig(Settings->GetPersistentButtonConfigs()[0]);
+            const TArray<FUtilityExtendConfigDiagnostic>& Revalidated = Settings->GetConfigDiagnostics();
+            const bool bHasDuplicate = Revalidated.ContainsByPredicate([](const FUtilityExtendConfigDiagnostic& Diagnostic)
+            {
+                return Diagnostic.Issue == EUtilityExtendConfigIssue::DuplicateButtonName && Diagnostic.ButtonIndex == 3;
+            });
+            Report.Check(Settings->GetValidationCount() == BaseCount + 2 && bHasDuplicate, TEXT("DiagnosticsRevalidated"),
+                FString::Printf(TEXT("校验 %d 次，问题 %d 个"), Settings->GetValidationCount() - BaseCount, Revalidated.Num()));
+            Test.AddInfo(FString::Printf(TEXT("缓存读取校验结果1000次耗时 %.3f ms"), CachedSeconds * 1000.0));
+        }
+
+        Report.LogSummary();
+    }
+#endif
+
+    /** 结果CSV所在目录 */
+    FString GetResultDirectory()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("UtilityExtend") / TEXT("Benchmarks");
+    }
+
+    /** 追加CSV行，文件不存在时先写表头，多次运行的结果保留在同一文件中便于对比 */
+    void AppendCsvRows(const FString& FileName, const TCHAR* Header, const TArray<FString>& Rows)
+    {
+        const FString FilePath = GetResultDirectory() / FileName;
+        FString Contents;
+        if (!IFileManager::Get().FileExists(*FilePath))
+        {
+            Contents = FString(Header) + LINE_TERMINATOR;
+        }
+        for (const FString& Row : Rows)
+        {
+            Contents += Row + LINE_TERMINATOR;
+        }
+
+        if (FFileHelper::SaveStringToFile(Contents, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+        {
+            UE_LOG(LogTemp, Display, TEXT("UtilityExtend: 结果已写入 %s"), *FilePath);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 无法写入结果文件 %s"), *FilePath);
+        }
+    }
+
+    /** 运行期间只保留错误日志，旧版解析器每次解析都会输出日志，会淹没结果并拖慢计时 */
+    struct FScopedQuietLog
+    {
+        ELogVerbosity::Type PreviousVerbosity;
+
+        FScopedQuietLog()
+            : PreviousVerbosity(LogTemp.GetVerbosity())
+        {
+            LogTemp.SetVerbosity(ELogVerbosity::Error);
+        }
+
+        ~FScopedQuietLog()
+        {
+            LogTemp.SetVerbosity(PreviousVerbosity);
+        }
+    };
+
+#if WITH_DEV_AUTOMATION_TESTS
+    void RunJournalVerification(FAutomationTestBase& Test)
+    {
+        FVerificationReport Report(Test, TEXT("配置变更日志"));
+
+        // 在独立的临时配置文件上验证，不影响插件的配置
+        const FString BasePath = GetResultDirectory() / TEXT("JournalVerification.json");
+        const FString JournalPath = FUtilityExtendConfigJournal::GetJournalPath(BasePath);
+        IFileManager::Get().Delete(*(JournalPath + TEXT(".orphaned")), false, true, true);
+        FUtilityExtendConfigJournal::Delete(BasePath);
+
+        const TArray<FToolbarButtonConfig> BaseConfigs = MakeConfigs(200, 10);
+        FString BaseJson;
+        FUtilityExtendConfigJson::WriteButtonConfigs(BaseConfigs, BaseJson);
+        if (!FFileHelper::SaveStringToFile(BaseJson, *BasePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            Test.AddError(FString::Printf(TEXT("无法写入临时配置文件 %s"), *BasePath));
+            return;
+        }
+
+        // 一次会话中的几批修改：改一个按钮、追加按钮、删除尾部按钮
+        TArray<FToolbarButtonConfig> Current = BaseConfigs;
+        TArray<FToolbarButtonConfig> Persisted = BaseConfigs;
+        int64 AppendedBytes = 0;
+        auto SaveBatch = [&]()
+        {
+            TArray<FUtilityExtendJournalRecord> Records;
+            FUtilityExtendConfigJournal::Diff(Persisted, Current, Records);
+            const int64 Written = FUtilityExtendConfigJournal::Append(BasePath, Records);
+            Persisted = Current;
+            AppendedBytes += FMath::Max<int64>(Written, 0);
+            return Written >= 0;
+        };
+
+        Current[17].ButtonName = TEXT("修改后的按钮");
+        Current[17].DropdownItems.RemoveAt(3);
+        Report.Check(SaveBatch(), TEXT("AppendModify"), JournalPath);
+
+        Current.Append(MakeConfigs(2, 1));
+        Report.Check(SaveBatch(), TEXT("AppendAdd"), JournalPath);
+
+        Current.SetNum(150);
+        Current[0].bShowButtonText = !Current[0].bShowButtonText;
+        Report.Check(SaveBatch(), TEXT("AppendTruncate"), JournalPath);
+
+        TArray<FUtilityExtendJournalRecord> NoRecords;
+        FUtilityExtendConfigJournal::Diff(Persisted, Current, NoRecords);
+        Report.Check(NoRecords.Num() == 0, TEXT("DiffUnchanged"), FString::FromInt(NoRecords.Num()));
+
+        TArray<FToolbarButtonConfig> Replayed = BaseConfigs;
+        const int32 ReplayedCount = FUtilityExtendConfigJournal::Replay(BasePath, Replayed);
+        Report.Check(ReplayedCount > 0 && AllConfigsEqual(Replayed, Current), TEXT("Replay"), FString::FromInt(ReplayedCount));
+
+        // 写入中断留下的半行被跳过，之后追加的记录仍然有效
+        {
+            TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*JournalPath, FILEWRITE_Append));
+            const char TornLine[] = "{\"Op\":\"Set\",\"Index\":1,\"Butt";
+            if (Writer.IsValid())
+            {
+                Writer->Serialize(const_cast<char*>(TornLine), sizeof(TornLine) - 1);
+                Writer->Close();
+            }
+
+            Current[1].ButtonName = TEXT("中断后的修改");
+            Report.Check(SaveBatch(), TEXT("AppendAfterTorn"), JournalPath);
+
+            Replayed = BaseConfigs;
+            FUtilityExtendConfigJournal::Replay(BasePath, Replayed);
+            Report.Check(AllConfigsEqual(Replayed, Current), TEXT("ReplaySkipsTorn"), JournalPath);
+        }
+
+        // 配置文件被重写后旧日志不再回放，但不会被删除
+        {
+            FString RewrittenJson;
+            FUtilityExtendConfigJson::WriteButtonConfigs(MakeConfigs(3, 1), RewrittenJson);
+            FFileHelper::SaveStringToFile(RewrittenJson, *BasePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+            TArray<FToolbarButtonConfig> Untouched = MakeConfigs(3, 1);
+            const int32 OrphanedCount = FUtilityExtendConfigJournal::Replay(BasePath, Untouched);
+            Report.Check(OrphanedCount == 0 && AllConfigsEqual(Untouched, MakeConfigs(3, 1)) && IFileManager::Get().FileExists(*(JournalPath + TEXT(".orphaned"))),
+                TEXT("BaseMismatch"), JournalPath);
+        }
+
+        FString FullJson;
+        FUtilityExtendConfigJson::WriteButtonConfigs(Current, FullJson);
+        const int64 FullBytes = FTCHARToUTF8(*FullJson, FullJson.Len()).Length();
+        Test.AddInfo(FString::Printf(TEXT("4批修改追加日志共 %lld 字节，整文件重写每次 %lld 字节"), AppendedBytes, FullBytes));
+
+        IFileManager::Get().Delete(*BasePath, false, true, true);
+        IFileManager::Get().Delete(*(JournalPath + TEXT(".orphaned")), false, true, true);
+        FUtilityExtendConfigJournal::Delete(BasePath);
+
+        Report.LogSummary();
+    }
+#endif
+
+    /** 生成包含分隔符、引号、转义符和非ASCII字符的随机字符串 */
+    FString MakeFuzzString(FRandomStream& Random, int32 MaxLength)
+    {
+        static const TCHAR Alphabet[] = TEXT("abcXYZ019 _-.,()=\"\\/:;{}[]\t\n中文é");
+        const int32 AlphabetLength = static_cast<int32>(UE_ARRAY_COUNT(Alphabet)) - 1;
+
+        const int32 Length = Random.RandRange(0, MaxLength);
+        FString Result;
+        Result.Reserve(Length);
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            Result.AppendChar(Alphabet[Random.RandRange(0, AlphabetLength - 1)]);
+        }
+        return Result;
+    }
+
+    /** 生成随机的类路径（软引用路径本身会被规范化，只使用合法的路径） */
+    TSoftClassPtr<UUtilityExtendTopBarButtonScript> MakeFuzzClass(FRandomStream& Random)
+    {
+        if (Random.RandRange(0, 3) == 0)
+        {
+            return TSoftClassPtr<UUtilityExtendTopBarButtonScript>();
+        }
+        const int32 Id = Random.RandRange(0, 9999);
+        return FUtilityExtendConfigJson::ConfigStringToSoftClass(FString::Printf(TEXT("/Game/Fuzz/BS_%d.BS_%d_C"), Id, Id));
+    }
+
+    /** 生成一个随机按钮配置 */
+    FToolbarButtonConfig MakeFuzzConfig(FRandomStream& Random)
+    {
+        static const TCHAR* IconNames[] = { TEXT("None"), TEXT("工具箱"), TEXT("UtilityExtend.BtnIcon"), TEXT("Icon_01") };
+
+        FToolbarButtonConfig Config;
+        Config.ButtonName = MakeFuzzString(Random, 24);
+        Config.ButtonType = Random.RandRange(0, 1) == 0 ? EToolbarButtonType::SingleButton : EToolbarButtonType::DropdownButton;
+        Config.ButtonIconName = IconNames[Random.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(IconNames)) - 1)];
+        Config.bShowButtonText = Random.RandRange(0, 1) == 1;
+        Config.BoundClass = MakeFuzzClass(Random);
+
+        const int32 ItemCount = Random.RandRange(0, 6);
+        for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+        {
+            FToolbarDropdownItem& Item = Config.DropdownItems.AddDefaulted_GetRef();
+            Item.ItemName = MakeFuzzString(Random, 16);
+            Item.BoundClass = MakeFuzzClass(Random);
+        }
+        return Config;
+    }
+
+    /** 对文本做一次随机变异：替换、插入、删除、截断或复制片段 */
+    template<typename ElementType>
+    void MutateBuffer(FRandomStream& Random, TArray<ElementType>& Buffer, TFunctionRef<ElementType()> MakeElement)
+    {
+        const int32 Num = Buffer.Num();
+        const int32 Position = Num > 0 ? Random.RandRange(0, Num - 1) : 0;
+        switch (Random.RandRange(0, 4))
+        {
+        case 0:
+            if (Num > 0)
+            {
+                Buffer[Position] = MakeElement();
+            }
+            break;
+        case 1:
+            Buffer.Insert(MakeElement(), Position);
+            break;
+        case 2:
+            if (Num > 0)
+            {
+                Buffer.RemoveAt(Position, FMath::Min(Random.RandRange(1, 8), Num - Position));
+            }
+            break;
+        case 3:
+            Buffer.SetNum(Position);
+            break;
+        default:
+            if (Num > 0)
+            {
+                const int32 Count = FMath::Min(Random.RandRange(1, 32), Num - Position);
+                TArray<ElementType> Slice(Buffer.GetData() + Position, Count);
+                Buffer.Insert(Slice, Random.RandRange(0, Num));
+            }
+            break;
+        }
+    }
+
+    /** 变异一段配置文本 */
+    FString MutateText(FRandomStream& Random, const FString& Text)
+    {
+        static const TCHAR Hostile[] = TEXT("(),=\"\\ {}[]:x中");
+        const int32 HostileLength = static_cast<int32>(UE_ARRAY_COUNT(Hostile)) - 1;
+        TArray<TCHAR> Chars(*Text, Text.Len());
+        const int32 MutationCount = Random.RandRange(1, 4);
+        for (int32 Index = 0; Index < MutationCount; ++Index)
+        {
+            MutateBuffer<TCHAR>(Random, Chars, [&Random, HostileLength]() { return Hostile[Random.RandRange(0, HostileLength - 1)]; });
+        }
+        return FString(Chars.Num(), Chars.GetData());
+    }
+
+    /** 变异一段二进制数据 */
+    TArray<uint8> MutateBytes(FRandomStream& Random, const TArray<uint8>& Bytes)
+    {
+        TArray<uint8> Result = Bytes;
+        const int32 MutationCount = Random.RandRange(1, 4);
+        for (int32 Index = 0; Index < MutationCount; ++Index)
+        {
+            MutateBuffer<uint8>(Random, Result, [&Random]() { return static_cast<uint8>(Random.RandRange(0, 255)); });
+        }
+        return Result;
+    }
+
+    /** 单个解析器的模糊测试统计 */
+    struct FFuzzStats
+    {
+        const TCHAR* ParserName = TEXT("");
+        int32 RoundTripCases = 0;
+        int32 RoundTripFailures = 0;
+        int32 MutatedCases = 0;
+        int32 MutatedAccepted = 0;
+        int32 MutatedFailures = 0;
+
+        /** 记录一次失败，只输出前几条，避免刷屏 */
+        void ReportFailure(int32& Counter, const TCHAR* Kind, const FString& Input)
+        {
+            if (++Counter <= 5)
+            {
+                UE_LOG(LogTemp, Error, TEXT("UtilityExtend: [%s] %s失败，输入: %s"), ParserName, Kind, *Input.Left(256).ReplaceCharWithEscapedChar());
+            }
+        }
+    };
+
+    /** 旧版字符串解析器的期望结果：丢弃无名称的下拉项，单个按钮没有图标时使用默认图标 */
+    FToolbarButtonConfig MakeLegacyExpected(const FToolbarButtonConfig& Config)
+    {
+        FToolbarButtonConfig Expected = Config;
+        Expected.DropdownItems.RemoveAll([](const FToolbarDropdownItem& Item) { return Item.ItemName.IsEmpty(); });
+        if (Expected.ButtonType == EToolbarButtonType::SingleButton && Expected.ButtonIconName.IsNone())
+        {
+            Expected.ButtonIconName = FName(*FUtilityExtendIconRegistry::GetIconDisplayNameFromName(FUtilityExtendIconRegistry::GetDefaultButtonIconName()));
+        }
+        return Expected;
+    }
+
+    /** JSON只为下拉按钮保存下拉项 */
+    FToolbarButtonConfig MakeJsonExpected(const FToolbarButtonConfig& Config)
+    {
+        FToolbarButtonConfig Expected = Config;
+        if (Expected.ButtonType != EToolbarButtonType::DropdownButton)
+        {
+            Expected.DropdownItems.Empty();
+        }
+        return Expected;
+    }
+
+    /** 归档序列化 */
+    TArray<uint8> SaveArchive(const FToolbarButtonConfig& Config)
+    {
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        const_cast<FToolbarButtonConfig&>(Config).Serialize(Writer);
+        return Bytes;
+    }
+
+    bool LoadArchive(const TArray<uint8>& Bytes, FToolbarButtonConfig& OutConfig)
+    {
+        FMemoryReader Reader(Bytes);
+        OutConfig.Serialize(Reader);
+        return !Reader.IsError() && Reader.AtEnd();
+    }
+
+    /** 共用字符串表的批量格式（缓存使用） */
+    TArray<uint8> SaveConfigList(const TArray<FToolbarButtonConfig>& Configs)
+    {
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+        FUtilityExtendConfigArchive::SerializeConfigs(Writer, const_cast<TArray<FToolbarButtonConfig>&>(Configs));
+        return Bytes;
+    }
+
+    bool LoadConfigList(const TArray<uint8>& Bytes, TArray<FToolbarButtonConfig>& OutConfigs)
+    {
+        FMemoryReader Reader(Bytes);
+        FUtilityExtendConfigArchive::SerializeConfigs(Reader, OutConfigs);
+        return !Reader.IsError() && Reader.AtEnd();
+    }
+
+    /** JSON文本转为UTF-8字节 */
+    TArray<uint8> JsonToUtf8(const TArray<FToolbarButtonConfig>& Configs)
+    {
+        FString Json;
+        FUtilityExtendConfigJson::WriteButtonConfigs(Configs, Json);
+        const FTCHARToUTF8 Utf8Json(*Json);
+        return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8Json.Get()), Utf8Json.Length());
+    }
+
+    bool ReadJsonBytes(const TArray<uint8>& Bytes, TArray<FToolbarButtonConfig>& OutConfigs)
+    {
+        FString Error;
+        return FUtilityExtendConfigJson::ReadButtonConfigs(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num()), OutConfigs, Error);
+    }
+
+    /** 追加在变异文本之后的守卫文本，越界读取会把其中的标记读进字段 */
+    static const TCHAR OutOfBoundsGuard[] = TEXT("\",ButtonName=\"#OOB#\",ButtonIconName=#OOB#,DropdownItems=((ItemName=\"#OOB#\")))");
+
+    /** 读出的字段中是否带有守卫文本的标记 */
+    bool ContainsGuardMarker(const FToolbarButtonConfig& Config)
+    {
+        static const TCHAR Marker[] = TEXT("#OOB#");
+        if (Config.ButtonName.Contains(Marker) || Config.ButtonIconName.ToString().Contains(Marker))
+        {
+            return true;
+        }
+        return Config.DropdownItems.ContainsByPredicate([](const FToolbarDropdownItem& Item) { return Item.ItemName.Contains(Marker); });
+    }
+
+    /**
+     * 对所有配置解析器做模糊测试，结果追加到CSV
+     * @return 失败的用例数
+     */
+    int32 RunFuzz(int32 Iterations, int32 Seed)
+    {
+        FRandomStream Random(Seed);
+        FFuzzStats TextStats;
+        TextStats.ParserName = TEXT("ImportTextItem");
+        FFuzzStats LegacyStats;
+        LegacyStats.ParserName = TEXT("ParseButtonConfigFromString");
+        FFuzzStats JsonStats;
+        JsonStats.ParserName = TEXT("ReadButtonConfigs");
+        FFuzzStats ArchiveStats;
+        ArchiveStats.ParserName = TEXT("Serialize");
+        FFuzzStats ListStats;
+        ListStats.ParserName = TEXT("SerializeConfigs");
+
+        const double StartTime = FPlatformTime::Seconds();
+        {
+            FScopedQuietLog QuietLog;
+
+            for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+            {
+                const FToolbarButtonConfig Config = MakeFuzzConfig(Random);
+                const FString Text = ExportConfigText(Config);
+
+                // ImportTextItem：导出后必须原样读回；变异后的输入不能越界，读入成功时再导出导入必须稳定
+                {
+                    FToolbarButtonConfig Imported;
+                    FString Error;
+                    ++TextStats.RoundTripCases;
+                    if (!ImportConfigText(Text, Imported, Error) || !ConfigsEqual(Config, Imported))
+                    {
+                        TextStats.ReportFailure(TextStats.RoundTripFailures, TEXT("往返"), Text);
+                    }
+
+                    // 读取器只拿到变异文本的范围，后面紧跟守卫文本：越界读取会让读取位置超出范围或把守卫中的标记读进字段
+                    const FString Mutated = MutateText(Random, Text);
+                    const FString Guarded = Mutated + OutOfBoundsGuard;
+                    FUtilityExtendConfigTextReader Reader(FStringView(*Guarded, Mutated.Len()));
+                    FToolbarButtonConfig MutatedConfig;
+                    ++TextStats.MutatedCases;
+                    const bool bAccepted = MutatedConfig.ImportFromReader(Reader);
+                    if (Reader.GetOffset() > Mutated.Len() || ContainsGuardMarker(MutatedConfig))
+                    {
+                        TextStats.ReportFailure(TextStats.MutatedFailures, TEXT("越界读取"), Mutated);
+                    }
+                    else if (!bAccepted && !Reader.HasError())
+                    {
+                        TextStats.ReportFailure(TextStats.MutatedFailures, TEXT("拒绝时未记录错误"), Mutated);
+                    }
+                    else if (bAccepted)
+                    {
+                        ++TextStats.MutatedAccepted;
+                        FToolbarButtonConfig Reimported;
+                        if (!ImportConfigText(ExportConfigText(MutatedConfig), Reimported, Error) || !ConfigsEqual(MutatedConfig, Reimported))
+                        {
+                            TextStats.ReportFailure(TextStats.MutatedFailures, TEXT("变异输入再往返"), Mutated);
+                        }
+                    }
+                }
+
+                // 旧版字符串解析：导出文本也必须能被旧入口读取
+                {
+                    FToolbarButtonConfig Parsed;
+                    ++LegacyStats.RoundTripCases;
+                    const bool bParsed = UUtilityExtendPersistentSettings::ParseButtonConfigFromString(Text, Parsed);
+                    const bool bExpectSuccess = !Config.ButtonName.IsEmpty();
+                    if (bParsed != bExpectSuccess || (bParsed && !ConfigsEqual(MakeLegacyExpected(Config), Parsed)))
+                    {
+                        LegacyStats.ReportFailure(LegacyStats.RoundTripFailures, TEXT("往返"), Text);
+                    }
+
+                    const FString Mutated = MutateText(Random, Text);
+                    ++LegacyStats.MutatedCases;
+                    FToolbarButtonConfig MutatedConfig;
+                    if (UUtilityExtendPersistentSettings::ParseButtonConfigFromString(Mutated, MutatedConfig))
+                    {
+                        ++LegacyStats.MutatedAccepted;
+                        FToolbarButtonConfig Reparsed;
+                        if (!UUtilityExtendPersistentSettings::ParseButtonConfigFromString(ExportConfigText(MutatedConfig), Reparsed)
+                            || !ConfigsEqual(MutatedConfig, Reparsed))
+                        {
+                            LegacyStats.ReportFailure(LegacyStats.MutatedFailures, TEXT("变异输入再往返"), Mutated);
+                        }
+                    }
+                }
+
+                // JSON：与SaveToPluginConfig写出的格式往返
+                {
+                    const TArray<uint8> Json = JsonToUtf8({ Config });
+                    TArray<FToolbarButtonConfig> Parsed;
+                    ++JsonStats.RoundTripCases;
+                    if (!ReadJsonBytes(Json, Parsed) || Parsed.Num() != 1 || !ConfigsEqual(MakeJsonExpected(Config), Parsed[0]))
+                    {
+                        const FUTF8ToTCHAR JsonText(reinterpret_cast<const ANSICHAR*>(Json.GetData()), Json.Num());
+                        JsonStats.ReportFailure(JsonStats.RoundTripFailures, TEXT("往返"), FString(JsonText.Length(), JsonText.Get()));
+                    }
+
+                    const TArray<uint8> Mutated = MutateBytes(Random, Json);
+                    ++JsonStats.MutatedCases;
+                    TArray<FToolbarButtonConfig> MutatedConfigs;
+                    if (ReadJsonBytes(Mutated, MutatedConfigs))
+                    {
+                        ++JsonStats.MutatedAccepted;
+                        TArray<FToolbarButtonConfig> Reparsed;
+                        bool bStable = ReadJsonBytes(JsonToUtf8(MutatedConfigs), Reparsed) && Reparsed.Num() == MutatedConfigs.Num();
+                        for (int32 Index = 0; bStable && Index < Reparsed.Num(); ++Index)
+                        {
+                            bStable = ConfigsEqual(MutatedConfigs[Index], Reparsed[Index]);
+                        }
+                        if (!bStable)
+                        {
+                            JsonStats.ReportFailure(JsonStats.MutatedFailures, TEXT("变异输入再往返"), FString::Printf(TEXT("%d 字节"), Mutated.Num()));
+                        }
+                    }
+                }
+
+                // 归档：缓存使用的二进制格式，损坏的数据必须被拒绝而不是触发超大分配
+                {
+                    const TArray<uint8> Bytes = SaveArchive(Config);
+                    FToolbarButtonConfig Loaded;
+                    ++ArchiveStats.RoundTripCases;
+                    if (!LoadArchive(Bytes, Loaded) || !ConfigsEqual(Config, Loaded))
+                    {
+                        ArchiveStats.ReportFailure(ArchiveStats.RoundTripFailures, TEXT("往返"), FString::Printf(TEXT("%d 字节"), Bytes.Num()));
+                    }
+
+                    const TArray<uint8> Mutated = MutateBytes(Random, Bytes);
+                    ++ArchiveStats.MutatedCases;
+                    FToolbarButtonConfig MutatedConfig;
+                    if (LoadArchive(Mutated, MutatedConfig))
+                    {
+                        ++ArchiveStats.MutatedAccepted;
+                        FToolbarButtonConfig Reloaded;
+                        if (!LoadArchive(SaveArchive(MutatedConfig), Reloaded) || !ConfigsEqual(MutatedConfig, Reloaded))
+                        {
+                            ArchiveStats.ReportFailure(ArchiveStats.MutatedFailures, TEXT("变异输入再往返"), FString::Printf(TEXT("%d 字节"), Mutated.Num()));
+                        }
+                    }
+                }
+
+                // 批量格式：多个按钮共用字符串表，索引越界和计数损坏都必须被拒绝
+                {
+                    const TArray<FToolbarButtonConfig> Configs = { Config, MakeFuzzConfig(Random), Config };
+                    const TArray<uint8> Bytes = SaveConfigList(Configs);
+                    TArray<FToolbarButtonConfig> Loaded;
+                    ++ListStats.RoundTripCases;
+                    if (!LoadConfigList(Bytes, Loaded) || !AllConfigsEqual(Configs, Loaded))
+                    {
+                        ListStats.ReportFailure(ListStats.RoundTripFailures, TEXT("往返"), FString::Printf(TEXT("%d 字节"), Bytes.Num()));
+                    }
+
+                    const TArray<uint8> Mutated = MutateBytes(Random, Bytes);
+                    ++ListStats.MutatedCases;
+                    TArray<FToolbarButtonConfig> MutatedConfigs;
+                    if (LoadConfigList(Mutated, MutatedConfigs))
+                    {
+                        ++ListStats.MutatedAccepted;
+                        TArray<FToolbarButtonConfig> Reloaded;
+                        if (!LoadConfigList(SaveConfigList(MutatedConfigs), Reloaded) || !AllConfigsEqual(MutatedConfigs, Reloaded))
+                        {
+                            ListStats.ReportFailure(ListStats.MutatedFailures, TEXT("变异输入再往返"), FString::Printf(TEXT("%d 字节"), Mutated.Num()));
+                        }
+                    }
+                }
+            }
+        }
+        const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+        const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y-%m-%d %H:%M:%S"));
+        TArray<FString> Rows;
+        int32 TotalFailures = 0;
+        for (const FFuzzStats* Stats : { &TextStats, &LegacyStats, &JsonStats, &ArchiveStats, &ListStats })
+        {
+            TotalFailures += Stats->RoundTripFailures + Stats->MutatedFailures;
+            UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   %-28s 往返 %d/%d 失败，变异 %d 个（接受 %d），变异失败 %d"),
+                Stats->ParserName, Stats->RoundTripFailures, Stats->RoundTripCases, Stats->MutatedCases, Stats->MutatedAccepted, Stats->MutatedFailures);
+            Rows.Add(FString::Printf(TEXT("%s,%d,%s,%d,%d,%d,%d,%d"), *Timestamp, Seed, Stats->ParserName,
+                Stats->RoundTripCases, Stats->RoundTripFailures, Stats->MutatedCases, Stats->MutatedAccepted, Stats->MutatedFailures));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend: 配置解析模糊测试完成，种子 %d，迭代 %d 次，耗时 %.2f s，失败 %d 项"),
+            Seed, Iterations, ElapsedSeconds, TotalFailures);
+        AppendCsvRows(TEXT("ConfigParserFuzz.csv"),
+            TEXT("Timestamp,Seed,Parser,RoundTripCases,RoundTripFailures,MutatedCases,MutatedAccepted,MutatedFailures"), Rows);
+        return TotalFailures;
+    }
+
+    void RunFuzzCommand(const TArray<FString>& Args)
+    {
+        const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+        const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1;
+        RunFuzz(Iterations, Seed);
+    }
+
+    /** 单个解析器的吞吐量结果 */
+    struct FThroughputResult
+    {
+        const TCHAR* Name;
+        int64 Bytes;
+        double AverageSeconds;
+    };
+
+    /** 多次执行取平均耗时 */
+    double MeasureAverageSeconds(int32 Iterations, TFunctionRef<bool()> Body)
+    {
+        double TotalSeconds = 0.0;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            if (!Body())
+            {
+                return -1.0;
+            }
+            TotalSeconds += FPlatformTime::Seconds() - StartTime;
+        }
+        return FMath::Max(TotalSeconds / Iterations, UE_SMALL_NUMBER);
+    }
+
+    void RunParserBenchmark(const TArray<FString>& Args)
+    {
+        const int32 ButtonCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+        const int32 ItemsPerButton = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 10;
+        const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 5;
+
+        const TArray<FToolbarButtonConfig> Configs = MakeConfigs(ButtonCount, ItemsPerButton);
+        const int64 EntryCount = static_cast<int64>(ButtonCount) * (1 + ItemsPerButton);
+
+        // 各格式的输入数据
+        const TArray<uint8> Json = JsonToUtf8(Configs);
+
+        TArray<FString> ButtonTexts;
+        ButtonTexts.Reserve(ButtonCount);
+        FString ListText(TEXT("("));
+        for (const FToolbarButtonConfig& Config : Configs)
+        {
+            ButtonTexts.Add(ExportConfigText(Config));
+            if (ListText.Len() > 1)
+            {
+                ListText.AppendChar(TEXT(','));
+            }
+            ListText += ButtonTexts.Last();
+        }
+        ListText.AppendChar(TEXT(')'));
+
+        TArray<uint8> ArchiveBytes;
+        {
+            FMemoryWriter Writer(ArchiveBytes);
+            for (const FToolbarButtonConfig& Config : Configs)
+            {
+                const_cast<FToolbarButtonConfig&>(Config).Serialize(Writer);
+            }
+        }
+        const TArray<uint8> ListBytes = SaveConfigList(Configs);
+
+        TArray<FThroughputResult> Results;
+        {
+            FScopedQuietLog QuietLog;
+
+            Results.Add({ TEXT("JsonRead"), Json.Num(), MeasureAverageSeconds(Iterations, [&Json, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Parsed;
+                return ReadJsonBytes(Json, Parsed) && Parsed.Num() == ButtonCount;
+            }) });
+
+            Results.Add({ TEXT("JsonWrite"), Json.Num(), MeasureAverageSeconds(Iterations, [&Configs]()
+            {
+                FString Output;
+                FUtilityExtendConfigJson::WriteButtonConfigs(Configs, Output);
+                return !Output.IsEmpty();
+            }) });
+
+            Results.Add({ TEXT("ImportTextItem"), static_cast<int64>(ListText.Len() * sizeof(TCHAR)), MeasureAverageSeconds(Iterations, [&ListText, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Parsed;
+                Parsed.Reserve(ButtonCount);
+                FUtilityExtendConfigTextReader Reader(*ListText);
+                Reader.BeginGroup();
+                while (Reader.NextElement())
+                {
+                    if (!Parsed.AddDefaulted_GetRef().ImportFromReader(Reader))
+                    {
+                        return false;
+                    }
+                }
+                return !Reader.HasError() && Parsed.Num() == ButtonCount;
+            }) });
+
+            Results.Add({ TEXT("ExportTextItem"), static_cast<int64>(ListText.Len() * sizeof(TCHAR)), MeasureAverageSeconds(Iterations, [&Configs]()
+            {
+                FString Output;
+                for (const FToolbarButtonConfig& Config : Configs)
+                {
+                    Output += ExportConfigText(Config);
+                }
+                return !Output.IsEmpty();
+            }) });
+
+            Results.Add({ TEXT("ParseButtonConfigFromString"), static_cast<int64>(ListText.Len() * sizeof(TCHAR)), MeasureAverageSeconds(Iterations, [&ButtonTexts]()
+            {
+                FToolbarButtonConfig Parsed;
+                for (const FString& ButtonText : ButtonTexts)
+                {
+                    if (!UUtilityExtendPersistentSettings::ParseButtonConfigFromString(ButtonText, Parsed))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }) });
+
+            Results.Add({ TEXT("SerializeLoad"), ArchiveBytes.Num(), MeasureAverageSeconds(Iterations, [&ArchiveBytes, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Loaded;
+                Loaded.SetNum(ButtonCount);
+                FMemoryReader Reader(ArchiveBytes);
+                for (FToolbarButtonConfig& Config : Loaded)
+                {
+                    Config.Serialize(Reader);
+                }
+                return !Reader.IsError() && Reader.AtEnd();
+            }) });
+
+            Results.Add({ TEXT("SerializeConfigsLoad"), ListBytes.Num(), MeasureAverageSeconds(Iterations, [&ListBytes, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Loaded;
+                return LoadConfigList(ListBytes, Loaded) && Loaded.Num() == ButtonCount;
+            }) });
+        }
+
+        const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y-%m-%d %H:%M:%S"));
+        TArray<FString> Rows;
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend: 配置解析吞吐量 按钮 %d，每个按钮 %d 个下拉项，迭代 %d 次"), ButtonCount, ItemsPerButton, Iterations);
+        for (const FThroughputResult& Result : Results)
+        {
+            if (Result.AverageSeconds < 0.0)
+            {
+                UE_LOG(LogTemp, Error, TEXT("UtilityExtend:   %-28s 执行失败"), Result.Name);
+                continue;
+            }
+
+            const double Megabytes = Result.Bytes / (1024.0 * 1024.0);
+            UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   %-28s 平均 %8.2f ms，%8.1f MB/s，%10.0f 条目/s"),
+                Result.Name, Result.AverageSeconds * 1000.0, Megabytes / Result.AverageSeconds, EntryCount / Result.AverageSeconds);
+            Rows.Add(FString::Printf(TEXT("%s,%s,%d,%d,%d,%lld,%.4f,%.2f,%.0f"), *Timestamp, Result.Name, ButtonCount, ItemsPerButton, Iterations,
+                Result.Bytes, Result.AverageSeconds * 1000.0, Megabytes / Result.AverageSeconds, EntryCount / Result.AverageSeconds));
+        }
+
+        AppendCsvRows(TEXT("ConfigParserThroughput.csv"),
+            TEXT("Timestamp,Parser,Buttons,ItemsPerButton,Iterations,Bytes,AverageMs,MBPerSecond,EntriesPerSecond"), Rows);
+    }
+
+    /**
+     * 压力测试的耗时预算，按参考规模（10000个按钮，共100000个下拉项）给出，
+     * 其他规模按条目数线性换算；下拉菜单打开按单次计，与总规模无关
+     */
+    struct FStressBudget
+    {
+        const TCHAR* Name;
+        double BudgetMs;
+        bool bPerOperation;
+    };
+
+    static const FStressBudget StressBudgets[] =
+    {
+        { TEXT("JsonLoad"),      400.0, false },
+        { TEXT("SerializeLoad"), 150.0, false },
+        { TEXT("MergeLayers"),    60.0, false },
+        { TEXT("Registration"),  250.0, false },
+        { TEXT("RegistrationDetached"), 250.0, false },
+        { TEXT("DropdownOpen"),    2.0, true  },
+    };
+
+    /** 参考规模的条目数（按钮 + 下拉项） */
+    static constexpr int64 StressReferenceEntries = 10000 + 100000;
+
+    /** 单个按钮配置占用的内存（不含下拉项，FName和软引用路径中的名称在全局名称表中共享，不计入） */
+    SIZE_T GetButtonAllocatedSize(const FToolbarButtonConfig& Config)
+    {
+        return sizeof(FToolbarButtonConfig) + Config.ButtonName.GetAllocatedSize()
+            + Config.DropdownItems.GetAllocatedSize() - Config.DropdownItems.Num() * sizeof(FToolbarDropdownItem);
+    }
+
+    /** 单个下拉项占用的内存 */
+    SIZE_T GetItemAllocatedSize(const FToolbarDropdownItem& Item)
+    {
+        return sizeof(FToolbarDropdownItem) + Item.ItemName.GetAllocatedSize();
+    }
+
+    void RunStressTest(const TArray<FString>& Args)
+    {
+        const int32 ButtonCount = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+        const int32 ItemsPerButton = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 10;
+        const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 3;
+        const int64 EntryCount = static_cast<int64>(ButtonCount) * (1 + ItemsPerButton);
+        const double BudgetScale = static_cast<double>(EntryCount) / StressReferenceEntries;
+
+        // 三层配置：持久化层为完整配置，项目层改名覆盖一半按钮（大小写不同），用户层再覆盖十分之一
+        const TArray<FToolbarButtonConfig> Configs = MakeConfigs(ButtonCount, ItemsPerButton);
+        TArray<FToolbarButtonConfig> ProjectLayer;
+        TArray<FToolbarButtonConfig> UserLayer;
+        for (int32 Index = 0; Index < Configs.Num(); Index += 2)
+        {
+            FToolbarButtonConfig& Override = ProjectLayer.Add_GetRef(Configs[Index]);
+            Override.ButtonName = Override.ButtonName.ToUpper();
+            Override.bShowButtonText = true;
+        }
+        for (int32 Index = 0; Index < Configs.Num(); Index += 10)
+        {
+            UserLayer.Add_GetRef(Configs[Index]).ButtonIconName = TEXT("默认图标");
+        }
+
+        const TArray<uint8> Json = JsonToUtf8(Configs);
+        const TArray<uint8> ArchiveBytes = SaveConfigList(Configs);
+
+        // 配置本身的内存
+        SIZE_T ButtonBytes = 0;
+        SIZE_T ItemBytes = 0;
+        for (const FToolbarButtonConfig& Config : Configs)
+        {
+            ButtonBytes += GetButtonAllocatedSize(Config);
+            for (const FToolbarDropdownItem& Item : Config.DropdownItems)
+            {
+                ItemBytes += GetItemAllocatedSize(Item);
+            }
+        }
+        const int64 ItemCount = static_cast<int64>(ButtonCount) * ItemsPerButton;
+
+        UUtilityToolbarManager* ToolbarManager = NewObject<UUtilityToolbarManager>(GetTransientPackage());
+        TArray<double> MeasuredMs;
+        int64 RegistrationBytes = 0;
+        double DropdownOpenMs = -1.0;
+        {
+            FScopedQuietLog QuietLog;
+
+            MeasuredMs.Add(MeasureAverageSeconds(Iterations, [&Json, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Parsed;
+                return ReadJsonBytes(Json, Parsed) && Parsed.Num() == ButtonCount;
+            }) * 1000.0);
+
+            // 二进制加载与配置缓存相同，走共用字符串表的批量格式
+            MeasuredMs.Add(MeasureAverageSeconds(Iterations, [&ArchiveBytes, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Loaded;
+                return LoadConfigList(ArchiveBytes, Loaded) && Loaded.Num() == ButtonCount;
+            }) * 1000.0);
+
+            MeasuredMs.Add(MeasureAverageSeconds(Iterations, [&Configs, &ProjectLayer, &UserLayer, ButtonCount]()
+            {
+                TArray<FToolbarButtonConfig> Merged;
+                TArray<EUtilityExtendConfigLayer> Layers;
+                TMap<FString, int32> NameToIndex;
+                FUtilityExtendConfigResolver::MergeLayer(Configs, EUtilityExtendConfigLayer::Persistent, NameToIndex, Merged, Layers);
+                FUtilityExtendConfigResolver::MergeLayer(ProjectLayer, EUtilityExtendConfigLayer::Project, NameToIndex, Merged, Layers);
+                FUtilityExtendConfigResolver::MergeLayer(UserLayer, EUtilityExtendConfigLayer::User, NameToIndex, Merged, Layers);
+                return Merged.Num() == ButtonCount;
+            }) * 1000.0);
+
+            // 注册：与CreateToolbarButtons相同，把配置当作解析器的合并结果，下拉按钮只捕获名称
+            // 之后再按保留共享副本的路径注册一次，这是蓝图传入配置时的开销上限
+            UToolMenu* ToolbarMenu = nullptr;
+            for (const bool bFromResolver : { true, false })
+            {
+                MeasuredMs.Add(MeasureAverageSeconds(Iterations, [&Configs, &ToolbarMenu, ToolbarManager, ButtonCount, bFromResolver]()
+                {
+                    ToolbarMenu = NewObject<UToolMenu>(GetTransientPackage());
+                    FToolMenuSection& Section = ToolbarMenu->FindOrAddSection(TEXT("StressTest"));
+                    Section.Blocks.Reserve(ButtonCount);
+                    ToolbarManager->AddButtonsToSection(Configs, Section, bFromResolver);
+                    return Section.Blocks.Num() == ButtonCount;
+                }) * 1000.0);
+            }
+
+            // 打开下拉菜单：压力配置不在解析器中，使用保留副本的注册结果；
+            // 抽取最多100个下拉按钮，每次在新菜单上重建菜单项
+            const FToolMenuSection* Section = ToolbarMenu ? ToolbarMenu->FindSection(TEXT("StressTest")) : nullptr;
+            if (Section)
+            {
+                RegistrationBytes = Section->Blocks.GetAllocatedSize();
+            }
+            if (Section && Section->Blocks.Num() > 0 && ItemsPerButton > 0)
+            {
+                const int32 SampleCount = FMath::Min(100, Section->Blocks.Num());
+                const int32 Stride = FMath::Max(1, Section->Blocks.Num() / SampleCount);
+                DropdownOpenMs = MeasureAverageSeconds(SampleCount, [Section, Stride, ItemsPerButton, SampleIndex = 0]() mutable
+                {
+                    const FToolMenuEntry& Entry = Section->Blocks[(SampleIndex++ * Stride) % Section->Blocks.Num()];
+                    UToolMenu* DropdownMenu = NewObject<UToolMenu>(GetTransientPackage());
+                    Entry.SubMenuData.ConstructMenu.NewToolMenu.ExecuteIfBound(DropdownMenu);
+                    const FToolMenuSection* ItemSection = DropdownMenu->FindSection(TEXT("DropdownItems"));
+                    return ItemSection && ItemSection->Blocks.Num() == ItemsPerButton;
+                }) * 1000.0;
+            }
+        }
+        MeasuredMs.Add(DropdownOpenMs);
+
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend: 配置压力测试 按钮 %d，每个按钮 %d 个下拉项（共 %lld 项），迭代 %d 次"),
+            ButtonCount, ItemsPerButton, ItemCount, Iterations);
+
+        const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y-%m-%d %H:%M:%S"));
+        TArray<FString> Rows;
+        int32 OverBudgetCount = 0;
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(StressBudgets); ++Index)
+        {
+            const FStressBudget& Budget = StressBudgets[Index];
+            const double Measured = MeasuredMs[Index];
+            const double BudgetMs = Budget.bPerOperation ? Budget.BudgetMs : Budget.BudgetMs * BudgetScale;
+            if (Measured < 0.0)
+            {
+                UE_LOG(LogTemp, Error, TEXT("UtilityExtend:   %-20s 执行失败"), Budget.Name);
+                ++OverBudgetCount;
+                continue;
+            }
+
+            const bool bWithinBudget = Measured <= BudgetMs;
+            OverBudgetCount += bWithinBudget ? 0 : 1;
+            UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   %-20s 平均 %8.2f ms，预算 %8.2f ms %s"),
+                Budget.Name, Measured, BudgetMs, bWithinBudget ? TEXT("") : TEXT("<- 超出预算"));
+            Rows.Add(FString::Printf(TEXT("%s,%s,%d,%d,%d,%.4f,%.4f,%d"), *Timestamp, Budget.Name, ButtonCount, ItemsPerButton, Iterations,
+                Measured, BudgetMs, bWithinBudget ? 1 : 0));
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("UtilityExtend:   内存 每个按钮 %.1f 字节，每个下拉项 %.1f 字节，JSON每条目 %.1f 字节，二进制每条目 %.1f 字节，工具栏菜单项每个按钮 %.1f 字节"),
+            static_cast<double>(ButtonBytes) / ButtonCount,
+            ItemCount > 0 ? static_cast<double>(ItemBytes) / ItemCount : 0.0,
+            static_cast<double>(Json.Num()) / EntryCount,
+            static_cast<double>(ArchiveBytes.Num()) / EntryCount,
+            static_cast<double>(RegistrationBytes) / ButtonCount);
+        if (OverBudgetCount > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置压力测试有 %d 项超出预算"), OverBudgetCount);
+        }
+
+        AppendCsvRows(TEXT("ConfigStress.csv"),
+            TEXT("Timestamp,Path,Buttons,ItemsPerButton,Iterations,AverageMs,BudgetMs,WithinBudget"), Rows);
+    }
+
+    static FAutoConsoleCommand JsonBenchmarkCommand(
+        TEXT("UtilityExtend.Config.BenchmarkJson"),
+        TEXT("对比流式JSON解析与DOM解析的耗时和内存。参数: [按钮数量=2000] [每个按钮的下拉项数量=10] [迭代次数=5]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunJsonBenchmark));
+
+    static FAutoConsoleCommand FuzzCommand(
+        TEXT("UtilityExtend.Config.Fuzz"),
+        TEXT("对所有配置解析器做随机生成与变异输入的模糊测试，结果追加到Saved/UtilityExtend/Benchmarks/ConfigParserFuzz.csv。参数: [迭代次数=2000] [随机种子=1]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunFuzzCommand));
+
+    static FAutoConsoleCommand ParserBenchmarkCommand(
+        TEXT("UtilityExtend.Config.BenchmarkParsers"),
+        TEXT("测量所有配置解析器的吞吐量，结果追加到Saved/UtilityExtend/Benchmarks/ConfigParserThroughput.csv。参数: [按钮数量=2000] [每个按钮的下拉项数量=10] [迭代次数=5]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunParserBenchmark));
+
+    static FAutoConsoleCommand StressTestCommand(
+        TEXT("UtilityExtend.Config.StressTest"),
+        TEXT("用合成的大配置检查加载、合并、工具栏注册和下拉菜单打开的耗时预算，并报告每个按钮和下拉项的内存，结果追加到Saved/UtilityExtend/Benchmarks/ConfigStress.csv。参数: [按钮数量=10000] [每个按钮的下拉项数量=10] [迭代次数=3]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunStressTest));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// 配置文本（ImportTextItem/ExportTextItem）对特殊字符、旧格式和错误输入的处理
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendConfigTextTest, "UtilityExtend.Config.VerifyText",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendConfigTextTest::RunTest(const FString& Parameters)
+{
+    UtilityExtendConfigBenchmark::RunTextVerification(*this);
+    return true;
+}
+
+// 旧版本配置的迁移、回写后不重复迁移，以及配置校验结果的缓存
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendConfigSchemaTest, "UtilityExtend.Config.VerifySchema",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendConfigSchemaTest::RunTest(const FString& Parameters)
+{
+    UtilityExtendConfigBenchmark::RunSchemaVerification(*this);
+    return true;
+}
+
+// 在临时配置文件上校验变更日志的差异计算、追加、回放、中断恢复以及配置文件被重写后的处理
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendConfigJournalTest, "UtilityExtend.Config.VerifyJournal",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendConfigJournalTest::RunTest(const FString& Parameters)
+{
+    UtilityExtendConfigBenchmark::RunJournalVerification(*this);
+    return true;
+}
+
+// 默认参数的配置解析器模糊测试，更多迭代或其他种子使用UtilityExtend.Config.Fuzz命令
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendConfigFuzzTest, "UtilityExtend.Config.Fuzz",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendConfigFuzzTest::RunTest(const FString& Parameters)
+{
+    TestEqual(TEXT("模糊测试失败的用例数"), UtilityExtendConfigBenchmark::RunFuzz(2000, 1), 0);
+    return true;
+}
+
+#endif
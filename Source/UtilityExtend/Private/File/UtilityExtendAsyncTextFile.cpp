@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "File/UtilityExtendAsyncTextFile.h"
+#include "File/UtilityExtendTextFile.h"
+#include "Async/Async.h"
+
+UUtilityExtendAsyncTextFile* UUtilityExtendAsyncTextFile::ReadTextFileAsync(const FString& FilePath)
+{
+    UUtilityExtendAsyncTextFile* Action = NewObject<UUtilityExtendAsyncTextFile>();
+    Action->bWrite = false;
+    Action->FilePath = FilePath;
+    return Action;
+}
+
+UUtilityExtendAsyncTextFile* UUtilityExtendAsyncTextFile::WriteTextFileAsync(const FString& FilePath, const FString& Content, bool bOverwrite, bool bCreateDirectories)
+{
+    UUtilityExtendAsyncTextFile* Action = NewObject<UUtilityExtendAsyncTextFile>();
+    Action->bWrite = true;
+    Action->FilePath = FilePath;
+    Action->Content = Content;
+    Action->bOverwrite = bOverwrite;
+    Action->bCreateDirectories = bCreateDirectories;
+    return Action;
+}
+
+void UUtilityExtendAsyncTextFile::Cancel()
+{
+    State->bCancelled.store(true, std::memory_order_relaxed);
+}
+
+void UUtilityExtendAsyncTextFile::Activate()
+{
+    if (State->bCancelled.load(std::memory_order_relaxed))
+    {
+        Finish(false, FString(), FUtilityExtendTextFile::CancelledMessage);
+        return;
+    }
+
+    // 编辑器工具蓝图中没有GameInstance可以注册，读写期间加入根集防止节点被回收
+    AddToRoot();
+    bRunning = true;
+
+    TWeakObjectPtr<UUtilityExtendAsyncTextFile> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, State = State, bWrite = bWrite, FilePath = FilePath, Content = MoveTemp(Content),
+        bOverwrite = bOverwrite, bCreateDirectories = bCreateDirectories]() mutable
+    {
+        FString ResultContent;
+        FString ErrorMessage;
+        const bool bSuccess = bWrite
+            ? FUtilityExtendTextFile::Write(FilePath, Content, ErrorMessage, bOverwrite, bCreateDirectories, &State->bCancelled)
+            : FUtilityExtendTextFile::Read(FilePath, ResultContent, ErrorMessage, &State->bCancelled);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess, ResultContent = MoveTemp(ResultContent), ErrorMessage = MoveTemp(ErrorMessage)]() mutable
+        {
+            if (UUtilityExtendAsyncTextFile* Action = WeakThis.Get())
+            {
+                Action->Finish(bSuccess, MoveTemp(ResultContent), MoveTemp(ErrorMessage));
+            }
+        });
+    });
+}
+
+void UUtilityExtendAsyncTextFile::Finish(bool bSuccess, FString&& ResultContent, FString&& ErrorMessage)
+{
+    if (bRunning)
+    {
+        bRunning = false;
+        RemoveFromRoot();
+    }
+
+    if (bSuccess)
+    {
+        OnSuccess.Broadcast(ResultContent, ErrorMessage);
+    }
+    else
+    {
+        OnFailure.Broadcast(ResultContent, ErrorMessage);
+    }
+
+    SetReadyToDestroy();
+}
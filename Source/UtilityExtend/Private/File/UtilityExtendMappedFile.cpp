@@ -0,0 +1,238 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "File/UtilityExtendMappedFile.h"
+#include "File/UtilityExtendTextFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ByteSwap.h"
+
+namespace UtilityExtendMappedFileUtils
+{
+    /** 单次复制到字节数组的最大字节数 */
+    constexpr int32 MaxReadBytes = 64 * 1024 * 1024;
+
+    /** 按位交换字节序，浮点数按同样大小的整数处理 */
+    template <typename ValueType>
+    ValueType SwapBytes(ValueType Value)
+    {
+        if constexpr (sizeof(ValueType) == 1)
+        {
+            return Value;
+        }
+        else
+        {
+            using FIntType = std::conditional_t<sizeof(ValueType) == 2, uint16, std::conditional_t<sizeof(ValueType) == 4, uint32, uint64>>;
+            FIntType Bits;
+            FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+            Bits = ByteSwap(Bits);
+            FMemory::Memcpy(&Value, &Bits, sizeof(Bits));
+            return Value;
+        }
+    }
+}
+
+bool UUtilityExtendMappedFile::Open(const FString& FilePath, FString& OutErrorMessage)
+{
+    Close();
+    OutErrorMessage.Empty();
+
+    if (FilePath.IsEmpty())
+    {
+        OutErrorMessage = TEXT("文件路径不能为空");
+        UE_LOG(LogTemp, Error, TEXT("MappedFile: File path is empty"));
+        return false;
+    }
+
+    // 映射磁盘上的任意文件，直接使用物理文件系统
+    const FString FullPath = FUtilityExtendTextFile::ResolvePath(FilePath);
+    IPlatformFile& PlatformFile = IPlatformFile::GetPlatformPhysical();
+    if (!PlatformFile.FileExists(*FullPath))
+    {
+        OutErrorMessage = FString::Printf(TEXT("文件不存在: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("MappedFile: File does not exist: %s"), *FullPath);
+        return false;
+    }
+
+    if (PlatformFile.FileSize(*FullPath) <= 0)
+    {
+        OutErrorMessage = FString::Printf(TEXT("文件为空，无法映射: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("MappedFile: File is empty: %s"), *FullPath);
+        return false;
+    }
+
+    MappedFileHandle.Reset(PlatformFile.OpenMapped(*FullPath));
+    if (MappedFileHandle.IsValid())
+    {
+        MappedRegion.Reset(MappedFileHandle->MapRegion(0, MappedFileHandle->GetFileSize()));
+    }
+
+    if (!MappedRegion.IsValid())
+    {
+        Close();
+        OutErrorMessage = FString::Printf(TEXT("映射文件失败: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("MappedFile: Failed to map file: %s"), *FullPath);
+        return false;
+    }
+
+    MappedData = MappedRegion->GetMappedPtr();
+    MappedSize = MappedRegion->GetMappedSize();
+
+    UE_LOG(LogTemp, Log, TEXT("MappedFile: Mapped file: %s (%lld bytes)"), *FullPath, MappedSize);
+    return true;
+}
+
+template <typename ValueType>
+bool UUtilityExtendMappedFile::ReadValue(int64 Offset, bool bBigEndian, ValueType& OutValue) const
+{
+    OutValue = ValueType();
+    const uint8* Data = GetRange(Offset, sizeof(ValueType));
+    if (!Data)
+    {
+        return false;
+    }
+
+    // 偏移不一定对齐，复制到局部变量再读取
+    FMemory::Memcpy(&OutValue, Data, sizeof(ValueType));
+
+    // 文件字节序与本机不同时交换字节
+    const bool bNativeBigEndian = !PLATFORM_LITTLE_ENDIAN;
+    if (bBigEndian != bNativeBigEndian)
+    {
+        OutValue = UtilityExtendMappedFileUtils::SwapBytes(OutValue);
+    }
+    return true;
+}
+
+const uint8* UUtilityExtendMappedFile::GetRange(int64 Offset, int64 Count) const
+{
+    if (!IsOpen() || Offset < 0 || Count < 0 || Offset > MappedSize - Count)
+    {
+        return nullptr;
+    }
+    return MappedData + Offset;
+}
+
+bool UUtilityExtendMappedFile::ReadBytes(int64 Offset, int32 Count, TArray<uint8>& OutBytes) const
+{
+    OutBytes.Reset();
+    if (Count < 0 || Count > UtilityExtendMappedFileUtils::MaxReadBytes)
+    {
+        return false;
+    }
+
+    const uint8* Data = GetRange(Offset, Count);
+    if (!Data)
+    {
+        return false;
+    }
+
+    // 蓝图数组必须持有自己的内存，只复制请求的范围
+    OutBytes.Append(Data, Count);
+    return true;
+}
+
+bool UUtilityExtendMappedFile::ReadByte(int64 Offset, uint8& OutValue) const
+{
+    return ReadValue(Offset, false, OutValue);
+}
+
+bool UUtilityExtendMappedFile::ReadInt16(int64 Offset, int32& OutValue, bool bBigEndian) const
+{
+    int16 Value = 0;
+    const bool bSuccess = ReadValue(Offset, bBigEndian, Value);
+    OutValue = Value;
+    return bSuccess;
+}
+
+bool UUtilityExtendMappedFile::ReadInt32(int64 Offset, int32& OutValue, bool bBigEndian) const
+{
+    return ReadValue(Offset, bBigEndian, OutValue);
+}
+
+bool UUtilityExtendMappedFile::ReadInt64(int64 Offset, int64& OutValue, bool bBigEndian) const
+{
+    return ReadValue(Offset, bBigEndian, OutValue);
+}
+
+bool UUtilityExtendMappedFile::ReadFloat(int64 Offset, float& OutValue, bool bBigEndian) const
+{
+    return ReadValue(Offset, bBigEndian, OutValue);
+}
+
+bool UUtilityExtendMappedFile::ReadDouble(int64 Offset, double& OutValue, bool bBigEndian) const
+{
+    return ReadValue(Offset, bBigEndian, OutValue);
+}
+
+bool UUtilityExtendMappedFile::ReadString(int64 Offset, int32 MaxBytes, bool bUtf16, FString& OutValue) const
+{
+    OutValue.Reset();
+    if (!IsOpen() || Offset < 0 || Offset >= MappedSize || MaxBytes <= 0)
+    {
+        return false;
+    }
+
+    const uint8* Data = MappedData + Offset;
+    const int64 Available = FMath::Min<int64>(MaxBytes, MappedSize - Offset);
+
+    if (bUtf16)
+    {
+        // 映射区域中的偏移不一定对齐，逐个字符单元复制
+        TArray<UTF16CHAR, TInlineAllocator<256>> Units;
+        for (int64 Index = 0; Index + 1 < Available; Index += 2)
+        {
+            UTF16CHAR Unit;
+            FMemory::Memcpy(&Unit, Data + Index, sizeof(Unit));
+            if (Unit == 0)
+            {
+                break;
+            }
+            Units.Add(Unit);
+        }
+        const auto Converted = StringCast<TCHAR>(Units.GetData(), Units.Num());
+        OutValue = FString(Converted.Length(), Converted.Get());
+        return true;
+    }
+
+    int32 Length = 0;
+    while (Length < Available && Data[Length] != 0)
+    {
+        ++Length;
+    }
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data), Length);
+    OutValue = FString(Converted.Length(), Converted.Get());
+    return true;
+}
+
+int64 UUtilityExtendMappedFile::FindBytes(const TArray<uint8>& Pattern, int64 StartOffset) const
+{
+    if (!IsOpen() || Pattern.Num() == 0 || StartOffset < 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const uint8 First = Pattern[0];
+    const int64 LastStart = MappedSize - Pattern.Num();
+    for (int64 Offset = StartOffset; Offset <= LastStart; ++Offset)
+    {
+        if (MappedData[Offset] == First && FMemory::Memcmp(MappedData + Offset, Pattern.GetData(), Pattern.Num()) == 0)
+        {
+            return Offset;
+        }
+    }
+    return INDEX_NONE;
+}
+
+void UUtilityExtendMappedFile::Close()
+{
+    // 先释放区域再释放文件句柄
+    MappedData = nullptr;
+    MappedSize = 0;
+    MappedRegion.Reset();
+    MappedFileHandle.Reset();
+}
+
+void UUtilityExtendMappedFile::BeginDestroy()
+{
+    Close();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "File/UtilityExtendTextFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+const TCHAR* FUtilityExtendTextFile::CancelledMessage = TEXT("操作已取消");
+
+namespace UtilityExtendTextFileUtils
+{
+    /** 读取时每块的字节数 */
+    constexpr int64 ReadChunkBytes = 4 * 1024 * 1024;
+
+    /** 写入时每块的字符数 */
+    constexpr int32 WriteChunkChars = 1024 * 1024;
+
+    bool IsCancelled(const std::atomic<bool>* bCancelled)
+    {
+        return bCancelled && bCancelled->load(std::memory_order_relaxed);
+    }
+
+    /** 按块写入内容，纯ANSI内容写为ANSI，否则写为带BOM的UTF-16，与SaveStringToFile的默认编码一致 */
+    bool WriteContent(IFileHandle& FileHandle, const FString& Content, const std::atomic<bool>* bCancelled, bool& bOutCancelled)
+    {
+        bOutCancelled = false;
+
+        const TCHAR* Chars = *Content;
+        const int32 Length = Content.Len();
+        const bool bPureAnsi = FCString::IsPureAnsi(Chars);
+
+        if (!bPureAnsi)
+        {
+            const UTF16CHAR Bom = UNICODE_BOM;
+            if (!FileHandle.Write(reinterpret_cast<const uint8*>(&Bom), sizeof(Bom)))
+            {
+                return false;
+            }
+        }
+
+        for (int32 Start = 0; Start < Length; Start += WriteChunkChars)
+        {
+            if (IsCancelled(bCancelled))
+            {
+                bOutCancelled = true;
+                return false;
+            }
+
+            const int32 Count = FMath::Min(WriteChunkChars, Length - Start);
+            bool bWritten = false;
+            if (bPureAnsi)
+            {
+                const auto Converted = StringCast<ANSICHAR>(Chars + Start, Count);
+                bWritten = FileHandle.Write(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length() * sizeof(ANSICHAR));
+            }
+            else
+            {
+                const auto Converted = StringCast<UTF16CHAR>(Chars + Start, Count);
+                bWritten = FileHandle.Write(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length() * sizeof(UTF16CHAR));
+            }
+
+            if (!bWritten)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+FString FUtilityExtendTextFile::ResolvePath(const FString& FilePath)
+{
+    // 相对路径转换为项目相对路径，绝对路径直接使用
+    FString FullPath = FPaths::IsRelative(FilePath) ? FPaths::ProjectDir() + FilePath : FilePath;
+    FPaths::NormalizeFilename(FullPath);
+    return FullPath;
+}
+
+bool FUtilityExtendTextFile::Read(const FString& FilePath, FString& OutContent, FString& OutErrorMessage, const std::atomic<bool>* bCancelled)
+{
+    using namespace UtilityExtendTextFileUtils;
+
+    // 清空输出参数
+    OutContent.Empty();
+    OutErrorMessage.Empty();
+
+    // 检查文件路径是否为空
+    if (FilePath.IsEmpty())
+    {
+        OutErrorMessage = TEXT("文件路径不能为空");
+        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: File path is empty"));
+        return false;
+    }
+
+    const FString FullPath = ResolvePath(FilePath);
+
+    // 检查文件是否存在
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*FullPath))
+    {
+        OutErrorMessage = FString::Printf(TEXT("文件不存在: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: File does not exist: %s"), *FullPath);
+        return false;
+    }
+
+    // 按块读取，块之间检查取消标记；与LoadFileToString相同，不支持超过2GB的文件
+    TArray<uint8> Data;
+    bool bReadSucceeded = false;
+    {
+        TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenRead(*FullPath));
+        const int64 FileSize = FileHandle.IsValid() ? FileHandle->Size() : -1;
+        if (FileSize >= 0 && FileSize <= MAX_int32)
+        {
+            Data.SetNumUninitialized(static_cast<int32>(FileSize));
+            bReadSucceeded = true;
+            for (int64 Offset = 0; Offset < FileSize && bReadSucceeded; Offset += ReadChunkBytes)
+            {
+                if (IsCancelled(bCancelled))
+                {
+                    OutErrorMessage = CancelledMessage;
+                    UE_LOG(LogTemp, Log, TEXT("ReadTextFile: Cancelled: %s"), *FullPath);
+                    return false;
+                }
+                bReadSucceeded = FileHandle->Read(Data.GetData() + Offset, FMath::Min(ReadChunkBytes, FileSize - Offset));
+            }
+        }
+    }
+
+    if (!bReadSucceeded)
+    {
+        OutErrorMessage = FString::Printf(TEXT("读取文件失败: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("ReadTextFile: Failed to load file: %s"), *FullPath);
+        return false;
+    }
+
+    // 编码识别与LoadFileToString相同
+    FFileHelper::BufferToString(OutContent, Data.GetData(), Data.Num());
+
+    UE_LOG(LogTemp, Log, TEXT("ReadTextFile: Successfully read file: %s (%d characters)"), *FullPath, OutContent.Len());
+    return true;
+}
+
+bool FUtilityExtendTextFile::Write(const FString& FilePath, const FString& Content, FString& OutErrorMessage, bool bOverwrite, bool bCreateDirectories, const std::atomic<bool>* bCancelled)
+{
+    using namespace UtilityExtendTextFileUtils;
+
+    // 清空输出参数
+    OutErrorMessage.Empty();
+
+    // 检查文件路径是否为空
+    if (FilePath.IsEmpty())
+    {
+        OutErrorMessage = TEXT("文件路径不能为空");
+        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: File path is empty"));
+        return false;
+    }
+
+    const FString FullPath = ResolvePath(FilePath);
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // 检查文件是否存在，如果存在且不允许覆盖，则返回错误
+    const bool bFileExists = PlatformFile.FileExists(*FullPath);
+    if (bFileExists && !bOverwrite)
+    {
+        OutErrorMessage = FString::Printf(TEXT("文件已存在且不允许覆盖: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: File exists and overwrite is disabled: %s"), *FullPath);
+        return false;
+    }
+
+    // 如果需要创建目录，先创建目录
+    if (bCreateDirectories)
+    {
+        const FString Directory = FPaths::GetPath(FullPath);
+        if (!Directory.IsEmpty() && !PlatformFile.DirectoryExists(*Directory))
+        {
+            if (!PlatformFile.CreateDirectoryTree(*Directory))
+            {
+                OutErrorMessage = FString::Printf(TEXT("创建目录失败: %s"), *Directory);
+                UE_LOG(LogTemp, Error, TEXT("WriteTextFile: Failed to create directory: %s"), *Directory);
+                return false;
+            }
+        }
+    }
+
+    // 先写入临时文件，全部写完后再替换目标文件
+    const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *FullPath, *FGuid::NewGuid().ToString(EGuidFormats::Short));
+    bool bWriteSucceeded = false;
+    bool bWasCancelled = false;
+    {
+        TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*TempPath));
+        bWriteSucceeded = FileHandle.IsValid() && WriteContent(*FileHandle, Content, bCancelled, bWasCancelled) && FileHandle->Flush();
+    }
+
+    if (bWriteSucceeded)
+    {
+        // 由文件管理器替换目标文件，不再自行先删除再移动
+        bWriteSucceeded = IFileManager::Get().Move(*FullPath, *TempPath, /*bReplace*/ true);
+
+        // 替换失败时原文件可能已被删除，此时临时文件是唯一完整的内容，保留并返回它的路径
+        if (!bWriteSucceeded && bFileExists && !PlatformFile.FileExists(*FullPath) && PlatformFile.FileExists(*TempPath))
+        {
+            OutErrorMessage = FString::Printf(TEXT("替换文件失败，原文件已不存在，新内容保留在临时文件: %s"), *TempPath);
+            UE_LOG(LogTemp, Error, TEXT("WriteTextFile: Failed to replace %s, new content kept in %s"), *FullPath, *TempPath);
+            return false;
+        }
+    }
+
+    if (!bWriteSucceeded)
+    {
+        PlatformFile.DeleteFile(*TempPath);
+
+        if (bWasCancelled)
+        {
+            OutErrorMessage = CancelledMessage;
+            UE_LOG(LogTemp, Log, TEXT("WriteTextFile: Cancelled: %s"), *FullPath);
+            return false;
+        }
+
+        OutErrorMessage = FString::Printf(TEXT("写入文件失败: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("WriteTextFile: Failed to save file: %s"), *FullPath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("WriteTextFile: Successfully wrote file: %s (%d characters)"), *FullPath, Content.Len());
+    return true;
+}
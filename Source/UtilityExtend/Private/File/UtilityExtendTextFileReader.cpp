@@ -0,0 +1,351 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "File/UtilityExtendTextFileReader.h"
+#include "File/UtilityExtendTextFile.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace UtilityExtendTextFileReaderUtils
+{
+    /** 读取缓冲区大小，必须为偶数以保证UTF-16字符单元不跨缓冲区 */
+    constexpr int32 BufferSize = 64 * 1024;
+
+    /** 单行的字节数上限，超过后拆分返回 */
+    constexpr int32 MaxLineBytes = 1024 * 1024;
+
+    /** 末尾不完整的UTF-8字符的字节数，末尾字符完整时返回0 */
+    int32 GetIncompleteUtf8TailBytes(const TArray<uint8>& Bytes)
+    {
+        const int32 Num = Bytes.Num();
+        for (int32 Back = 1; Back <= FMath::Min(Num, 4); ++Back)
+        {
+            const uint8 Byte = Bytes[Num - Back];
+            if ((Byte & 0xC0) != 0x80)
+            {
+                // 按首字节的高位判断字符长度
+                const int32 CharBytes = Byte >= 0xF0 ? 4 : Byte >= 0xE0 ? 3 : Byte >= 0xC0 ? 2 : 1;
+                return CharBytes > Back ? Back : 0;
+            }
+        }
+        return 0;
+    }
+
+    /** 末尾是否为代理对的前半个字符单元，是则返回该单元的字节数2，否则返回0 */
+    int32 GetIncompleteUtf16TailBytes(const TArray<uint8>& Bytes, bool bBigEndian)
+    {
+        const int32 Num = Bytes.Num();
+        if (Num < 2)
+        {
+            return 0;
+        }
+        const uint16 Unit = bBigEndian
+            ? static_cast<uint16>((Bytes[Num - 2] << 8) | Bytes[Num - 1])
+            : static_cast<uint16>((Bytes[Num - 1] << 8) | Bytes[Num - 2]);
+        return Unit >= 0xD800 && Unit <= 0xDBFF ? 2 : 0;
+    }
+}
+
+bool UUtilityExtendTextFileReader::Open(const FString& FilePath, FString& OutErrorMessage)
+{
+    Close();
+    OutErrorMessage.Empty();
+
+    if (FilePath.IsEmpty())
+    {
+        OutErrorMessage = TEXT("文件路径不能为空");
+        UE_LOG(LogTemp, Error, TEXT("TextFileReader: File path is empty"));
+        return false;
+    }
+
+    const FString FullPath = FUtilityExtendTextFile::ResolvePath(FilePath);
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*FullPath))
+    {
+        OutErrorMessage = FString::Printf(TEXT("文件不存在: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("TextFileReader: File does not exist: %s"), *FullPath);
+        return false;
+    }
+
+    FileHandle.Reset(PlatformFile.OpenRead(*FullPath));
+    if (!FileHandle.IsValid())
+    {
+        OutErrorMessage = FString::Printf(TEXT("读取文件失败: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("TextFileReader: Failed to open file: %s"), *FullPath);
+        return false;
+    }
+    FileSize = FileHandle->Size();
+
+    // 按BOM识别编码，没有BOM时按UTF-8读取，与LoadFileToString一致
+    uint8 Bom[3] = { 0, 0, 0 };
+    const int64 BomBytes = FMath::Min<int64>(FileSize, 3);
+    if (BomBytes > 0 && !FileHandle->Read(Bom, BomBytes))
+    {
+        Close();
+        OutErrorMessage = FString::Printf(TEXT("读取文件失败: %s"), *FullPath);
+        UE_LOG(LogTemp, Error, TEXT("TextFileReader: Failed to read file: %s"), *FullPath);
+        return false;
+    }
+
+    if (BomBytes >= 2 && Bom[0] == 0xFF && Bom[1] == 0xFE)
+    {
+        Encoding = EEncoding::Utf16LE;
+        DataStart = 2;
+    }
+    else if (BomBytes >= 2 && Bom[0] == 0xFE && Bom[1] == 0xFF)
+    {
+        Encoding = EEncoding::Utf16BE;
+        DataStart = 2;
+    }
+    else if (BomBytes >= 3 && Bom[0] == 0xEF && Bom[1] == 0xBB && Bom[2] == 0xBF)
+    {
+        Encoding = EEncoding::Utf8;
+        DataStart = 3;
+    }
+    else
+    {
+        Encoding = EEncoding::Utf8;
+        DataStart = 0;
+    }
+
+    Buffer.SetNumUninitialized(UtilityExtendTextFileReaderUtils::BufferSize);
+    return Seek(DataStart);
+}
+
+bool UUtilityExtendTextFileReader::ReadLine(FString& OutLine)
+{
+    OutLine.Reset();
+    if (!FileHandle.IsValid())
+    {
+        return false;
+    }
+
+    const int32 UnitSize = GetUnitSize();
+    LineBytes.Reset();
+    bool bHasData = false;
+
+    for (;;)
+    {
+        if (BufferPos >= BufferLength && !FillBuffer())
+        {
+            break;
+        }
+        bHasData = true;
+
+        const int32 Newline = FindNewline(BufferPos);
+        int32 End = Newline != INDEX_NONE ? Newline : BufferLength;
+
+        // 超过单行上限时在上限处截断
+        const int32 Room = UtilityExtendTextFileReaderUtils::MaxLineBytes - LineBytes.Num();
+        bool bLineFull = false;
+        if (End - BufferPos > Room)
+        {
+            End = BufferPos + Room;
+            bLineFull = true;
+        }
+
+        LineBytes.Append(Buffer.GetData() + BufferPos, End - BufferPos);
+        BufferPos = End;
+
+        if (bLineFull)
+        {
+            // 不截断在UTF-8多字节字符或UTF-16代理对中间；上限可能正好落在缓冲区边界，字符的前半部分已在上一块中，按已拼接的字节回退
+            const int32 TrimBytes = Encoding == EEncoding::Utf8
+                ? UtilityExtendTextFileReaderUtils::GetIncompleteUtf8TailBytes(LineBytes)
+                : UtilityExtendTextFileReaderUtils::GetIncompleteUtf16TailBytes(LineBytes, Encoding == EEncoding::Utf16BE);
+            if (TrimBytes > 0)
+            {
+                LineBytes.SetNum(LineBytes.Num() - TrimBytes, EAllowShrinking::No);
+                if (BufferPos >= TrimBytes)
+                {
+                    BufferPos -= TrimBytes;
+                }
+                else
+                {
+                    Seek(GetPosition() - TrimBytes);
+                }
+            }
+            break;
+        }
+        if (Newline != INDEX_NONE)
+        {
+            // 跳过换行符
+            BufferPos += UnitSize;
+            break;
+        }
+    }
+
+    if (!bHasData)
+    {
+        return false;
+    }
+
+    OutLine = DecodeLine(LineBytes);
+    return true;
+}
+
+int32 UUtilityExtendTextFileReader::ReadLines(int32 MaxLines, TArray<FString>& OutLines, TArray<int64>& OutLineOffsets)
+{
+    OutLines.Reset();
+    OutLineOffsets.Reset();
+
+    FString Line;
+    while (OutLines.Num() < MaxLines)
+    {
+        const int64 Offset = GetPosition();
+        if (!ReadLine(Line))
+        {
+            break;
+        }
+        OutLines.Add(MoveTemp(Line));
+        OutLineOffsets.Add(Offset);
+    }
+    return OutLines.Num();
+}
+
+bool UUtilityExtendTextFileReader::ReadChunk(int32 MaxBytes, FString& OutText)
+{
+    OutText.Reset();
+
+    FString Line;
+    bool bReadAny = false;
+    const int64 StartPosition = GetPosition();
+    while (!bReadAny || GetPosition() - StartPosition < MaxBytes)
+    {
+        if (!ReadLine(Line))
+        {
+            break;
+        }
+        if (bReadAny)
+        {
+            OutText.AppendChar(TEXT('\n'));
+        }
+        OutText.Append(Line);
+        bReadAny = true;
+    }
+    return bReadAny;
+}
+
+bool UUtilityExtendTextFileReader::Seek(int64 Offset)
+{
+    if (!FileHandle.IsValid() || Offset < 0 || Offset > FileSize)
+    {
+        return false;
+    }
+
+    // 偏移落在BOM中或UTF-16字符单元中间时调整到最近的字符单元起点
+    Offset = FMath::Max(Offset, DataStart);
+    Offset -= (Offset - DataStart) % GetUnitSize();
+
+    if (!FileHandle->Seek(Offset))
+    {
+        return false;
+    }
+    BufferStart = Offset;
+    BufferLength = 0;
+    BufferPos = 0;
+    return true;
+}
+
+void UUtilityExtendTextFileReader::Close()
+{
+    FileHandle.Reset();
+    Buffer.Empty();
+    LineBytes.Empty();
+    FileSize = 0;
+    DataStart = 0;
+    BufferStart = 0;
+    BufferLength = 0;
+    BufferPos = 0;
+}
+
+void UUtilityExtendTextFileReader::BeginDestroy()
+{
+    Close();
+    Super::BeginDestroy();
+}
+
+bool UUtilityExtendTextFileReader::FillBuffer()
+{
+    BufferStart += BufferLength;
+    BufferPos = 0;
+    BufferLength = static_cast<int32>(FMath::Min<int64>(Buffer.Num(), FileSize - BufferStart));
+    if (BufferLength <= 0)
+    {
+        BufferLength = 0;
+        return false;
+    }
+
+    if (!FileHandle->Read(Buffer.GetData(), BufferLength))
+    {
+        UE_LOG(LogTemp, Error, TEXT("TextFileReader: Failed to read at offset %lld"), BufferStart);
+        BufferLength = 0;
+        return false;
+    }
+    return true;
+}
+
+int32 UUtilityExtendTextFileReader::FindNewline(int32 Start) const
+{
+    const uint8* Data = Buffer.GetData();
+    switch (Encoding)
+    {
+    case EEncoding::Utf16LE:
+        for (int32 Index = Start; Index + 1 < BufferLength; Index += 2)
+        {
+            if (Data[Index] == '\n' && Data[Index + 1] == 0)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    case EEncoding::Utf16BE:
+        for (int32 Index = Start; Index + 1 < BufferLength; Index += 2)
+        {
+            if (Data[Index] == 0 && Data[Index + 1] == '\n')
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    default:
+        for (int32 Index = Start; Index < BufferLength; ++Index)
+        {
+            if (Data[Index] == '\n')
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+}
+
+FString UUtilityExtendTextFileReader::DecodeLine(TArray<uint8>& Bytes) const
+{
+    if (Encoding == EEncoding::Utf8)
+    {
+        int32 Length = Bytes.Num();
+        if (Length > 0 && Bytes[Length - 1] == '\r')
+        {
+            --Length;
+        }
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Length);
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    // UTF-16按小端解码，大端先交换字节
+    int32 UnitCount = Bytes.Num() / 2;
+    if (Encoding == EEncoding::Utf16BE)
+    {
+        for (int32 Index = 0; Index < UnitCount; ++Index)
+        {
+            Swap(Bytes[Index * 2], Bytes[Index * 2 + 1]);
+        }
+    }
+
+    const UTF16CHAR* Units = reinterpret_cast<const UTF16CHAR*>(Bytes.GetData());
+    if (UnitCount > 0 && Units[UnitCount - 1] == '\r')
+    {
+        --UnitCount;
+    }
+    const auto Converted = StringCast<TCHAR>(Units, UnitCount);
+    return FString(Converted.Length(), Converted.Get());
+}
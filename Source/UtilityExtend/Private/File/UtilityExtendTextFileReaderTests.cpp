@@ -0,0 +1,186 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "File/UtilityExtendTextFileReader.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UtilityExtendTextFileReaderTestsUtils
+{
+    /** 用例不满足时记录为测试错误 */
+    void Check(FAutomationTestBase& Test, bool bCondition, const TCHAR* CaseName, const FString& Detail)
+    {
+        if (!bCondition)
+        {
+            Test.AddError(FString::Printf(TEXT("流式文本读取校验失败 [%s] %s"), CaseName, *Detail));
+        }
+    }
+
+    /** 把文本按UTF-8追加到字节数组 */
+    void AppendUtf8(TArray<uint8>& Bytes, const FString& Text)
+    {
+        const FTCHARToUTF8 Converted(*Text, Text.Len());
+        Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+    }
+
+    /** 把文本按UTF-16大端追加到字节数组 */
+    void AppendUtf16BE(TArray<uint8>& Bytes, const FString& Text)
+    {
+        for (const TCHAR Char : Text)
+        {
+            Bytes.Add(static_cast<uint8>((Char >> 8) & 0xFF));
+            Bytes.Add(static_cast<uint8>(Char & 0xFF));
+        }
+    }
+
+    /** 写入校验文件后从头读出所有行，读取器保持打开供之后跳转 */
+    bool ReadFixture(FAutomationTestBase& Test, UUtilityExtendTextFileReader& Reader, const FString& FilePath, const TArray<uint8>& Bytes, TArray<FString>& OutLines, TArray<int64>& OutOffsets)
+    {
+        OutLines.Reset();
+        OutOffsets.Reset();
+
+        FString Error;
+        if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath) || !Reader.Open(FilePath, Error))
+        {
+            Test.AddError(FString::Printf(TEXT("无法准备校验文件 %s %s"), *FilePath, *Error));
+            return false;
+        }
+        Reader.ReadLines(MAX_int32, OutLines, OutOffsets);
+        return true;
+    }
+}
+
+// 流式文本读取器：跨64KB缓冲区的行、1MB单行上限处的UTF-8和UTF-16拆分、跨缓冲区的CRLF、UTF-16大端文件以及跳转到返回的行偏移
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendTextFileReaderTest, "UtilityExtend.File.VerifyTextReader",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendTextFileReaderTest::RunTest(const FString& Parameters)
+{
+    using namespace UtilityExtendTextFileReaderTestsUtils;
+
+    // 读取器的缓冲区为64KB，单行上限为1MB，校验文件按这两个边界构造
+    constexpr int32 BufferBytes = 64 * 1024;
+    constexpr int32 MaxLineBytes = 1024 * 1024;
+
+    const FString Directory = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("UtilityExtend"));
+    TArray<FString> FixturePaths;
+    auto MakeFixturePath = [&Directory, &FixturePaths](const TCHAR* Name)
+    {
+        return FixturePaths.Add_GetRef(Directory / FString::Printf(TEXT("TextReader_%s.txt"), Name));
+    };
+
+    UUtilityExtendTextFileReader* Reader = NewObject<UUtilityExtendTextFileReader>();
+    TArray<FString> Lines;
+    TArray<int64> Offsets;
+
+    // 跨越多个缓冲区的长行，其中的多字节字符落在缓冲区边界上
+    {
+        const FString LongLine = FString::ChrN(40000, TEXT('汉'));
+        TArray<uint8> Bytes;
+        AppendUtf8(Bytes, TEXT("first\n") + LongLine + TEXT("\nlast"));
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(TEXT("LongLine")), Bytes, Lines, Offsets);
+        Check(*this, bRead && Lines.Num() == 3 && Lines[0] == TEXT("first") && Lines[1] == LongLine && Lines[2] == TEXT("last"),
+            TEXT("LineAcrossBuffers"), FString::Printf(TEXT("%d 行"), Lines.Num()));
+        Check(*this, Offsets.Num() == 3 && Offsets[1] == 6 && Offsets[2] == 6 + 40000 * 3 + 1,
+            TEXT("LineAcrossBuffersOffsets"), FString::Printf(TEXT("%d 个偏移"), Offsets.Num()));
+    }
+
+    // 超过单行上限时在多字节字符前拆分：上限正好落在缓冲区边界，以及落在缓冲区中间两种情况
+    for (const int32 PrefixBytes : { 0, 2 })
+    {
+        TArray<uint8> Bytes;
+        if (PrefixBytes > 0)
+        {
+            AppendUtf8(Bytes, TEXT("x\n"));
+        }
+        Bytes.AddUninitialized(MaxLineBytes - 1);
+        FMemory::Memset(Bytes.GetData() + PrefixBytes, 'a', MaxLineBytes - 1);
+        AppendUtf8(Bytes, TEXT("中尾\n"));
+
+        const TCHAR* CaseName = PrefixBytes == 0 ? TEXT("SplitAtCapAligned") : TEXT("SplitAtCapUnaligned");
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(CaseName), Bytes, Lines, Offsets);
+        const int32 First = PrefixBytes > 0 ? 1 : 0;
+        Check(*this, bRead && Lines.Num() == First + 2 && Lines[First].Len() == MaxLineBytes - 1 && Lines[First + 1] == TEXT("中尾")
+            && Offsets[First + 1] == PrefixBytes + MaxLineBytes - 1,
+            CaseName, Lines.Num() > First + 1 ? Lines.Last() : FString::Printf(TEXT("%d 行"), Lines.Num()));
+    }
+
+    // UTF-16文件的单行上限落在代理对的两个字符单元之间时，整个字符留到下一行
+    {
+        constexpr int32 PrefixUnits = MaxLineBytes / 2 - 1;
+        TArray<uint8> Bytes = { 0xFF, 0xFE };
+        Bytes.AddZeroed(PrefixUnits * 2);
+        for (int32 Index = 0; Index < PrefixUnits; ++Index)
+        {
+            Bytes[2 + Index * 2] = 'a';
+        }
+        Bytes.Append({ 0x3D, 0xD8, 0x00, 0xDE, '\n', 0x00 });
+
+        const UTF16CHAR PairUnits[] = { 0xD83D, 0xDE00 };
+        const auto PairConverted = StringCast<TCHAR>(PairUnits, 2);
+        const FString PairText(PairConverted.Length(), PairConverted.Get());
+
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(TEXT("SurrogateAtCap")), Bytes, Lines, Offsets);
+        Check(*this, bRead && Lines.Num() == 2 && Lines[0].Len() == PrefixUnits && Lines[1] == PairText && Offsets[1] == 2 + PrefixUnits * 2,
+            TEXT("SplitAtCapSurrogate"), FString::Printf(TEXT("%d 行"), Lines.Num()));
+    }
+
+    // 回车符在上一块的末尾，换行符在下一块的开头
+    {
+        const FString FirstLine = FString::ChrN(BufferBytes - 1, TEXT('b'));
+        TArray<uint8> Bytes;
+        AppendUtf8(Bytes, FirstLine + TEXT("\r\nnext\r\n"));
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(TEXT("CrlfSplit")), Bytes, Lines, Offsets);
+        Check(*this, bRead && Lines.Num() == 2 && Lines[0] == FirstLine && Lines[1] == TEXT("next") && Offsets[1] == BufferBytes + 1,
+            TEXT("CrlfAcrossBuffers"), FString::Printf(TEXT("%d 行"), Lines.Num()));
+    }
+
+    // 带BOM的UTF-16大端文件，混合CRLF和LF，最后一行没有换行符
+    {
+        TArray<uint8> Bytes = { 0xFE, 0xFF };
+        AppendUtf16BE(Bytes, TEXT("第一行\r\n第二行\nabc"));
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(TEXT("Utf16BE")), Bytes, Lines, Offsets);
+        Check(*this, bRead && Lines.Num() == 3 && Lines[0] == TEXT("第一行") && Lines[1] == TEXT("第二行") && Lines[2] == TEXT("abc"),
+            TEXT("Utf16BE"), Lines.Num() > 0 ? Lines[0] : FString());
+        Check(*this, Offsets.Num() == 3 && Offsets[0] == 2 && Offsets[1] == 12 && Offsets[2] == 20,
+            TEXT("Utf16BEOffsets"), FString::Printf(TEXT("%d 个偏移"), Offsets.Num()));
+
+        FString Line;
+        Check(*this, Offsets.Num() == 3 && Reader->Seek(Offsets[1]) && Reader->ReadLine(Line) && Line == TEXT("第二行"),
+            TEXT("Utf16BESeek"), Line);
+    }
+
+    // 跳转到读取时返回的偏移后读出同一行，包括跨越缓冲区边界的行和最后一行
+    {
+        constexpr int32 LineCount = 20000;
+        TArray<uint8> Bytes;
+        for (int32 Index = 0; Index < LineCount; ++Index)
+        {
+            AppendUtf8(Bytes, FString::Printf(TEXT("行_%05d\n"), Index));
+        }
+
+        const bool bRead = ReadFixture(*this, *Reader, MakeFixturePath(TEXT("Seek")), Bytes, Lines, Offsets);
+        Check(*this, bRead && Lines.Num() == LineCount, TEXT("SeekFixture"), FString::Printf(TEXT("%d 行"), Lines.Num()));
+
+        // 每行10字节，第6553行从65530开始，跨越第一个缓冲区边界
+        for (const int32 Index : { 0, 6553, 12345, LineCount - 1, 3 })
+        {
+            FString Line;
+            const bool bSeeked = Offsets.IsValidIndex(Index) && Reader->Seek(Offsets[Index]) && Reader->ReadLine(Line);
+            Check(*this, bSeeked && Line == Lines[Index], TEXT("SeekToOffset"), FString::Printf(TEXT("第 %d 行: %s"), Index, *Line));
+        }
+    }
+
+    Reader->Close();
+    for (const FString& FixturePath : FixturePaths)
+    {
+        IFileManager::Get().Delete(*FixturePath, false, true, true);
+    }
+
+    return true;
+}
+
+#endif
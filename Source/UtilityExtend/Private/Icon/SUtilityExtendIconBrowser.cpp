@@ -0,0 +1,254 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Icon/SUtilityExtendIconBrowser.h"
+#include "UtilityExtendStyle.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SUtilityExtendIconBrowser"
+
+void SUtilityExtendIconBrowser::Construct(const FArguments& InArgs)
+{
+    TileSize = FMath::Max(16.0f, InArgs._TileSize);
+    SourceDirectory = InArgs._SourceDirectory;
+    OnIconSelected = InArgs._OnIconSelected;
+
+    Catalog = MakeShared<FUtilityExtendIconCatalog>(InArgs._ThumbnailSize);
+    Catalog->OnThumbnailLoaded().AddSP(this, &SUtilityExtendIconBrowser::HandleThumbnailLoaded);
+    IconReloadedHandle = FUtilityExtendStyle::OnIconReloaded().AddSP(this, &SUtilityExtendIconBrowser::HandleIconReloaded);
+
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.0f)
+        [
+            SNew(SSearchBox)
+            .HintText(LOCTEXT("SearchHint", "搜索图标"))
+            .OnTextChanged(this, &SUtilityExtendIconBrowser::OnSearchTextChanged)
+        ]
+        + SVerticalBox::Slot()
+        .FillHeight(1.0f)
+        [
+            SAssignNew(TileView, STileView<TSharedPtr<FUtilityExtendIconCatalogItem>>)
+            .ListItemsSource(&FilteredItems)
+            .ItemWidth(TileSize)
+            .ItemHeight(TileSize + 20.0f)
+            .SelectionMode(ESelectionMode::Single)
+            .OnGenerateTile(this, &SUtilityExtendIconBrowser::OnGenerateTile)
+            .OnRowReleased(this, &SUtilityExtendIconBrowser::OnTileReleased)
+            .OnSelectionChanged(this, &SUtilityExtendIconBrowser::OnSelectionChanged)
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.0f, 2.0f)
+        [
+            SNew(STextBlock)
+            .Text(this, &SUtilityExtendIconBrowser::GetStatusText)
+        ]
+    ];
+
+    RefreshIcons();
+}
+
+SUtilityExtendIconBrowser::~SUtilityExtendIconBrowser()
+{
+    FUtilityExtendStyle::OnIconReloaded().Remove(IconReloadedHandle);
+
+    if (Catalog.IsValid())
+    {
+        Catalog->CancelPendingRequests();
+    }
+}
+
+void SUtilityExtendIconBrowser::RefreshIcons()
+{
+    Catalog->CancelPendingRequests();
+
+    AllItems = SourceDirectory.IsEmpty()
+        ? FUtilityExtendIconCatalog::EnumerateRegisteredIcons()
+        : FUtilityExtendIconCatalog::EnumerateDirectory(SourceDirectory);
+
+    ApplyFilter();
+}
+
+void SUtilityExtendIconBrowser::SetSourceDirectory(const FString& InSourceDirectory)
+{
+    if (SourceDirectory != InSourceDirectory)
+    {
+        SourceDirectory = InSourceDirectory;
+        RefreshIcons();
+    }
+}
+
+void SUtilityExtendIconBrowser::SetFilterText(const FText& InFilterText)
+{
+    const FString NewFilter = InFilterText.ToString().TrimStartAndEnd();
+    if (FilterString != NewFilter)
+    {
+        FilterString = NewFilter;
+        ApplyFilter();
+    }
+}
+
+TSharedPtr<FUtilityExtendIconCatalogItem> SUtilityExtendIconBrowser::GetSelectedIcon() const
+{
+    if (!TileView.IsValid())
+    {
+        return nullptr;
+    }
+
+    TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> SelectedItems = TileView->GetSelectedItems();
+    return SelectedItems.Num() > 0 ? SelectedItems[0] : nullptr;
+}
+
+void SUtilityExtendIconBrowser::ApplyFilter()
+{
+    // 过滤后可见区域会完全变化，之前排队的缩略图请求已经没有意义
+    Catalog->CancelPendingRequests();
+
+    FilteredItems.Reset();
+    if (FilterString.IsEmpty())
+    {
+        FilteredItems = AllItems;
+    }
+    else
+    {
+        for (const TSharedPtr<FUtilityExtendIconCatalogItem>& Item : AllItems)
+        {
+            if (Item->IconInfo.DisplayName.Contains(FilterString)
+                || Item->IconInfo.IconName.ToString().Contains(FilterString)
+                || Item->IconInfo.Description.Contains(FilterString))
+            {
+                FilteredItems.Add(Item);
+            }
+        }
+    }
+
+    if (TileView.IsValid())
+    {
+        TileView->RequestListRefresh();
+    }
+}
+
+TSharedRef<ITableRow> SUtilityExtendIconBrowser::OnGenerateTile(TSharedPtr<FUtilityExtendIconCatalogItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    // 只有进入可见区域的图块才会被生成，缩略图也只在这里请求
+    Catalog->RequestThumbnail(Item);
+
+    const float ImageSize = TileSize - 16.0f;
+    TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem = Item;
+
+    TSharedRef<ITableRow> TableRow = SNew(STableRow<TSharedPtr<FUtilityExtendIconCatalogItem>>, OwnerTable)
+        .Padding(4.0f)
+        .ToolTipText(FText::FromString(Item->IconInfo.Description.IsEmpty() ? Item->IconInfo.DisplayName : Item->IconInfo.Description))
+        [
+            SNew(SVerticalBox)
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .HAlign(HAlign_Center)
+            [
+                SNew(SBox)
+                .WidthOverride(ImageSize)
+                .HeightOverride(ImageSize)
+                [
+                    SNew(SImage)
+                    .Image(this, &SUtilityExtendIconBrowser::GetTileBrush, WeakItem)
+                ]
+            ]
+            + SVerticalBox::Slot()
+            .AutoHeight()
+            .HAlign(HAlign_Center)
+            [
+                SNew(STextBlock)
+                .Text(FText::FromString(Item->IconInfo.DisplayName))
+                .OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+            ]
+        ];
+
+    GeneratedTiles.Add(&TableRow.Get(), WeakItem);
+    return TableRow;
+}
+
+void SUtilityExtendIconBrowser::OnTileReleased(const TSharedRef<ITableRow>& TableRow)
+{
+    TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem;
+    if (GeneratedTiles.RemoveAndCopyValue(&TableRow.Get(), WeakItem) && Catalog.IsValid())
+    {
+        Catalog->CancelThumbnail(WeakItem.Pin());
+    }
+}
+
+void SUtilityExtendIconBrowser::OnSelectionChanged(TSharedPtr<FUtilityExtendIconCatalogItem> Item, ESelectInfo::Type SelectInfo)
+{
+    if (Item.IsValid())
+    {
+        OnIconSelected.ExecuteIfBound(Item);
+    }
+}
+
+void SUtilityExtendIconBrowser::OnSearchTextChanged(const FText& InFilterText)
+{
+    SetFilterText(InFilterText);
+}
+
+const FSlateBrush* SUtilityExtendIconBrowser::GetTileBrush(TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem) const
+{
+    TSharedPtr<FUtilityExtendIconCatalogItem> Item = WeakItem.Pin();
+    if (Item.IsValid())
+    {
+        if (Item->ThumbnailState == EUtilityExtendThumbnailState::Loaded && Item->ThumbnailBrush.IsValid())
+        {
+            return Item->ThumbnailBrush.Get();
+        }
+
+        if (Item->ThumbnailState == EUtilityExtendThumbnailState::Failed)
+        {
+            return FAppStyle::GetBrush("Icons.Error");
+        }
+    }
+
+    return FAppStyle::GetBrush("Icons.Placeholder");
+}
+
+void SUtilityExtendIconBrowser::HandleThumbnailLoaded()
+{
+    // 画刷通过属性绑定读取，这里只需要让列表重绘
+    Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+void SUtilityExtendIconBrowser::HandleIconReloaded(FName IconStyleName)
+{
+    const FString NewFilePath = FUtilityExtendIconCatalog::ResolveIconFilePath(IconStyleName);
+
+    for (const TSharedPtr<FUtilityExtendIconCatalogItem>& Item : AllItems)
+    {
+        if (Item->IconInfo.IconName == IconStyleName)
+        {
+            // 热重载后画刷指向新的缓存副本，重新解码缩略图
+            if (!NewFilePath.IsEmpty())
+            {
+                Item->FilePath = NewFilePath;
+            }
+            const bool bWasRequested = Item->ThumbnailState != EUtilityExtendThumbnailState::NotLoaded;
+            Catalog->InvalidateThumbnail(Item);
+            if (bWasRequested)
+            {
+                Catalog->RequestThumbnail(Item);
+            }
+        }
+    }
+}
+
+FText SUtilityExtendIconBrowser::GetStatusText() const
+{
+    return FText::Format(LOCTEXT("StatusFormat", "{0} / {1} 个图标"), FText::AsNumber(FilteredItems.Num()), FText::AsNumber(AllItems.Num()));
+}
+
+#undef LOCTEXT_NAMESPACE
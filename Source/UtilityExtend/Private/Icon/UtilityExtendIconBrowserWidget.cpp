@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Icon/UtilityExtendIconBrowserWidget.h"
+#include "Icon/SUtilityExtendIconBrowser.h"
+
+#define LOCTEXT_NAMESPACE "UtilityExtendIconBrowserWidget"
+
+TSharedRef<SWidget> UUtilityExtendIconBrowserWidget::RebuildWidget()
+{
+    MyIconBrowser = SNew(SUtilityExtendIconBrowser)
+        .TileSize(TileSize)
+        .ThumbnailSize(ThumbnailSize)
+        .SourceDirectory(SourceDirectory)
+        .OnIconSelected(FOnUtilityExtendIconSelected::CreateUObject(this, &UUtilityExtendIconBrowserWidget::HandleIconSelected));
+
+    return MyIconBrowser.ToSharedRef();
+}
+
+void UUtilityExtendIconBrowserWidget::ReleaseSlateResources(bool bReleaseChildren)
+{
+    Super::ReleaseSlateResources(bReleaseChildren);
+
+    MyIconBrowser.Reset();
+}
+
+#if WITH_EDITOR
+const FText UUtilityExtendIconBrowserWidget::GetPaletteCategory()
+{
+    return LOCTEXT("PaletteCategory", "UtilityExtend");
+}
+#endif
+
+void UUtilityExtendIconBrowserWidget::RefreshIcons()
+{
+    if (MyIconBrowser.IsValid())
+    {
+        MyIconBrowser->RefreshIcons();
+    }
+}
+
+void UUtilityExtendIconBrowserWidget::SetSourceDirectory(const FString& InSourceDirectory)
+{
+    SourceDirectory = InSourceDirectory;
+
+    if (MyIconBrowser.IsValid())
+    {
+        MyIconBrowser->SetSourceDirectory(SourceDirectory);
+    }
+}
+
+void UUtilityExtendIconBrowserWidget::SetFilterText(const FText& InFilterText)
+{
+    if (MyIconBrowser.IsValid())
+    {
+        MyIconBrowser->SetFilterText(InFilterText);
+    }
+}
+
+bool UUtilityExtendIconBrowserWidget::GetSelectedIcon(FToolbarIconInfo& OutIconInfo, FString& OutFilePath) const
+{
+    TSharedPtr<FUtilityExtendIconCatalogItem> Item = MyIconBrowser.IsValid() ? MyIconBrowser->GetSelectedIcon() : nullptr;
+    if (!Item.IsValid())
+    {
+        return false;
+    }
+
+    OutIconInfo = Item->IconInfo;
+    OutFilePath = Item->FilePath;
+    return true;
+}
+
+void UUtilityExtendIconBrowserWidget::HandleIconSelected(TSharedPtr<FUtilityExtendIconCatalogItem> Item)
+{
+    if (Item.IsValid())
+    {
+        OnIconSelected.Broadcast(Item->IconInfo, Item->FilePath);
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
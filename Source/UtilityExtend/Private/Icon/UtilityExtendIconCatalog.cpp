@@ -0,0 +1,340 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Icon/UtilityExtendIconCatalog.h"
+#include "UtilityExtendIconRegistry.h"
+#include "UtilityExtendStyle.h"
+#include "Async/Async.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Brushes/SlateImageBrush.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+namespace UtilityExtendIconCatalogUtils
+{
+    /** 动态纹理名称计数器，保证每个缩略图纹理名称唯一 */
+    static uint32 ThumbnailTextureCounter = 0;
+
+    /** 把BGRA图像按区域平均缩小到不超过MaxSize的尺寸 */
+    void DownscaleBGRA(const TArray64<uint8>& Source, int32 SourceWidth, int32 SourceHeight, int32 MaxSize, TArray<uint8>& OutPixels, int32& OutWidth, int32& OutHeight)
+    {
+        const float Scale = FMath::Min(1.0f, static_cast<float>(MaxSize) / static_cast<float>(FMath::Max(SourceWidth, SourceHeight)));
+        OutWidth = FMath::Max(1, FMath::RoundToInt(SourceWidth * Scale));
+        OutHeight = FMath::Max(1, FMath::RoundToInt(SourceHeight * Scale));
+        OutPixels.SetNumUninitialized(OutWidth * OutHeight * 4);
+
+        for (int32 Y = 0; Y < OutHeight; ++Y)
+        {
+            const int32 SrcY0 = Y * SourceHeight / OutHeight;
+            const int32 SrcY1 = FMath::Max(SrcY0 + 1, (Y + 1) * SourceHeight / OutHeight);
+            for (int32 X = 0; X < OutWidth; ++X)
+            {
+                const int32 SrcX0 = X * SourceWidth / OutWidth;
+                const int32 SrcX1 = FMath::Max(SrcX0 + 1, (X + 1) * SourceWidth / OutWidth);
+
+                uint32 Sum[4] = { 0, 0, 0, 0 };
+                for (int32 SY = SrcY0; SY < SrcY1; ++SY)
+                {
+                    const uint8* Row = Source.GetData() + (static_cast<int64>(SY) * SourceWidth + SrcX0) * 4;
+                    for (int32 SX = SrcX0; SX < SrcX1; ++SX, Row += 4)
+                    {
+                        Sum[0] += Row[0];
+                        Sum[1] += Row[1];
+                        Sum[2] += Row[2];
+                        Sum[3] += Row[3];
+                    }
+                }
+
+                const uint32 Count = static_cast<uint32>((SrcX1 - SrcX0) * (SrcY1 - SrcY0));
+                uint8* Dest = OutPixels.GetData() + (Y * OutWidth + X) * 4;
+                for (int32 Channel = 0; Channel < 4; ++Channel)
+                {
+                    Dest[Channel] = static_cast<uint8>(Sum[Channel] / Count);
+                }
+            }
+        }
+    }
+
+    /** 是否为图标浏览器支持的文件格式 */
+    bool IsSupportedIconFile(const FString& FilePath)
+    {
+        const FString Extension = FPaths::GetExtension(FilePath);
+        return Extension.Equals(TEXT("svg"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("png"), ESearchCase::IgnoreCase);
+    }
+}
+
+FUtilityExtendIconCatalog::FUtilityExtendIconCatalog(int32 InThumbnailSize, int32 InMaxConcurrentDecodes, int32 InMaxPendingRequests)
+    : ThumbnailSize(FMath::Max(8, InThumbnailSize))
+    , MaxConcurrentDecodes(FMath::Max(1, InMaxConcurrentDecodes))
+    , MaxPendingRequests(FMath::Max(1, InMaxPendingRequests))
+    , InFlightDecodes(0)
+    , ImageWrapperModule(nullptr)
+{
+    // 模块必须在游戏线程上加载，后台任务只使用这个指针
+    ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+}
+
+FUtilityExtendIconCatalog::~FUtilityExtendIconCatalog()
+{
+    // 正在进行的解码任务只持有弱引用，目录销毁后其结果会被直接丢弃
+    PendingRequests.Empty();
+}
+
+TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> FUtilityExtendIconCatalog::EnumerateRegisteredIcons()
+{
+    TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> Items;
+
+    const TArray<FToolbarIconInfo> IconInfos = FUtilityExtendIconRegistry::GetAllAvailableIconInfos();
+    Items.Reserve(IconInfos.Num());
+    for (const FToolbarIconInfo& IconInfo : IconInfos)
+    {
+        TSharedPtr<FUtilityExtendIconCatalogItem> Item = MakeShared<FUtilityExtendIconCatalogItem>();
+        Item->IconInfo = IconInfo;
+        Item->FilePath = ResolveIconFilePath(IconInfo.IconName);
+        Items.Add(Item);
+    }
+
+    Items.Sort([](const TSharedPtr<FUtilityExtendIconCatalogItem>& A, const TSharedPtr<FUtilityExtendIconCatalogItem>& B)
+    {
+        return A->IconInfo.DisplayName < B->IconInfo.DisplayName;
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 图标目录枚举到 %d 个已注册图标"), Items.Num());
+    return Items;
+}
+
+TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> FUtilityExtendIconCatalog::EnumerateDirectory(const FString& Directory)
+{
+    TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> Items;
+
+    const FString FullDirectory = FPaths::ConvertRelativePathToFull(Directory);
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *(FullDirectory / TEXT("*.*")), true, false);
+
+    Items.Reserve(FileNames.Num());
+    for (const FString& FileName : FileNames)
+    {
+        if (!UtilityExtendIconCatalogUtils::IsSupportedIconFile(FileName))
+        {
+            continue;
+        }
+
+        TSharedPtr<FUtilityExtendIconCatalogItem> Item = MakeShared<FUtilityExtendIconCatalogItem>();
+        Item->IconInfo.DisplayName = FPaths::GetBaseFilename(FileName);
+        Item->IconInfo.Description = FileName;
+        Item->FilePath = FullDirectory / FileName;
+        Items.Add(Item);
+    }
+
+    Items.Sort([](const TSharedPtr<FUtilityExtendIconCatalogItem>& A, const TSharedPtr<FUtilityExtendIconCatalogItem>& B)
+    {
+        return A->IconInfo.DisplayName < B->IconInfo.DisplayName;
+    });
+
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 图标目录枚举到 %d 个图标文件: %s"), Items.Num(), *FullDirectory);
+    return Items;
+}
+
+FString FUtilityExtendIconCatalog::ResolveIconFilePath(FName IconStyleName)
+{
+    // 样式集中的画刷资源名就是图标文件路径（热重载后指向缓存中的最新副本）
+    const FSlateBrush* Brush = FUtilityExtendStyle::Get().GetOptionalBrush(IconStyleName, nullptr, nullptr);
+    if (!Brush || Brush->GetResourceName() == NAME_None)
+    {
+        return FString();
+    }
+
+    return FPaths::ConvertRelativePathToFull(Brush->GetResourceName().ToString());
+}
+
+void FUtilityExtendIconCatalog::RequestThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item)
+{
+    check(IsInGameThread());
+
+    if (!Item.IsValid() || Item->ThumbnailState != EUtilityExtendThumbnailState::NotLoaded)
+    {
+        return;
+    }
+
+    if (Item->FilePath.IsEmpty())
+    {
+        Item->ThumbnailState = EUtilityExtendThumbnailState::Failed;
+        return;
+    }
+
+    Item->ThumbnailState = EUtilityExtendThumbnailState::Loading;
+    PendingRequests.Add(Item);
+
+    // 超出上限时丢弃最早的请求，这些图块多半已经滚出可见区域，再次生成时会重新请求
+    if (PendingRequests.Num() > MaxPendingRequests)
+    {
+        const int32 DropCount = PendingRequests.Num() - MaxPendingRequests;
+        for (int32 Index = 0; Index < DropCount; ++Index)
+        {
+            if (TSharedPtr<FUtilityExtendIconCatalogItem> DroppedItem = PendingRequests[Index].Pin())
+            {
+                DroppedItem->ThumbnailState = EUtilityExtendThumbnailState::NotLoaded;
+            }
+        }
+        PendingRequests.RemoveAt(0, DropCount, EAllowShrinking::No);
+    }
+
+    PumpQueue();
+}
+
+void FUtilityExtendIconCatalog::CancelThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item)
+{
+    if (!Item.IsValid() || Item->ThumbnailState != EUtilityExtendThumbnailState::Loading)
+    {
+        return;
+    }
+
+    // 只移除仍在排队的请求，正在解码的结果照常使用
+    const int32 RemovedCount = PendingRequests.RemoveAll([&Item](const TWeakPtr<FUtilityExtendIconCatalogItem>& WeakItem)
+    {
+        return WeakItem.HasSameObject(Item.Get());
+    });
+    if (RemovedCount > 0)
+    {
+        Item->ThumbnailState = EUtilityExtendThumbnailState::NotLoaded;
+    }
+}
+
+void FUtilityExtendIconCatalog::InvalidateThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item)
+{
+    if (!Item.IsValid())
+    {
+        return;
+    }
+
+    // 递增代数后，仍在路上的旧解码结果会在完成时被丢弃
+    ++Item->LoadGeneration;
+    Item->ThumbnailBrush.Reset();
+    Item->ThumbnailState = EUtilityExtendThumbnailState::NotLoaded;
+}
+
+void FUtilityExtendIconCatalog::CancelPendingRequests()
+{
+    for (const TWeakPtr<FUtilityExtendIconCatalogItem>& WeakItem : PendingRequests)
+    {
+        if (TSharedPtr<FUtilityExtendIconCatalogItem> Item = WeakItem.Pin())
+        {
+            Item->ThumbnailState = EUtilityExtendThumbnailState::NotLoaded;
+        }
+    }
+    PendingRequests.Empty();
+}
+
+void FUtilityExtendIconCatalog::PumpQueue()
+{
+    while (InFlightDecodes < MaxConcurrentDecodes && PendingRequests.Num() > 0)
+    {
+        // 后进先出：最后请求的一般是当前可见的图标
+        TSharedPtr<FUtilityExtendIconCatalogItem> Item = PendingRequests.Pop(EAllowShrinking::No).Pin();
+        if (!Item.IsValid() || Item->ThumbnailState != EUtilityExtendThumbnailState::Loading)
+        {
+            continue;
+        }
+
+        ++InFlightDecodes;
+
+        TWeakPtr<FUtilityExtendIconCatalog> WeakCatalog = AsShared();
+        TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem = Item;
+        const int32 Generation = Item->LoadGeneration;
+        const FString FilePath = Item->FilePath;
+        const int32 Size = ThumbnailSize;
+        IImageWrapperModule* WrapperModule = ImageWrapperModule;
+
+        Async(EAsyncExecution::ThreadPool, [WeakCatalog, WeakItem, Generation, FilePath, Size, WrapperModule]()
+        {
+            FDecodedThumbnail Decoded = DecodeThumbnail(WrapperModule, FilePath, Size);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakCatalog, WeakItem, Generation, Decoded = MoveTemp(Decoded)]() mutable
+            {
+                if (TSharedPtr<FUtilityExtendIconCatalog> Catalog = WeakCatalog.Pin())
+                {
+                    Catalog->FinishThumbnail(WeakItem, Generation, MoveTemp(Decoded));
+                }
+            });
+        });
+    }
+}
+
+FUtilityExtendIconCatalog::FDecodedThumbnail FUtilityExtendIconCatalog::DecodeThumbnail(IImageWrapperModule* WrapperModule, const FString& FilePath, int32 Size)
+{
+    FDecodedThumbnail Result;
+
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent) || FileData.Num() == 0)
+    {
+        return Result;
+    }
+
+    if (FPaths::GetExtension(FilePath).Equals(TEXT("svg"), ESearchCase::IgnoreCase))
+    {
+        // SVG由Slate渲染器按显示尺寸栅格化，这里只确认文件可读且确实是SVG
+        const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(FileData.GetData()), FileData.Num());
+        const FString Content(Converted.Length(), Converted.Get());
+        Result.bIsVector = true;
+        Result.bSuccess = Content.Contains(TEXT("<svg"), ESearchCase::IgnoreCase);
+        return Result;
+    }
+
+    if (!WrapperModule)
+    {
+        return Result;
+    }
+
+    const EImageFormat ImageFormat = WrapperModule->DetectImageFormat(FileData.GetData(), FileData.Num());
+    if (ImageFormat == EImageFormat::Invalid)
+    {
+        return Result;
+    }
+
+    TSharedPtr<IImageWrapper> ImageWrapper = WrapperModule->CreateImageWrapper(ImageFormat);
+    TArray64<uint8> RawData;
+    if (!ImageWrapper.IsValid()
+        || !ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num())
+        || !ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+    {
+        return Result;
+    }
+
+    UtilityExtendIconCatalogUtils::DownscaleBGRA(RawData, static_cast<int32>(ImageWrapper->GetWidth()), static_cast<int32>(ImageWrapper->GetHeight()),
+        Size, Result.BGRA, Result.Width, Result.Height);
+    Result.bSuccess = true;
+    return Result;
+}
+
+void FUtilityExtendIconCatalog::FinishThumbnail(TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem, int32 Generation, FDecodedThumbnail&& Decoded)
+{
+    --InFlightDecodes;
+
+    TSharedPtr<FUtilityExtendIconCatalogItem> Item = WeakItem.Pin();
+    if (Item.IsValid() && Item->LoadGeneration == Generation && Item->ThumbnailState == EUtilityExtendThumbnailState::Loading)
+    {
+        if (!Decoded.bSuccess)
+        {
+            Item->ThumbnailState = EUtilityExtendThumbnailState::Failed;
+            UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 缩略图解码失败: %s"), *Item->FilePath);
+        }
+        else if (Decoded.bIsVector)
+        {
+            Item->ThumbnailBrush = MakeShared<FSlateVectorImageBrush>(Item->FilePath, FVector2D(ThumbnailSize, ThumbnailSize));
+            Item->ThumbnailState = EUtilityExtendThumbnailState::Loaded;
+        }
+        else
+        {
+            const FName TextureName(*FString::Printf(TEXT("UtilityExtendIconThumb_%u"), ++UtilityExtendIconCatalogUtils::ThumbnailTextureCounter));
+            Item->ThumbnailBrush = FSlateDynamicImageBrush::CreateWithImageData(TextureName, FVector2D(Decoded.Width, Decoded.Height), Decoded.BGRA);
+            Item->ThumbnailState = Item->ThumbnailBrush.IsValid() ? EUtilityExtendThumbnailState::Loaded : EUtilityExtendThumbnailState::Failed;
+        }
+
+        ThumbnailLoadedEvent.Broadcast();
+    }
+
+    PumpQueue();
+}
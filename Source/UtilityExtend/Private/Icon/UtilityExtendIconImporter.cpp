@@ -0,0 +1,617 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Icon/UtilityExtendIconImporter.h"
+#include "UtilityExtendIconRegistry.h"
+#include "UtilityExtendStyle.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Interfaces/IPluginManager.h"
+#include "Internationalization/Regex.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include <atomic>
+
+bool FUtilityExtendIconImporter::bImportInProgress = false;
+
+namespace UtilityExtendIconImporterUtils
+{
+    /** 导入任务在线程间共享的进度 */
+    struct FImportProgress
+    {
+        std::atomic<int32> Processed{ 0 };
+        int32 Total = 0;
+    };
+
+    /** 插件Resources目录 */
+    FString GetResourcesDir()
+    {
+        TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UtilityExtend"));
+        return Plugin.IsValid() ? FPaths::ConvertRelativePathToFull(Plugin->GetBaseDir() / TEXT("Resources")) : FString();
+    }
+
+    /** 插件源码目录（二进制发布的插件没有源码时返回的路径不存在） */
+    FString GetPrivateSourceDir()
+    {
+        TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UtilityExtend"));
+        return Plugin.IsValid() ? FPaths::ConvertRelativePathToFull(Plugin->GetBaseDir() / TEXT("Source") / TEXT("UtilityExtend") / TEXT("Private")) : FString();
+    }
+
+    bool IsSupportedExtension(const FString& Extension)
+    {
+        return Extension == TEXT("svg") || Extension == TEXT("png");
+    }
+
+    FSHAHash HashBytes(const TArray<uint8>& Data)
+    {
+        FSHAHash Hash;
+        FSHA1::HashBuffer(Data.GetData(), Data.Num(), Hash.Hash);
+        return Hash;
+    }
+
+    /** 删除所有匹配正则的片段，返回删除的数量 */
+    int32 RemoveAllMatches(FString& Text, const TCHAR* Pattern)
+    {
+        const FRegexPattern RegexPattern(Pattern);
+        FRegexMatcher Matcher(RegexPattern, Text);
+
+        FString Result;
+        int32 CopyFrom = 0;
+        int32 RemovedCount = 0;
+        while (Matcher.FindNext())
+        {
+            Result.Append(*Text + CopyFrom, Matcher.GetMatchBeginning() - CopyFrom);
+            CopyFrom = Matcher.GetMatchEnding();
+            ++RemovedCount;
+        }
+
+        if (RemovedCount > 0)
+        {
+            Result.Append(*Text + CopyFrom, Text.Len() - CopyFrom);
+            Text = MoveTemp(Result);
+        }
+        return RemovedCount;
+    }
+
+    /** 解析SVG长度属性，只接受无单位或px的正数 */
+    bool ParseSvgLength(const FString& Value, float& OutLength)
+    {
+        FString Number = Value.TrimStartAndEnd();
+        Number.RemoveFromEnd(TEXT("px"), ESearchCase::IgnoreCase);
+        if (Number.IsEmpty() || !FCString::IsNumeric(*Number))
+        {
+            return false;
+        }
+
+        OutLength = FCString::Atof(*Number);
+        return OutLength > 0.0f;
+    }
+
+    /** 去掉属性值两侧的引号 */
+    FString UnquoteAttribute(const FString& QuotedValue)
+    {
+        return QuotedValue.Len() >= 2 ? QuotedValue.Mid(1, QuotedValue.Len() - 2) : QuotedValue;
+    }
+}
+
+bool FUtilityExtendIconImporter::IsImportInProgress()
+{
+    return bImportInProgress;
+}
+
+TArray<FString> FUtilityExtendIconImporter::CollectIconFiles(const FString& Directory, bool bRecursive)
+{
+    TArray<FString> Files;
+    const FString FullDirectory = FPaths::IsRelative(Directory)
+        ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory)
+        : Directory;
+
+    if (bRecursive)
+    {
+        IFileManager::Get().FindFilesRecursive(Files, *FullDirectory, TEXT("*.*"), true, false);
+    }
+    else
+    {
+        IFileManager::Get().FindFiles(Files, *(FullDirectory / TEXT("*.*")), true, false);
+        for (FString& File : Files)
+        {
+            File = FullDirectory / File;
+        }
+    }
+
+    Files.RemoveAll([](const FString& File)
+    {
+        return !UtilityExtendIconImporterUtils::IsSupportedExtension(FPaths::GetExtension(File).ToLower());
+    });
+    Files.Sort();
+    return Files;
+}
+
+bool FUtilityExtendIconImporter::ImportFiles(const TArray<FString>& SourceFiles, const FUtilityExtendIconImportOptions& Options, FOnImportFinished OnFinished)
+{
+    using namespace UtilityExtendIconImporterUtils;
+    check(IsInGameThread());
+
+    if (bImportInProgress)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 已有图标导入任务正在进行"));
+        return false;
+    }
+
+    const FString ResourcesDir = GetResourcesDir();
+    if (ResourcesDir.IsEmpty() || SourceFiles.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 没有可导入的图标文件或找不到插件Resources目录"));
+        return false;
+    }
+
+    bImportInProgress = true;
+
+    // 已注册的图标名称只能在游戏线程上读取，这里先做一份快照给工作线程使用
+    TSet<FString> ReservedNames;
+    for (const FToolbarIconInfo& IconInfo : FUtilityExtendIconRegistry::GetAllAvailableIconInfos())
+    {
+        ReservedNames.Add(IconInfo.IconName.ToString());
+    }
+
+    TSharedRef<FImportProgress, ESPMode::ThreadSafe> Progress = MakeShared<FImportProgress, ESPMode::ThreadSafe>();
+    Progress->Total = SourceFiles.Num();
+
+    // 整个批次只使用一个通知，文本通过属性绑定实时读取进度
+    FNotificationInfo Info(TAttribute<FText>::CreateLambda([Progress]()
+    {
+        return FText::FromString(FString::Printf(TEXT("正在导入图标 (%d/%d)"), Progress->Processed.load(), Progress->Total));
+    }));
+    Info.bFireAndForget = false;
+    Info.bUseThrobber = true;
+    Info.bUseSuccessFailIcons = true;
+    TWeakPtr<SNotificationItem> WeakNotification = FSlateNotificationManager::Get().AddNotification(Info);
+    if (TSharedPtr<SNotificationItem> Notification = WeakNotification.Pin())
+    {
+        Notification->SetCompletionState(SNotificationItem::CS_Pending);
+    }
+
+    IImageWrapperModule* ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+    Async(EAsyncExecution::ThreadPool, [SourceFiles, Options, ResourcesDir, ReservedNames = MoveTemp(ReservedNames), Progress, ImageWrapperModule, WeakNotification, OnFinished = MoveTemp(OnFinished)]() mutable
+    {
+        TArray<FPreparedIcon> Icons;
+        Icons.SetNum(SourceFiles.Num());
+        for (int32 Index = 0; Index < SourceFiles.Num(); ++Index)
+        {
+            Icons[Index].SourceFile = SourceFiles[Index];
+        }
+
+        // 校验、清理与规范化互不依赖，按文件并行处理
+        ParallelFor(Icons.Num(), [&Icons, &Options, ImageWrapperModule, &Progress](int32 Index)
+        {
+            PrepareIcon(Icons[Index], Options, ImageWrapperModule);
+            ++Progress->Processed;
+        });
+
+        // 计算Resources目录中已有图标的哈希，用于与导入文件去重
+        TArray<FString> ExistingFiles;
+        IFileManager::Get().FindFiles(ExistingFiles, *(ResourcesDir / TEXT("*.*")), true, false);
+        ExistingFiles.RemoveAll([](const FString& File)
+        {
+            return !IsSupportedExtension(FPaths::GetExtension(File).ToLower());
+        });
+
+        TArray<FSHAHash> ExistingHashes;
+        ExistingHashes.SetNum(ExistingFiles.Num());
+        ParallelFor(ExistingFiles.Num(), [&ExistingFiles, &ExistingHashes, &ResourcesDir](int32 Index)
+        {
+            TArray<uint8> Data;
+            if (FFileHelper::LoadFileToArray(Data, *(ResourcesDir / ExistingFiles[Index]), FILEREAD_Silent))
+            {
+                ExistingHashes[Index] = HashBytes(Data);
+            }
+        });
+
+        TMap<FSHAHash, FString> KnownHashes;
+        TSet<FString> TakenFileNames;
+        for (int32 Index = 0; Index < ExistingFiles.Num(); ++Index)
+        {
+            KnownHashes.Add(ExistingHashes[Index], ExistingFiles[Index]);
+            TakenFileNames.Add(FPaths::GetBaseFilename(ExistingFiles[Index]));
+        }
+
+        // 去重和命名需要看到前面的结果，按顺序处理
+        for (FPreparedIcon& Icon : Icons)
+        {
+            if (!Icon.Error.IsEmpty())
+            {
+                continue;
+            }
+
+            const FString* Existing = KnownHashes.Find(Icon.DataHash);
+            if (!Existing)
+            {
+                Existing = KnownHashes.Find(Icon.SourceHash);
+            }
+            if (Existing)
+            {
+                Icon.DuplicateOf = *Existing;
+                continue;
+            }
+
+            const FString BaseName = Icon.FileBaseName;
+            for (int32 Suffix = 2; TakenFileNames.Contains(Icon.FileBaseName) || ReservedNames.Contains(TEXT("UtilityExtend.") + Icon.FileBaseName); ++Suffix)
+            {
+                Icon.FileBaseName = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+            }
+
+            const FString TargetFileName = Icon.FileBaseName + TEXT(".") + Icon.Extension;
+            if (!FFileHelper::SaveArrayToFile(Icon.Data, *(ResourcesDir / TargetFileName)))
+            {
+                Icon.Error = FString::Printf(TEXT("无法写入文件: %s"), *TargetFileName);
+                continue;
+            }
+
+            TakenFileNames.Add(Icon.FileBaseName);
+            KnownHashes.Add(Icon.DataHash, TargetFileName);
+            KnownHashes.Add(Icon.SourceHash, TargetFileName);
+            Icon.Data.Empty();
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [Icons = MoveTemp(Icons), Options, ResourcesDir, WeakNotification, OnFinished = MoveTemp(OnFinished)]()
+        {
+            FUtilityExtendIconImportResult Result;
+            TArray<TPair<FName, FString>> BrushFiles;
+            TArray<FToolbarIconInfo> IconInfos;
+            TArray<FString> StyleLines;
+            TArray<FString> RegistryLines;
+
+            for (const FPreparedIcon& Icon : Icons)
+            {
+                if (!Icon.Error.IsEmpty())
+                {
+                    Result.FailedFiles.Add(Icon.SourceFile);
+                    Result.FailureReasons.Add(Icon.Error);
+                    UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 图标导入失败: %s (%s)"), *Icon.SourceFile, *Icon.Error);
+                    continue;
+                }
+
+                if (!Icon.DuplicateOf.IsEmpty())
+                {
+                    Result.DuplicateFiles.Add(Icon.SourceFile);
+                    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 图标内容与已有文件相同，跳过: %s -> %s"), *Icon.SourceFile, *Icon.DuplicateOf);
+                    continue;
+                }
+
+                const FString StyleName = TEXT("UtilityExtend.") + Icon.FileBaseName;
+                FString DisplayName = FPaths::GetBaseFilename(Icon.SourceFile);
+                DisplayName.ReplaceInline(TEXT("\""), TEXT(""));
+                DisplayName.ReplaceInline(TEXT("\\"), TEXT(""));
+
+                BrushFiles.Emplace(FName(*StyleName), ResourcesDir / (Icon.FileBaseName + TEXT(".") + Icon.Extension));
+                IconInfos.Add(FToolbarIconInfo(FName(*StyleName), DisplayName, TEXT("导入的图标")));
+                Result.ImportedIconNames.Add(StyleName);
+
+                StyleLines.Add(FString::Printf(TEXT("    Style->Set(\"%s\", new %s(TEXT(\"%s\"), FVector2D(%d.0f, %d.0f)));"),
+                    *StyleName, Icon.Extension == TEXT("svg") ? TEXT("IMAGE_BRUSH_SVG") : TEXT("IMAGE_BRUSH"),
+                    *Icon.FileBaseName, Options.TargetIconSize, Options.TargetIconSize));
+                RegistryLines.Add(FString::Printf(TEXT("    IconInfos.Add(FToolbarIconInfo(TEXT(\"%s\"), TEXT(\"%s\"), TEXT(\"导入的图标\")));"),
+                    *StyleName, *DisplayName));
+            }
+
+            // 所有新图标一次性注册，只触发一次样式与注册表更新
+            if (IconInfos.Num() > 0)
+            {
+                FUtilityExtendStyle::RegisterIconBrushes(BrushFiles, FVector2D(Options.TargetIconSize, Options.TargetIconSize));
+                FUtilityExtendIconRegistry::RegisterIcons(IconInfos);
+
+                if (Options.bWriteRegistrationSource)
+                {
+                    const FString SourceDir = UtilityExtendIconImporterUtils::GetPrivateSourceDir();
+                    Result.bSourceUpdated = AppendCustomIconLines(SourceDir / TEXT("UtilityExtendStyle.cpp"), StyleLines)
+                        && AppendCustomIconLines(SourceDir / TEXT("UtilityExtendIconRegistry.cpp"), RegistryLines);
+                }
+            }
+
+            const FString Summary = FString::Printf(TEXT("图标导入完成：成功 %d，重复 %d，失败 %d"),
+                Result.ImportedIconNames.Num(), Result.DuplicateFiles.Num(), Result.FailedFiles.Num());
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: %s"), *Summary);
+
+            if (TSharedPtr<SNotificationItem> Notification = WeakNotification.Pin())
+            {
+                Notification->SetText(FText::FromString(Summary));
+                Notification->SetCompletionState(Result.FailedFiles.Num() == 0 ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+                Notification->ExpireAndFadeout();
+            }
+
+            bImportInProgress = false;
+
+            if (OnFinished)
+            {
+                OnFinished(Result);
+            }
+        });
+    });
+
+    return true;
+}
+
+void FUtilityExtendIconImporter::PrepareIcon(FPreparedIcon& Icon, const FUtilityExtendIconImportOptions& Options, IImageWrapperModule* ImageWrapperModule)
+{
+    using namespace UtilityExtendIconImporterUtils;
+
+    Icon.Extension = FPaths::GetExtension(Icon.SourceFile).ToLower();
+    if (!IsSupportedExtension(Icon.Extension))
+    {
+        Icon.Error = TEXT("只支持SVG和PNG文件");
+        return;
+    }
+
+    const int64 FileSize = IFileManager::Get().FileSize(*Icon.SourceFile);
+    if (FileSize <= 0)
+    {
+        Icon.Error = TEXT("文件不存在或为空");
+        return;
+    }
+    if (FileSize > Options.MaxFileSizeBytes)
+    {
+        Icon.Error = FString::Printf(TEXT("文件过大 (%lld 字节，上限 %lld 字节)"), FileSize, Options.MaxFileSizeBytes);
+        return;
+    }
+
+    TArray<uint8> SourceData;
+    if (!FFileHelper::LoadFileToArray(SourceData, *Icon.SourceFile, FILEREAD_Silent))
+    {
+        Icon.Error = TEXT("无法读取文件");
+        return;
+    }
+    Icon.SourceHash = HashBytes(SourceData);
+
+    if (Icon.Extension == TEXT("svg"))
+    {
+        FString Svg;
+        FFileHelper::BufferToString(Svg, SourceData.GetData(), SourceData.Num());
+
+        if (!SanitizeSvg(Svg, Icon.Error) || !NormalizeSvgRoot(Svg, Options.TargetIconSize, Icon.Error))
+        {
+            return;
+        }
+
+        const FTCHARToUTF8 Utf8(*Svg);
+        Icon.Data.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+    else
+    {
+        if (!ValidateRaster(SourceData, Options.MaxRasterDimension, ImageWrapperModule, Icon.Error))
+        {
+            return;
+        }
+        Icon.Data = MoveTemp(SourceData);
+    }
+
+    Icon.DataHash = HashBytes(Icon.Data);
+    Icon.FileBaseName = MakeIconBaseName(Icon.SourceFile);
+}
+
+bool FUtilityExtendIconImporter::SanitizeSvg(FString& Svg, FString& OutError)
+{
+    using namespace UtilityExtendIconImporterUtils;
+
+    // DTD实体可以引用外部文件或造成实体膨胀，直接拒绝
+    if (Svg.Contains(TEXT("<!ENTITY"), ESearchCase::IgnoreCase))
+    {
+        OutError = TEXT("SVG包含DTD实体定义");
+        return false;
+    }
+
+    RemoveAllMatches(Svg, TEXT("<!--[\\s\\S]*?-->"));
+    RemoveAllMatches(Svg, TEXT("(?i)<!DOCTYPE[^>]*>"));
+
+    int32 RemovedCount = 0;
+    RemovedCount += RemoveAllMatches(Svg, TEXT("(?i)<script\\b[\\s\\S]*?</script\\s*>|<script\\b[^>]*/>"));
+    RemovedCount += RemoveAllMatches(Svg, TEXT("(?i)<foreignObject\\b[\\s\\S]*?</foreignObject\\s*>|<foreignObject\\b[^>]*/>"));
+    RemovedCount += RemoveAllMatches(Svg, TEXT("(?i)\\s+on[a-z]+\\s*=\\s*(\"[^\"]*\"|'[^']*')"));
+
+    // 只保留文档内引用和内嵌图片，外部链接在编辑器里既无法加载也不安全
+    RemovedCount += RemoveAllMatches(Svg, TEXT("(?i)\\s+(?:xlink:)?href\\s*=\\s*([\"'])(?!\\s*#|\\s*data:image/)[^\"']*\\1"));
+
+    if (RemovedCount > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: SVG已移除 %d 处不安全内容"), RemovedCount);
+    }
+
+    Svg.TrimStartAndEndInline();
+    if (Svg.IsEmpty())
+    {
+        OutError = TEXT("SVG内容为空");
+        return false;
+    }
+    return true;
+}
+
+bool FUtilityExtendIconImporter::NormalizeSvgRoot(FString& Svg, int32 TargetSize, FString& OutError)
+{
+    using namespace UtilityExtendIconImporterUtils;
+
+    const FRegexPattern RootPattern(TEXT("(?i)<svg\\b([^>]*)>"));
+    FRegexMatcher RootMatcher(RootPattern, Svg);
+    if (!RootMatcher.FindNext())
+    {
+        OutError = TEXT("缺少<svg>根节点");
+        return false;
+    }
+
+    const int32 RootBegin = RootMatcher.GetMatchBeginning();
+    const int32 RootEnd = RootMatcher.GetMatchEnding();
+    const FString AttributeText = RootMatcher.GetCaptureGroup(1);
+    if (AttributeText.TrimEnd().EndsWith(TEXT("/")))
+    {
+        OutError = TEXT("SVG没有任何内容");
+        return false;
+    }
+
+    // 保留除尺寸以外的所有根节点属性，并记录原始尺寸
+    TArray<FString> KeptAttributes;
+    FString Width;
+    FString Height;
+    FString ViewBox;
+    bool bHasNamespace = false;
+
+    const FRegexPattern AttributePattern(TEXT("([A-Za-z_:][-A-Za-z0-9_:.]*)\\s*=\\s*(\"[^\"]*\"|'[^']*')"));
+    FRegexMatcher AttributeMatcher(AttributePattern, AttributeText);
+    while (AttributeMatcher.FindNext())
+    {
+        const FString Name = AttributeMatcher.GetCaptureGroup(1);
+        const FString Value = AttributeMatcher.GetCaptureGroup(2);
+
+        if (Name.Equals(TEXT("width"), ESearchCase::IgnoreCase))
+        {
+            Width = UnquoteAttribute(Value);
+        }
+        else if (Name.Equals(TEXT("height"), ESearchCase::IgnoreCase))
+        {
+            Height = UnquoteAttribute(Value);
+        }
+        else if (Name.Equals(TEXT("viewBox"), ESearchCase::IgnoreCase))
+        {
+            ViewBox = UnquoteAttribute(Value);
+        }
+        else
+        {
+            bHasNamespace |= Name == TEXT("xmlns");
+            KeptAttributes.Add(Name + TEXT("=") + Value);
+        }
+    }
+
+    if (ViewBox.IsEmpty())
+    {
+        // 没有viewBox时由原始宽高推导，否则缩放到目标尺寸后图形会被裁剪
+        float WidthValue = 0.0f;
+        float HeightValue = 0.0f;
+        if (!ParseSvgLength(Width, WidthValue) || !ParseSvgLength(Height, HeightValue))
+        {
+            OutError = TEXT("SVG缺少viewBox且宽高不是有效的像素值");
+            return false;
+        }
+        ViewBox = FString::Printf(TEXT("0 0 %s %s"), *FString::SanitizeFloat(WidthValue), *FString::SanitizeFloat(HeightValue));
+    }
+    else
+    {
+        TArray<FString> ViewBoxParts;
+        ViewBox.Replace(TEXT(","), TEXT(" ")).ParseIntoArrayWS(ViewBoxParts);
+        if (ViewBoxParts.Num() != 4 || FCString::Atof(*ViewBoxParts[2]) <= 0.0f || FCString::Atof(*ViewBoxParts[3]) <= 0.0f)
+        {
+            OutError = FString::Printf(TEXT("无效的viewBox: %s"), *ViewBox);
+            return false;
+        }
+        ViewBox = FString::Join(ViewBoxParts, TEXT(" "));
+    }
+
+    FString NewRoot = TEXT("<svg");
+    if (!bHasNamespace)
+    {
+        NewRoot += TEXT(" xmlns=\"http://www.w3.org/2000/svg\"");
+    }
+    for (const FString& Attribute : KeptAttributes)
+    {
+        NewRoot += TEXT(" ") + Attribute;
+    }
+    NewRoot += FString::Printf(TEXT(" viewBox=\"%s\" width=\"%d\" height=\"%d\">"), *ViewBox, TargetSize, TargetSize);
+
+    Svg = Svg.Left(RootBegin) + NewRoot + Svg.Mid(RootEnd);
+    return true;
+}
+
+bool FUtilityExtendIconImporter::ValidateRaster(const TArray<uint8>& Data, int32 MaxDimension, IImageWrapperModule* ImageWrapperModule, FString& OutError)
+{
+    if (ImageWrapperModule->DetectImageFormat(Data.GetData(), Data.Num()) != EImageFormat::PNG)
+    {
+        OutError = TEXT("文件内容不是有效的PNG图片");
+        return false;
+    }
+
+    // 只解析文件头即可拿到尺寸，不需要解码像素
+    TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+    if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(Data.GetData(), Data.Num()))
+    {
+        OutError = TEXT("PNG文件已损坏");
+        return false;
+    }
+
+    const int64 Width = ImageWrapper->GetWidth();
+    const int64 Height = ImageWrapper->GetHeight();
+    if (Width <= 0 || Height <= 0 || Width > MaxDimension || Height > MaxDimension)
+    {
+        OutError = FString::Printf(TEXT("PNG尺寸 %lldx%lld 超出范围（上限 %d）"), Width, Height, MaxDimension);
+        return false;
+    }
+    return true;
+}
+
+FString FUtilityExtendIconImporter::MakeIconBaseName(const FString& SourceFile)
+{
+    // 名称会直接写入样式代码和文件名，只保留ASCII字母、数字和下划线
+    FString BaseName;
+    for (const TCHAR Char : FPaths::GetBaseFilename(SourceFile))
+    {
+        const bool bValidChar = (Char >= TEXT('a') && Char <= TEXT('z'))
+            || (Char >= TEXT('A') && Char <= TEXT('Z'))
+            || (Char >= TEXT('0') && Char <= TEXT('9'));
+        if (bValidChar)
+        {
+            BaseName.AppendChar(Char);
+        }
+        else if (!BaseName.EndsWith(TEXT("_")))
+        {
+            BaseName.AppendChar(TEXT('_'));
+        }
+    }
+
+    BaseName.RemoveFromEnd(TEXT("_"));
+    if (BaseName.IsEmpty() || BaseName == TEXT("_") || FChar::IsDigit(BaseName[0]))
+    {
+        BaseName = TEXT("Icon") + BaseName;
+    }
+    return BaseName;
+}
+
+bool FUtilityExtendIconImporter::AppendCustomIconLines(const FString& SourceFilePath, const TArray<FString>& Lines)
+{
+    FString Content;
+    if (!FFileHelper::LoadFileToString(Content, *SourceFilePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 找不到插件源文件，图标只在本次会话中可用: %s"), *SourceFilePath);
+        return false;
+    }
+
+    const int32 EndMarker = Content.Find(TEXT("// </custom_icon>"));
+    if (EndMarker == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 源文件中没有<custom_icon>代码块: %s"), *SourceFilePath);
+        return false;
+    }
+
+    // 与IconRegTool保持一致：插在结束标记所在行之前，沿用文件原有的换行符
+    const FString LineTerminator = Content.Contains(TEXT("\r\n")) ? TEXT("\r\n") : TEXT("\n");
+    int32 LineStart = EndMarker;
+    while (LineStart > 0 && Content[LineStart - 1] != TEXT('\n'))
+    {
+        --LineStart;
+    }
+
+    FString Insertion;
+    for (const FString& Line : Lines)
+    {
+        Insertion += Line + LineTerminator;
+    }
+    Content.InsertAt(LineStart, Insertion);
+
+    // 这两个文件以UTF-16保存，IconRegTool按该编码读写
+    if (!FFileHelper::SaveStringToFile(Content, *SourceFilePath, FFileHelper::EEncodingOptions::ForceUnicode))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法写入插件源文件: %s"), *SourceFilePath);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,228 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/SUtilityExtendNotificationHistory.h"
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Docking/TabManager.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SUtilityExtendNotificationHistory"
+
+const FName SUtilityExtendNotificationHistory::TabId(TEXT("UtilityExtendNotificationHistory"));
+
+namespace SUtilityExtendNotificationHistoryUtils
+{
+	/** 列表刷新检查间隔（秒） */
+	constexpr float RefreshInterval = 0.5f;
+
+	/** 通知类型的显示文本 */
+	FText GetTypeText(EEditorNotificationType Type)
+	{
+		switch (Type)
+		{
+		case EEditorNotificationType::Success:
+			return LOCTEXT("TypeSuccess", "成功");
+		case EEditorNotificationType::Error:
+			return LOCTEXT("TypeError", "错误");
+		default:
+			return LOCTEXT("TypeDefault", "默认");
+		}
+	}
+
+	/** 通知类型的显示颜色 */
+	FSlateColor GetTypeColor(EEditorNotificationType Type)
+	{
+		switch (Type)
+		{
+		case EEditorNotificationType::Success:
+			return FSlateColor(FLinearColor(0.2f, 0.8f, 0.2f));
+		case EEditorNotificationType::Error:
+			return FSlateColor(FLinearColor(0.9f, 0.2f, 0.2f));
+		default:
+			return FSlateColor::UseForeground();
+		}
+	}
+}
+
+void SUtilityExtendNotificationHistory::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("SearchHint", "搜索内容或来源"))
+				.OnTextChanged(this, &SUtilityExtendNotificationHistory::OnSearchTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("Clear", "清空"))
+				.OnClicked(this, &SUtilityExtendNotificationHistory::OnClearClicked)
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FUtilityNotificationRecord>>)
+			.ListItemsSource(&Records)
+			.SelectionMode(ESelectionMode::Single)
+			.OnGenerateRow(this, &SUtilityExtendNotificationHistory::OnGenerateRow)
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.0f, 2.0f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SUtilityExtendNotificationHistory::GetStatusText)
+		]
+	];
+
+	RefreshRecords();
+	RegisterActiveTimer(SUtilityExtendNotificationHistoryUtils::RefreshInterval,
+		FWidgetActiveTimerDelegate::CreateSP(this, &SUtilityExtendNotificationHistory::RefreshIfChanged));
+}
+
+void SUtilityExtendNotificationHistory::RegisterTabSpawner()
+{
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabId, FOnSpawnTab::CreateStatic(&SUtilityExtendNotificationHistory::SpawnTab))
+		.SetDisplayName(LOCTEXT("TabTitle", "通知历史"))
+		.SetTooltipText(LOCTEXT("TabTooltip", "查看UtilityExtend最近发出的编辑器通知"));
+}
+
+void SUtilityExtendNotificationHistory::UnregisterTabSpawner()
+{
+	if (FSlateApplication::IsInitialized())
+	{
+		FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabId);
+	}
+}
+
+TSharedRef<SDockTab> SUtilityExtendNotificationHistory::SpawnTab(const FSpawnTabArgs& Args)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SUtilityExtendNotificationHistory)
+		];
+}
+
+EActiveTimerReturnType SUtilityExtendNotificationHistory::RefreshIfChanged(double InCurrentTime, float InDeltaTime)
+{
+	const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+	if (NotificationSubsystem && NotificationSubsystem->GetHistoryVersion() != DisplayedHistoryVersion)
+	{
+		RefreshRecords();
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+void SUtilityExtendNotificationHistory::RefreshRecords()
+{
+	Records.Reset();
+
+	if (const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+	{
+		DisplayedHistoryVersion = NotificationSubsystem->GetHistoryVersion();
+		for (FUtilityNotificationRecord& Record : NotificationSubsystem->QueryHistory(FilterString))
+		{
+			Records.Add(MakeShared<FUtilityNotificationRecord>(MoveTemp(Record)));
+		}
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+TSharedRef<ITableRow> SUtilityExtendNotificationHistory::OnGenerateRow(TSharedPtr<FUtilityNotificationRecord> Record, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const FString TimeString = Record->LastUpdatedTime.ToString(TEXT("%H:%M:%S"));
+	const FString MessageString = Record->RepeatCount > 1
+		? FString::Printf(TEXT("%s (×%d)"), *Record->Message, Record->RepeatCount)
+		: Record->Message;
+
+	return SNew(STableRow<TSharedPtr<FUtilityNotificationRecord>>, OwnerTable)
+		.ToolTipText(FText::FromString(Record->Message))
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(TimeString))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(SBox)
+				.WidthOverride(40.0f)
+				[
+					SNew(STextBlock)
+					.Text(SUtilityExtendNotificationHistoryUtils::GetTypeText(Record->Type))
+					.ColorAndOpacity(SUtilityExtendNotificationHistoryUtils::GetTypeColor(Record->Type))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(MessageString))
+				.ColorAndOpacity(Record->bRateLimited ? FSlateColor::UseSubduedForeground() : FSlateColor::UseForeground())
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 2.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Record->Source))
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
+		];
+}
+
+void SUtilityExtendNotificationHistory::OnSearchTextChanged(const FText& InFilterText)
+{
+	const FString NewFilter = InFilterText.ToString().TrimStartAndEnd();
+	if (FilterString != NewFilter)
+	{
+		FilterString = NewFilter;
+		RefreshRecords();
+	}
+}
+
+FReply SUtilityExtendNotificationHistory::OnClearClicked()
+{
+	if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+	{
+		NotificationSubsystem->ClearHistory();
+	}
+	RefreshRecords();
+	return FReply::Handled();
+}
+
+FText SUtilityExtendNotificationHistory::GetStatusText() const
+{
+	return FText::Format(LOCTEXT("StatusFormat", "{0} 条记录"), FText::AsNumber(Records.Num()));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,435 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "UtilityExtendSettings.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogUtilityExtendNotification, Log, All);
+
+namespace UtilityExtendHeadlessNotificationsUtils
+{
+	/** JSON Lines缓冲超过该大小后立即写出 */
+	constexpr int32 MaxBufferedBytes = 64 * 1024;
+
+	/** JSON Lines缓冲的最长保留时间（秒） */
+	constexpr double MaxBufferedSeconds = 2.0;
+
+	/** 进度抽样记录超过该数量后清理过期的记录 */
+	constexpr int32 ProgressPruneThreshold = 64;
+
+	/** 通知类型名称 */
+	const TCHAR* LexType(EEditorNotificationType Type)
+	{
+		switch (Type)
+		{
+		case EEditorNotificationType::Success:
+			return TEXT("success");
+		case EEditorNotificationType::Error:
+			return TEXT("error");
+		default:
+			return TEXT("default");
+		}
+	}
+
+	/** 写入LogUtilityExtendNotification日志分类 */
+	class FLogSink : public IUtilityExtendNotificationSink
+	{
+	public:
+		virtual void Write(const FUtilityHeadlessNotificationEvent& Event) override
+		{
+			using EKind = FUtilityHeadlessNotificationEvent::EKind;
+
+			switch (Event.Kind)
+			{
+			case EKind::Progress:
+				if (Event.Total > 0)
+				{
+					UE_LOG(LogUtilityExtendNotification, Display, TEXT("[%s] %.1f%% (%d/%d)"), *Event.Id, Event.Progress * 100.0f, Event.Completed, Event.Total);
+				}
+				else
+				{
+					UE_LOG(LogUtilityExtendNotification, Display, TEXT("[%s] %.1f%%"), *Event.Id, Event.Progress * 100.0f);
+				}
+				break;
+			case EKind::Suppressed:
+				UE_LOG(LogUtilityExtendNotification, Display, TEXT("另有 %d 条通知因频率限制未输出，最后一条：%s"), Event.SuppressedCount, *Event.Message);
+				break;
+			default:
+				UE_LOG(LogUtilityExtendNotification, Display, TEXT("[%s] %s %s: %s"),
+					*Event.Id, FUtilityHeadlessNotificationEvent::LexKind(Event.Kind), LexType(Event.Type), *Event.Message);
+				break;
+			}
+		}
+	};
+
+	/** 缓冲写入JSON Lines文件，每条事件一行 */
+	class FJsonLinesSink : public IUtilityExtendNotificationSink
+	{
+	public:
+		explicit FJsonLinesSink(const FString& InFilePath)
+			: FilePath(InFilePath)
+		{
+		}
+
+		virtual ~FJsonLinesSink() override
+		{
+			Flush();
+		}
+
+		virtual void Write(const FUtilityHeadlessNotificationEvent& Event) override
+		{
+			using EKind = FUtilityHeadlessNotificationEvent::EKind;
+
+			FString Line;
+			const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+				TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("time"), Event.Timestamp.ToIso8601());
+			Writer->WriteValue(TEXT("kind"), FString(FUtilityHeadlessNotificationEvent::LexKind(Event.Kind)));
+			if (!Event.Id.IsEmpty())
+			{
+				Writer->WriteValue(TEXT("id"), Event.Id);
+			}
+			if (Event.Kind == EKind::Notify || Event.Kind == EKind::Complete)
+			{
+				Writer->WriteValue(TEXT("type"), FString(LexType(Event.Type)));
+			}
+			if (!Event.Message.IsEmpty())
+			{
+				Writer->WriteValue(TEXT("message"), Event.Message);
+			}
+			if (!Event.Source.IsEmpty())
+			{
+				Writer->WriteValue(TEXT("source"), Event.Source);
+			}
+			if (Event.Kind == EKind::Progress)
+			{
+				Writer->WriteValue(TEXT("progress"), Event.Progress);
+				if (Event.Total > 0)
+				{
+					Writer->WriteValue(TEXT("completed"), Event.Completed);
+					Writer->WriteValue(TEXT("total"), Event.Total);
+				}
+			}
+			if (Event.Kind == EKind::Suppressed)
+			{
+				Writer->WriteValue(TEXT("count"), Event.SuppressedCount);
+			}
+			Writer->WriteObjectEnd();
+			Writer->Close();
+			Line.AppendChar(TEXT('\n'));
+
+			const FTCHARToUTF8 Utf8(*Line);
+			Buffer.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+			const double Now = FPlatformTime::Seconds();
+			if (Buffer.Num() >= MaxBufferedBytes || Now - LastFlushTime >= MaxBufferedSeconds)
+			{
+				Flush();
+			}
+		}
+
+		virtual void Flush() override
+		{
+			LastFlushTime = FPlatformTime::Seconds();
+			if (Buffer.Num() == 0)
+			{
+				return;
+			}
+
+			if (!FileHandle.IsValid() && !bOpenFailed)
+			{
+				IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+				PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+				FileHandle.Reset(PlatformFile.OpenWrite(*FilePath, true, true));
+				if (!FileHandle.IsValid())
+				{
+					// 只提示一次，之后的事件直接丢弃
+					bOpenFailed = true;
+					UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法打开无界面通知文件 %s"), *FilePath);
+				}
+			}
+
+			if (FileHandle.IsValid())
+			{
+				FileHandle->Write(Buffer.GetData(), Buffer.Num());
+				FileHandle->Flush();
+			}
+			Buffer.Reset();
+		}
+
+	private:
+		/** 输出文件 */
+		FString FilePath;
+
+		/** 输出文件句柄，第一次写出时打开 */
+		TUniquePtr<IFileHandle> FileHandle;
+
+		/** 尚未写出的UTF-8内容 */
+		TArray<uint8> Buffer;
+
+		/** 上一次写出的时间 */
+		double LastFlushTime = 0.0;
+
+		/** 是否打开文件失败 */
+		bool bOpenFailed = false;
+	};
+}
+
+const TCHAR* FUtilityHeadlessNotificationEvent::LexKind(EKind Kind)
+{
+	switch (Kind)
+	{
+	case EKind::Notify:
+		return TEXT("notify");
+	case EKind::Begin:
+		return TEXT("begin");
+	case EKind::Text:
+		return TEXT("text");
+	case EKind::Progress:
+		return TEXT("progress");
+	case EKind::Complete:
+		return TEXT("complete");
+	case EKind::Suppressed:
+		return TEXT("suppressed");
+	default:
+		return TEXT("unknown");
+	}
+}
+
+FUtilityExtendHeadlessNotifications& FUtilityExtendHeadlessNotifications::Get()
+{
+	static FUtilityExtendHeadlessNotifications Instance;
+	return Instance;
+}
+
+bool FUtilityExtendHeadlessNotifications::IsHeadless()
+{
+	return !FSlateApplication::IsInitialized();
+}
+
+TSharedRef<IUtilityExtendNotificationSink> FUtilityExtendHeadlessNotifications::MakeLogSink()
+{
+	return MakeShared<UtilityExtendHeadlessNotificationsUtils::FLogSink>();
+}
+
+TSharedRef<IUtilityExtendNotificationSink> FUtilityExtendHeadlessNotifications::MakeJsonLinesSink(const FString& FilePath)
+{
+	return MakeShared<UtilityExtendHeadlessNotificationsUtils::FJsonLinesSink>(FilePath);
+}
+
+void FUtilityExtendHeadlessNotifications::SetSink(TSharedPtr<IUtilityExtendNotificationSink> InSink)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (Sink.IsValid())
+	{
+		Sink->Flush();
+	}
+	Sink = MoveTemp(InSink);
+	bSinkResolved = Sink.IsValid();
+}
+
+FString FUtilityExtendHeadlessNotifications::AllocateId()
+{
+	FScopeLock ScopeLock(&Lock);
+	return FString::Printf(TEXT("headless.%u"), NextId++);
+}
+
+FString FUtilityExtendHeadlessNotifications::Notify(const FString& Message, EEditorNotificationType Type, const FString& Source)
+{
+	const FString Id = AllocateId();
+
+	FScopeLock ScopeLock(&Lock);
+	if (TryConsumeRateTokenLocked(Message))
+	{
+		FUtilityHeadlessNotificationEvent Event;
+		Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Notify;
+		Event.Id = Id;
+		Event.Message = Message;
+		Event.Source = Source;
+		Event.Type = Type;
+		WriteLocked(Event);
+	}
+	return Id;
+}
+
+void FUtilityExtendHeadlessNotifications::Begin(const FString& Id, const FString& Message, const FString& Source)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FUtilityHeadlessNotificationEvent Event;
+	Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Begin;
+	Event.Id = Id;
+	Event.Message = Message;
+	Event.Source = Source;
+	WriteLocked(Event);
+}
+
+void FUtilityExtendHeadlessNotifications::UpdateText(const FString& Id, const FString& Message)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (TryConsumeRateTokenLocked(Message))
+	{
+		FUtilityHeadlessNotificationEvent Event;
+		Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Text;
+		Event.Id = Id;
+		Event.Message = Message;
+		WriteLocked(Event);
+	}
+}
+
+void FUtilityExtendHeadlessNotifications::UpdateProgress(const FString& Id, float Progress, int32 Completed, int32 Total)
+{
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const double Interval = Settings ? Settings->HeadlessProgressInterval : 1.0;
+	const double Now = FPlatformTime::Seconds();
+	Progress = FMath::Clamp(Progress, 0.0f, 1.0f);
+
+	FScopeLock ScopeLock(&Lock);
+
+	// 结束事件会移除记录，没有结束就被丢弃的通知留下的记录在数量较多时清理；
+	// 距上次输出已超过间隔的记录与没有记录的抽样结果相同，清理不影响输出
+	if (LastProgressTimes.Num() >= UtilityExtendHeadlessNotificationsUtils::ProgressPruneThreshold)
+	{
+		for (TMap<FString, double>::TIterator It = LastProgressTimes.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value() >= Interval)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// 大循环中逐项上报的进度按间隔抽样，到达100%时总会输出
+	double& LastTime = LastProgressTimes.FindOrAdd(Id, -UE_DOUBLE_BIG_NUMBER);
+	if (Progress < 1.0f && Now - LastTime < Interval)
+	{
+		return;
+	}
+	LastTime = Now;
+
+	FUtilityHeadlessNotificationEvent Event;
+	Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Progress;
+	Event.Id = Id;
+	Event.Progress = Progress;
+	Event.Completed = Completed;
+	Event.Total = Total;
+	WriteLocked(Event);
+}
+
+void FUtilityExtendHeadlessNotifications::Complete(const FString& Id, EEditorNotificationType Type, const FString& Message)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	LastProgressTimes.Remove(Id);
+
+	FUtilityHeadlessNotificationEvent Event;
+	Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Complete;
+	Event.Id = Id;
+	Event.Message = Message;
+	Event.Type = Type;
+	WriteLocked(Event);
+}
+
+void FUtilityExtendHeadlessNotifications::Flush()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FlushSuppressedLocked();
+	if (Sink.IsValid())
+	{
+		Sink->Flush();
+	}
+}
+
+void FUtilityExtendHeadlessNotifications::Shutdown()
+{
+	Flush();
+
+	FScopeLock ScopeLock(&Lock);
+	Sink.Reset();
+	bSinkResolved = false;
+	LastProgressTimes.Empty();
+}
+
+void FUtilityExtendHeadlessNotifications::WriteLocked(FUtilityHeadlessNotificationEvent& Event)
+{
+	if (IUtilityExtendNotificationSink* CurrentSink = GetSinkLocked())
+	{
+		Event.Timestamp = FDateTime::UtcNow();
+		CurrentSink->Write(Event);
+	}
+}
+
+bool FUtilityExtendHeadlessNotifications::TryConsumeRateTokenLocked(const FString& Message)
+{
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const int32 MaxPerSecond = Settings ? Settings->MaxNotificationsPerSecond : 0;
+	if (MaxPerSecond > 0)
+	{
+		// 与编辑器中的通知相同的令牌桶，第一次调用时装满
+		const double Now = FPlatformTime::Seconds();
+		RateTokens = RateTokens < 0.0
+			? MaxPerSecond
+			: FMath::Min<double>(MaxPerSecond, RateTokens + (Now - LastRateRefillTime) * MaxPerSecond);
+		LastRateRefillTime = Now;
+		if (RateTokens < 1.0)
+		{
+			++PendingSuppressedCount;
+			LastSuppressedMessage = Message;
+			return false;
+		}
+		RateTokens -= 1.0;
+	}
+
+	// 限制解除后先输出之前被限制的数量，保证输出顺序与发生顺序一致
+	FlushSuppressedLocked();
+	return true;
+}
+
+void FUtilityExtendHeadlessNotifications::FlushSuppressedLocked()
+{
+	if (PendingSuppressedCount == 0)
+	{
+		return;
+	}
+
+	FUtilityHeadlessNotificationEvent Event;
+	Event.Kind = FUtilityHeadlessNotificationEvent::EKind::Suppressed;
+	Event.Message = MoveTemp(LastSuppressedMessage);
+	Event.SuppressedCount = PendingSuppressedCount;
+	PendingSuppressedCount = 0;
+	LastSuppressedMessage.Reset();
+	WriteLocked(Event);
+}
+
+IUtilityExtendNotificationSink* FUtilityExtendHeadlessNotifications::GetSinkLocked()
+{
+	if (!bSinkResolved)
+	{
+		bSinkResolved = true;
+
+		const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+		const EUtilityHeadlessNotificationOutput Output = Settings ? Settings->HeadlessNotificationOutput : EUtilityHeadlessNotificationOutput::Log;
+		if (Output == EUtilityHeadlessNotificationOutput::Log)
+		{
+			Sink = MakeLogSink();
+		}
+		else if (Output == EUtilityHeadlessNotificationOutput::JsonLines)
+		{
+			FString FilePath = Settings->HeadlessNotificationFile.FilePath;
+			FilePath = FilePath.IsEmpty()
+				? FPaths::ProjectLogDir() / TEXT("UtilityExtendNotifications.jsonl")
+				: FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), FilePath);
+			Sink = MakeJsonLinesSink(FilePath);
+		}
+	}
+	return Sink.Get();
+}
@@ -0,0 +1,308 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityExtendNotificationQueue.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+
+namespace UtilityExtendNotificationQueueUtils
+{
+	/** 编号的最高位记录创建时选择的去向，置位表示写入无界面输出；后续命令按编号走同一去向，不需要额外的映射 */
+	constexpr uint32 HeadlessRouteBit = 1u << 31;
+
+	bool IsHeadlessRoute(uint32 NotificationId)
+	{
+		return (NotificationId & HeadlessRouteBit) != 0;
+	}
+
+	/** 无界面输出中的通知ID，编号相同即为同一通知 */
+	FString MakeHeadlessId(uint32 NotificationId)
+	{
+		return FString::Printf(TEXT("queue.%u"), NotificationId & ~HeadlessRouteBit);
+	}
+}
+
+FUtilityExtendNotificationQueue& FUtilityExtendNotificationQueue::Get()
+{
+	static FUtilityExtendNotificationQueue Queue;
+	return Queue;
+}
+
+uint32 FUtilityExtendNotificationQueue::Create(const FString& Message)
+{
+	using namespace UtilityExtendNotificationQueueUtils;
+
+	uint32 NotificationId = NextNotificationId.fetch_add(1, std::memory_order_relaxed) & ~HeadlessRouteBit;
+	if (NotificationId == 0)
+	{
+		// 编号回绕时跳过0
+		NotificationId = NextNotificationId.fetch_add(1, std::memory_order_relaxed) & ~HeadlessRouteBit;
+	}
+
+	// 没有Slate或没有子系统处理队列时直接写入无界面输出，之后这个通知的所有命令都写入无界面输出
+	if (ShouldBypassQueue())
+	{
+		NotificationId |= HeadlessRouteBit;
+		FUtilityExtendHeadlessNotifications::Get().Begin(MakeHeadlessId(NotificationId), Message, FString());
+		return NotificationId;
+	}
+
+	FCommand Command;
+	Command.Type = ECommandType::Create;
+	Command.NotificationId = NotificationId;
+	Command.Message = Message;
+	Commands.Enqueue(MoveTemp(Command));
+	return NotificationId;
+}
+
+void FUtilityExtendNotificationQueue::UpdateText(uint32 NotificationId, const FString& Message)
+{
+	if (UtilityExtendNotificationQueueUtils::IsHeadlessRoute(NotificationId))
+	{
+		FUtilityExtendHeadlessNotifications::Get().UpdateText(UtilityExtendNotificationQueueUtils::MakeHeadlessId(NotificationId), Message);
+		return;
+	}
+	if (!HasConsumer())
+	{
+		return;
+	}
+
+	FCommand Command;
+	Command.Type = ECommandType::UpdateText;
+	Command.NotificationId = NotificationId;
+	Command.Message = Message;
+	Commands.Enqueue(MoveTemp(Command));
+}
+
+void FUtilityExtendNotificationQueue::UpdateProgress(uint32 NotificationId, float Progress)
+{
+	if (UtilityExtendNotificationQueueUtils::IsHeadlessRoute(NotificationId))
+	{
+		FUtilityExtendHeadlessNotifications::Get().UpdateProgress(UtilityExtendNotificationQueueUtils::MakeHeadlessId(NotificationId), Progress);
+		return;
+	}
+	if (!HasConsumer())
+	{
+		return;
+	}
+
+	FCommand Command;
+	Command.Type = ECommandType::UpdateProgress;
+	Command.NotificationId = NotificationId;
+	Command.Progress = FMath::Clamp(Progress, 0.0f, 1.0f);
+	Commands.Enqueue(MoveTemp(Command));
+}
+
+void FUtilityExtendNotificationQueue::UpdateProgressCount(uint32 NotificationId, int32 Completed, int32 Total)
+{
+	FCommand Command;
+	Command.Type = ECommandType::UpdateProgress;
+	Command.NotificationId = NotificationId;
+	Command.Total = FMath::Max(Total, 0);
+	Command.Completed = FMath::Clamp(Completed, 0, Command.Total);
+	Command.Progress = Command.Total > 0 ? static_cast<float>(Command.Completed) / Command.Total : 0.0f;
+
+	if (UtilityExtendNotificationQueueUtils::IsHeadlessRoute(NotificationId))
+	{
+		FUtilityExtendHeadlessNotifications::Get().UpdateProgress(UtilityExtendNotificationQueueUtils::MakeHeadlessId(NotificationId),
+			Command.Progress, Command.Completed, Command.Total);
+		return;
+	}
+	if (!HasConsumer())
+	{
+		return;
+	}
+
+	Commands.Enqueue(MoveTemp(Command));
+}
+
+void FUtilityExtendNotificationQueue::Complete(uint32 NotificationId, bool bSuccess, const FString& Message)
+{
+	if (UtilityExtendNotificationQueueUtils::IsHeadlessRoute(NotificationId))
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(UtilityExtendNotificationQueueUtils::MakeHeadlessId(NotificationId),
+			bSuccess ? EEditorNotificationType::Success : EEditorNotificationType::Error, Message);
+		return;
+	}
+	if (!HasConsumer())
+	{
+		return;
+	}
+
+	FCommand Command;
+	Command.Type = ECommandType::Complete;
+	Command.NotificationId = NotificationId;
+	Command.Message = Message;
+	Command.bSuccess = bSuccess;
+	Commands.Enqueue(MoveTemp(Command));
+}
+
+void FUtilityExtendNotificationQueue::SetConsumerAvailable(bool bAvailable)
+{
+	bHasConsumer.store(bAvailable, std::memory_order_release);
+}
+
+bool FUtilityExtendNotificationQueue::HasConsumer() const
+{
+	return bHasConsumer.load(std::memory_order_acquire);
+}
+
+bool FUtilityExtendNotificationQueue::ShouldBypassQueue() const
+{
+	// 没有通知子系统每帧处理队列时（编辑器启动早期、子系统已关闭）命令会一直积压，既不显示也不记录
+	return FUtilityExtendHeadlessNotifications::IsHeadless() || !HasConsumer();
+}
+
+int32 FUtilityExtendNotificationQueue::Drain(UUtilityExtendNotificationSubsystem& Subsystem)
+{
+	check(IsInGameThread());
+
+	if (Commands.IsEmpty())
+	{
+		return 0;
+	}
+
+	// 先把本帧的全部命令按通知合并，被后续命令覆盖的文本和进度不会触发Slate更新；
+	// TMap在没有删除时保持插入顺序，通知按创建顺序显示
+	TMap<uint32, FPendingChange> Changes;
+	int32 CommandCount = 0;
+	FCommand Command;
+	while (Commands.Dequeue(Command))
+	{
+		++CommandCount;
+		MergeCommand(Changes.FindOrAdd(Command.NotificationId), MoveTemp(Command));
+	}
+
+	if (!FSlateApplication::IsInitialized())
+	{
+		return CommandCount;
+	}
+
+	for (TPair<uint32, FPendingChange>& Pair : Changes)
+	{
+		ApplyChange(Subsystem, Pair.Key, Pair.Value);
+	}
+
+	return CommandCount;
+}
+
+void FUtilityExtendNotificationQueue::Shutdown(UUtilityExtendNotificationSubsystem& Subsystem)
+{
+	// 先应用已经提交的命令，已完成的通知按结果淡出
+	Drain(Subsystem);
+
+	// 之后这些通知的命令会被丢弃，关闭仍在显示的通知和进度条，避免加载动画一直停留
+	if (FSlateApplication::IsInitialized())
+	{
+		for (TPair<uint32, FLiveNotification>& Pair : LiveNotifications)
+		{
+			Pair.Value.ProgressBar.Close();
+			if (const TSharedPtr<SNotificationItem> Item = Subsystem.Find(Pair.Value.Handle))
+			{
+				Item->SetCompletionState(SNotificationItem::CS_None);
+				Item->ExpireAndFadeout();
+			}
+		}
+	}
+	LiveNotifications.Empty();
+
+	// 停止处理后才到达的命令直接丢弃
+	FCommand Command;
+	while (Commands.Dequeue(Command))
+	{
+	}
+}
+
+void FUtilityExtendNotificationQueue::MergeCommand(FPendingChange& Change, FCommand&& Command)
+{
+	switch (Command.Type)
+	{
+	case ECommandType::Create:
+		Change.bCreate = true;
+		Change.bHasText = true;
+		Change.Message = MoveTemp(Command.Message);
+		break;
+	case ECommandType::UpdateText:
+		Change.bHasText = true;
+		Change.Message = MoveTemp(Command.Message);
+		break;
+	case ECommandType::UpdateProgress:
+		Change.bHasProgress = true;
+		Change.Permille = FMath::RoundToInt(Command.Progress * 1000.0f);
+		Change.Completed = Command.Completed;
+		Change.Total = Command.Total;
+		break;
+	case ECommandType::Complete:
+		Change.bComplete = true;
+		Change.bSuccess = Command.bSuccess;
+		if (!Command.Message.IsEmpty())
+		{
+			Change.bHasText = true;
+			Change.Message = MoveTemp(Command.Message);
+		}
+		break;
+	}
+}
+
+void FUtilityExtendNotificationQueue::ApplyChange(UUtilityExtendNotificationSubsystem& Subsystem, uint32 NotificationId, FPendingChange& Change)
+{
+	if (Change.bCreate)
+	{
+		FNotificationInfo Info(FText::FromString(Change.Message));
+		Info.bUseThrobber = true;
+		Info.FadeInDuration = 0.1f;
+		Info.FadeOutDuration = 0.5f;
+		Info.ExpireDuration = 0.0f;
+		Info.bUseLargeFont = false;
+		Info.bFireAndForget = false;
+		Info.bAllowThrottleWhenFrameRateIsLow = false;
+
+		TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info);
+		if (!Item.IsValid())
+		{
+			return;
+		}
+		Item->SetCompletionState(SNotificationItem::CS_Pending);
+
+		FLiveNotification& Live = LiveNotifications.Add(NotificationId);
+		Live.Handle = Subsystem.Register(Item, false);
+		Live.Message = Change.Message;
+		Subsystem.AddHistoryRecord(Change.Message, EEditorNotificationType::Default, FString());
+		Change.bHasText = false;
+	}
+
+	FLiveNotification* Live = LiveNotifications.Find(NotificationId);
+	if (!Live)
+	{
+		// 通知已经完成，或编号无效
+		return;
+	}
+
+	const TSharedPtr<SNotificationItem> Item = Subsystem.Find(Live->Handle);
+	if (!Item.IsValid())
+	{
+		Live->ProgressBar.Close();
+		LiveNotifications.Remove(NotificationId);
+		return;
+	}
+
+	if (Change.bHasText)
+	{
+		Item->SetText(FText::FromString(Change.Message));
+		Live->Message = MoveTemp(Change.Message);
+	}
+
+	// 一帧内合并后的进度只更新一次进度条，显示内容没有变化时不调用Slate
+	if (Change.bHasProgress && !Change.bComplete)
+	{
+		Live->ProgressBar.Update(FText::FromString(Live->Message), Change.Permille, Change.Completed, Change.Total);
+	}
+
+	if (Change.bComplete)
+	{
+		Live->ProgressBar.Close();
+		Item->SetCompletionState(Change.bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Item->ExpireAndFadeout();
+		LiveNotifications.Remove(NotificationId);
+	}
+}
@@ -0,0 +1,639 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityExtendNotificationQueue.h"
+#include "Notification/UtilityLoadingNotification.h"
+#include "Notification/UtilityProgressGroup.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "Editor.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/PlatformTime.h"
+#include "UtilityExtendSettings.h"
+#include "UtilityExtendStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Notifications Active"), STAT_UtilityExtend_NotificationsActive, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Notifications Leaked"), STAT_UtilityExtend_NotificationsLeaked, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Notifications Reclaimed"), STAT_UtilityExtend_NotificationsReclaimed, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Notifications Coalesced"), STAT_UtilityExtend_NotificationsCoalesced, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Notifications Rate Limited"), STAT_UtilityExtend_NotificationsRateLimited, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Loading Notifications In Use"), STAT_UtilityExtend_LoadingNotificationsInUse, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Loading Notifications Pooled"), STAT_UtilityExtend_LoadingNotificationsPooled, STATGROUP_UtilityExtend);
+
+namespace UtilityExtendNotificationSubsystemUtils
+{
+	/** 回收检查间隔（秒），通知淡出后最多延迟这么久释放槽位 */
+	constexpr float ReclaimInterval = 1.0f;
+
+	/** 汇总提示的显示时间（秒） */
+	constexpr float SummaryExpireDuration = 5.0f;
+
+	/** 对象池最多保留的空闲加载通知对象，超出的对象交给垃圾回收 */
+	constexpr int32 MaxPooledLoadingNotifications = 32;
+
+	/** 历史记录中消息的最大长度，保证缓冲区占用的内存有上限 */
+	constexpr int32 MaxHistoryMessageLength = 1024;
+
+	/** 根据完成状态推断通知类型 */
+	EEditorNotificationType GetNotificationType(SNotificationItem::ECompletionState CompletionState)
+	{
+		switch (CompletionState)
+		{
+		case SNotificationItem::CS_Success:
+			return EEditorNotificationType::Success;
+		case SNotificationItem::CS_Fail:
+			return EEditorNotificationType::Error;
+		default:
+			return EEditorNotificationType::Default;
+		}
+	}
+
+	/** 在消息后附加重复次数 */
+	FText FormatRepeatedText(const FText& Text, int32 RepeatCount)
+	{
+		return FText::FromString(FString::Printf(TEXT("%s (×%d)"), *Text.ToString(), RepeatCount));
+	}
+
+	/** 汇总提示的文本 */
+	FText FormatSummaryText(int32 SuppressedCount, const FString& LastMessage)
+	{
+		return FText::FromString(FString::Printf(TEXT("另有 %d 条通知因频率限制未单独显示\n最后一条：%s"), SuppressedCount, *LastMessage));
+	}
+}
+
+FString FUtilityNotificationHandle::ToString() const
+{
+	return IsValid() ? FString::Printf(TEXT("%d.%u"), Index, Serial) : FString();
+}
+
+FUtilityNotificationHandle FUtilityNotificationHandle::FromString(const FString& NotificationId)
+{
+	FUtilityNotificationHandle Handle;
+
+	FString IndexString;
+	FString SerialString;
+	if (!NotificationId.Split(TEXT("."), &IndexString, &SerialString)
+		|| !IndexString.IsNumeric() || !SerialString.IsNumeric())
+	{
+		return Handle;
+	}
+
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+	LexFromString(Index, *IndexString);
+	LexFromString(Serial, *SerialString);
+	if (Index >= 0 && Serial != 0)
+	{
+		Handle.Index = Index;
+		Handle.Serial = Serial;
+	}
+	return Handle;
+}
+
+UUtilityExtendNotificationSubsystem* UUtilityExtendNotificationSubsystem::Get()
+{
+	return GEditor ? GEditor->GetEditorSubsystem<UUtilityExtendNotificationSubsystem>() : nullptr;
+}
+
+void UUtilityExtendNotificationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 令牌初始为满，补充时按当前的每秒上限截断
+	RateTokens = TNumericLimits<double>::Max();
+	LastRateRefillTime = FPlatformTime::Seconds();
+
+	ReclaimTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UUtilityExtendNotificationSubsystem::TickReclaim),
+		UtilityExtendNotificationSubsystemUtils::ReclaimInterval);
+
+	DrainTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UUtilityExtendNotificationSubsystem::TickDrainQueue));
+	FUtilityExtendNotificationQueue::Get().SetConsumerAvailable(true);
+}
+
+void UUtilityExtendNotificationSubsystem::Deinitialize()
+{
+	if (ReclaimTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReclaimTickerHandle);
+		ReclaimTickerHandle.Reset();
+	}
+
+	if (DrainTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DrainTickerHandle);
+		DrainTickerHandle.Reset();
+	}
+	FUtilityExtendNotificationQueue::Get().SetConsumerAvailable(false);
+	FUtilityExtendNotificationQueue::Get().Shutdown(*this);
+
+	// 队列创建的通知已由队列关闭；其余通知项由Slate持有，这里只释放句柄表
+	Slots.Empty();
+	CoalescedEntries.Empty();
+	ActiveLoadingNotifications.Empty();
+	ActiveProgressGroups.Empty();
+	LoadingNotificationPool.Empty();
+	LeakedCount = 0;
+	UpdateStats();
+
+	Super::Deinitialize();
+}
+
+FUtilityNotificationHandle UUtilityExtendNotificationSubsystem::ShowNotification(const FNotificationInfo& Info, SNotificationItem::ECompletionState CompletionState, const FString& CoalesceKey, const FString& Source)
+{
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const float CoalesceWindow = Settings ? Settings->NotificationCoalesceWindow : 0.0f;
+	const double Now = FPlatformTime::Seconds();
+
+	const EEditorNotificationType Type = UtilityExtendNotificationSubsystemUtils::GetNotificationType(CompletionState);
+
+	// 合并窗口内的重复通知只更新已有通知的文本和重复次数，不新建Slate控件；自动消失的通知重新计时，已经开始淡出的不再合并
+	// 默认合并键包含通知类型，否则文本相同的错误和成功通知会合并成一条并沿用先出现的图标
+	const FString Key = CoalesceKey.IsEmpty()
+		? FString::Printf(TEXT("%d|%s"), static_cast<int32>(Type), *Info.Text.ToString())
+		: CoalesceKey;
+	if (CoalesceWindow > 0.0f)
+	{
+		if (FCoalescedEntry* Entry = CoalescedEntries.Find(Key))
+		{
+			const TSharedPtr<SNotificationItem> Item = Find(Entry->Handle);
+			const bool bFading = Entry->FadeStartTime > 0.0 && Now >= Entry->FadeStartTime;
+			if (Item.IsValid() && !bFading && Now - Entry->LastTime <= CoalesceWindow)
+			{
+				++Entry->RepeatCount;
+				Entry->LastTime = Now;
+				Item->SetText(UtilityExtendNotificationSubsystemUtils::FormatRepeatedText(Info.Text, Entry->RepeatCount));
+				if (Entry->FadeStartTime > 0.0)
+				{
+					// 重新开始显示计时，否则通知会按第一次出现的时间消失
+					Item->ExpireAndFadeout();
+					Entry->FadeStartTime = Now + Entry->ExpireDuration;
+				}
+				++CoalescedCount;
+
+				if (FUtilityNotificationRecord* Record = FindHistoryRecord(Entry->HistorySequence))
+				{
+					Record->Message = Info.Text.ToString().Left(UtilityExtendNotificationSubsystemUtils::MaxHistoryMessageLength);
+					Record->RepeatCount = Entry->RepeatCount;
+					Record->LastUpdatedTime = FDateTime::Now();
+					++HistoryVersion;
+				}
+				UpdateStats();
+				return Entry->Handle;
+			}
+		}
+	}
+
+	// 超出每秒上限的通知记入汇总，由定时回收时统一显示
+	if (!TryConsumeRateToken(Now))
+	{
+		++PendingSuppressedCount;
+		++SuppressedCount;
+		LastSuppressedMessage = Info.Text.ToString();
+		AddHistoryRecord(LastSuppressedMessage, Type, Source, true);
+		UpdateStats();
+		return FUtilityNotificationHandle();
+	}
+
+	TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info);
+	if (!Item.IsValid())
+	{
+		return FUtilityNotificationHandle();
+	}
+	Item->SetCompletionState(CompletionState);
+
+	const FUtilityNotificationHandle Handle = Register(Item, Info.bFireAndForget);
+	const uint64 HistorySequence = AddHistoryRecord(Info.Text.ToString(), Type, Source);
+	if (CoalesceWindow > 0.0f)
+	{
+		FCoalescedEntry& Entry = CoalescedEntries.FindOrAdd(Key);
+		Entry.Handle = Handle;
+		Entry.HistorySequence = HistorySequence;
+		Entry.RepeatCount = 1;
+		Entry.LastTime = Now;
+		Entry.ExpireDuration = Info.ExpireDuration;
+		Entry.FadeStartTime = Info.bFireAndForget ? Now + Info.ExpireDuration : 0.0;
+	}
+	return Handle;
+}
+
+FUtilityNotificationHandle UUtilityExtendNotificationSubsystem::Register(const TSharedPtr<SNotificationItem>& Item, bool bFireAndForget, UObject* Owner)
+{
+	FUtilityNotificationHandle Handle;
+	if (!Item.IsValid())
+	{
+		return Handle;
+	}
+
+	FNotificationSlot Slot;
+	Slot.Item = Item;
+	Slot.Owner = Owner;
+	Slot.Serial = NextSerial;
+	Slot.bFireAndForget = bFireAndForget;
+	Slot.bHasOwner = Owner != nullptr;
+
+	// 跳过0，保证有效句柄的序号不为0
+	NextSerial = NextSerial == MAX_uint32 ? 1 : NextSerial + 1;
+
+	Handle.Index = Slots.Add(MoveTemp(Slot));
+	Handle.Serial = Slots[Handle.Index].Serial;
+	UpdateStats();
+	return Handle;
+}
+
+bool UUtilityExtendNotificationSubsystem::Remove(FUtilityNotificationHandle Handle)
+{
+	const FNotificationSlot* Slot = FindSlot(Handle);
+	if (!Slot)
+	{
+		return false;
+	}
+
+	const TSharedPtr<SNotificationItem> Item = Slot->Item.Pin();
+	AutoReleaseOwner(*Slot, Handle);
+	Slots.RemoveAt(Handle.Index);
+	UpdateStats();
+
+	// 通知已经淡出时句柄仍然有效，但不算移除成功，与原先的行为保持一致
+	if (!Item.IsValid())
+	{
+		return false;
+	}
+
+	Item->ExpireAndFadeout();
+	return true;
+}
+
+void UUtilityExtendNotificationSubsystem::RemoveAll()
+{
+	for (auto It = Slots.CreateConstIterator(); It; ++It)
+	{
+		if (const TSharedPtr<SNotificationItem> Item = It->Item.Pin())
+		{
+			Item->ExpireAndFadeout();
+		}
+		AutoReleaseOwner(*It, FUtilityNotificationHandle{ It.GetIndex(), It->Serial });
+	}
+
+	Slots.Empty();
+	CoalescedEntries.Empty();
+	LeakedCount = 0;
+	UpdateStats();
+}
+
+TSharedPtr<SNotificationItem> UUtilityExtendNotificationSubsystem::Find(FUtilityNotificationHandle Handle) const
+{
+	const FNotificationSlot* Slot = FindSlot(Handle);
+	return Slot ? Slot->Item.Pin() : nullptr;
+}
+
+int32 UUtilityExtendNotificationSubsystem::ReclaimExpired()
+{
+	int32 Reclaimed = 0;
+	LeakedCount = 0;
+
+	for (auto It = Slots.CreateIterator(); It; ++It)
+	{
+		FNotificationSlot& Slot = *It;
+
+		// Slate在淡出结束后从通知列表中移除通知项，弱引用失效即表示通知已经消失
+		if (!Slot.Item.IsValid())
+		{
+			AutoReleaseOwner(Slot, FUtilityNotificationHandle{ It.GetIndex(), Slot.Serial });
+			It.RemoveCurrent();
+			++Reclaimed;
+			continue;
+		}
+
+		// 负责关闭通知的对象已被回收或标记为垃圾，或者对象已经结束这次使用却没有关闭通知，不会自动过期的通知将一直停留在屏幕上。
+		// 运行中的加载通知和进度组由子系统强引用，只检查对象是否被回收无法发现后一种情况
+		if (Slot.bHasOwner && !Slot.bFireAndForget
+			&& (!Slot.Owner.IsValid() || IsOwnerDetached(Slot, FUtilityNotificationHandle{ It.GetIndex(), Slot.Serial })))
+		{
+			++LeakedCount;
+			if (!Slot.bLeakReported)
+			{
+				Slot.bLeakReported = true;
+				UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 通知 %d.%u 的所属对象已被回收，但通知仍未关闭"), It.GetIndex(), Slot.Serial);
+			}
+		}
+	}
+
+	// 清理合并窗口已过期或通知已消失的合并记录
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const double CoalesceWindow = Settings ? Settings->NotificationCoalesceWindow : 0.0;
+	const double Now = FPlatformTime::Seconds();
+	for (auto It = CoalescedEntries.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().LastTime > CoalesceWindow || !FindSlot(It.Value().Handle))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	ReclaimedCount += Reclaimed;
+	UpdateStats();
+	return Reclaimed;
+}
+
+uint64 UUtilityExtendNotificationSubsystem::AddHistoryRecord(const FString& Message, EEditorNotificationType Type, const FString& Source, bool bRateLimited)
+{
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const int32 Capacity = Settings ? FMath::Max(Settings->NotificationHistoryCapacity, 0) : HistoryCapacity;
+	if (Capacity != HistoryCapacity)
+	{
+		ResizeHistory(Capacity);
+	}
+	if (HistoryCapacity == 0)
+	{
+		return 0;
+	}
+
+	// 覆盖最旧的记录时复用其字符串内存
+	const uint64 Sequence = NextHistorySequence++;
+	FUtilityNotificationRecord& Record = History[Sequence % HistoryCapacity];
+	Record.Message = Message.Left(UtilityExtendNotificationSubsystemUtils::MaxHistoryMessageLength);
+	Record.Type = Type;
+	Record.CreatedTime = FDateTime::Now();
+	Record.LastUpdatedTime = Record.CreatedTime;
+	Record.Source = Source;
+	Record.RepeatCount = 1;
+	Record.bRateLimited = bRateLimited;
+	Record.Sequence = Sequence;
+
+	HistoryCount = FMath::Min(HistoryCount + 1, HistoryCapacity);
+	++HistoryVersion;
+	return Sequence;
+}
+
+TArray<FUtilityNotificationRecord> UUtilityExtendNotificationSubsystem::QueryHistory(const FString& Keyword, const FString& Source,
+	TOptional<EEditorNotificationType> TypeFilter, int32 MaxCount) const
+{
+	TArray<FUtilityNotificationRecord> Result;
+	const int32 Limit = MaxCount > 0 ? FMath::Min(MaxCount, HistoryCount) : HistoryCount;
+	Result.Reserve(Keyword.IsEmpty() && Source.IsEmpty() && !TypeFilter.IsSet() ? Limit : 0);
+
+	for (int32 Offset = 1; Offset <= HistoryCount && Result.Num() < Limit; ++Offset)
+	{
+		const FUtilityNotificationRecord& Record = History[(NextHistorySequence - Offset) % HistoryCapacity];
+		if (TypeFilter.IsSet() && Record.Type != TypeFilter.GetValue())
+		{
+			continue;
+		}
+		if (!Source.IsEmpty() && !Record.Source.Contains(Source))
+		{
+			continue;
+		}
+		if (!Keyword.IsEmpty() && !Record.Message.Contains(Keyword) && !Record.Source.Contains(Keyword))
+		{
+			continue;
+		}
+		Result.Add(Record);
+	}
+	return Result;
+}
+
+void UUtilityExtendNotificationSubsystem::ClearHistory()
+{
+	// 只重置有效数量，保留缓冲区内存供后续记录复用
+	HistoryCount = 0;
+	++HistoryVersion;
+}
+
+FUtilityNotificationRecord* UUtilityExtendNotificationSubsystem::FindHistoryRecord(uint64 Sequence)
+{
+	if (Sequence == 0 || HistoryCapacity == 0 || Sequence >= NextHistorySequence || Sequence + HistoryCount < NextHistorySequence)
+	{
+		return nullptr;
+	}
+	return &History[Sequence % HistoryCapacity];
+}
+
+void UUtilityExtendNotificationSubsystem::ResizeHistory(int32 NewCapacity)
+{
+	TArray<FUtilityNotificationRecord> NewHistory;
+	NewHistory.SetNum(NewCapacity);
+
+	const int32 KeepCount = FMath::Min(HistoryCount, NewCapacity);
+	for (uint64 Sequence = NextHistorySequence - KeepCount; Sequence < NextHistorySequence; ++Sequence)
+	{
+		NewHistory[Sequence % NewCapacity] = MoveTemp(History[Sequence % HistoryCapacity]);
+	}
+
+	History = MoveTemp(NewHistory);
+	HistoryCapacity = NewCapacity;
+	HistoryCount = KeepCount;
+	++HistoryVersion;
+}
+
+UUtilityLoadingNotification* UUtilityExtendNotificationSubsystem::AcquireLoadingNotification()
+{
+	// 命令行工具中Ticker不一定运行，对象池取空时先回收已完成的无界面通知
+	if (LoadingNotificationPool.Num() == 0)
+	{
+		ReleaseCompletedHeadless();
+	}
+
+	UUtilityLoadingNotification* Notification = LoadingNotificationPool.Num() > 0
+		? LoadingNotificationPool.Pop(EAllowShrinking::No).Get()
+		: NewObject<UUtilityLoadingNotification>(this);
+
+	Notification->MarkAcquired();
+	ActiveLoadingNotifications.Add(Notification);
+	UpdateStats();
+	return Notification;
+}
+
+bool UUtilityExtendNotificationSubsystem::ReleaseLoadingNotification(UUtilityLoadingNotification* Notification)
+{
+	if (!Notification || !ActiveLoadingNotifications.Contains(Notification))
+	{
+		return false;
+	}
+
+	// 仍在显示的通知先关闭，已经完成的通知保留成功或失败状态继续淡出
+	if (Notification->IsNotificationActive())
+	{
+		Notification->CloseNotification();
+	}
+	ReturnToPool(Notification);
+	return true;
+}
+
+void UUtilityExtendNotificationSubsystem::AddActiveProgressGroup(UUtilityProgressGroup* ProgressGroup)
+{
+	if (ProgressGroup)
+	{
+		ActiveProgressGroups.Add(ProgressGroup);
+	}
+}
+
+void UUtilityExtendNotificationSubsystem::RemoveActiveProgressGroup(UUtilityProgressGroup* ProgressGroup)
+{
+	ActiveProgressGroups.Remove(ProgressGroup);
+}
+
+bool UUtilityExtendNotificationSubsystem::IsOwnerDetached(const FNotificationSlot& Slot, FUtilityNotificationHandle Handle) const
+{
+	// 通知已进入成功、失败或关闭状态时正在淡出，不算泄漏
+	const TSharedPtr<SNotificationItem> Item = Slot.Item.Pin();
+	if (!Item.IsValid() || Item->GetCompletionState() != SNotificationItem::CS_Pending)
+	{
+		return false;
+	}
+
+	const UObject* Owner = Slot.Owner.Get();
+	if (const UUtilityLoadingNotification* Notification = Cast<UUtilityLoadingNotification>(Owner))
+	{
+		// 对象已完成、已归还对象池或已绑定到其他通知
+		return Notification->IsCompleted() || Notification->GetNotificationHandle() != Handle;
+	}
+	if (const UUtilityProgressGroup* ProgressGroup = Cast<UUtilityProgressGroup>(Owner))
+	{
+		return ProgressGroup->IsFinished();
+	}
+	return false;
+}
+
+void UUtilityExtendNotificationSubsystem::AutoReleaseOwner(const FNotificationSlot& Slot, FUtilityNotificationHandle Handle)
+{
+	// 对象可能已被归还并再次使用，只有句柄仍指向这个槽位时才是同一次使用
+	UUtilityLoadingNotification* Notification = Cast<UUtilityLoadingNotification>(Slot.Owner.Get());
+	if (Notification && Notification->bAutoRelease && Notification->GetNotificationHandle() == Handle
+		&& ActiveLoadingNotifications.Contains(Notification))
+	{
+		ReturnToPool(Notification);
+	}
+}
+
+void UUtilityExtendNotificationSubsystem::ReleaseCompletedHeadless()
+{
+	TArray<UUtilityLoadingNotification*, TInlineAllocator<16>> Completed;
+	for (UUtilityLoadingNotification* Notification : ActiveLoadingNotifications)
+	{
+		if (Notification && Notification->IsHeadless() && Notification->IsCompleted() && Notification->bAutoRelease)
+		{
+			Completed.Add(Notification);
+		}
+	}
+
+	for (UUtilityLoadingNotification* Notification : Completed)
+	{
+		ReturnToPool(Notification);
+	}
+}
+
+void UUtilityExtendNotificationSubsystem::ReturnToPool(UUtilityLoadingNotification* Notification)
+{
+	ActiveLoadingNotifications.Remove(Notification);
+	Notification->ResetForReuse();
+	if (LoadingNotificationPool.Num() < UtilityExtendNotificationSubsystemUtils::MaxPooledLoadingNotifications)
+	{
+		LoadingNotificationPool.Add(Notification);
+	}
+	UpdateStats();
+}
+
+bool UUtilityExtendNotificationSubsystem::TryConsumeRateToken(double Now)
+{
+	const UUtilityExtendSettings* Settings = UUtilityExtendSettings::Get();
+	const int32 MaxPerSecond = Settings ? Settings->MaxNotificationsPerSecond : 0;
+	if (MaxPerSecond <= 0)
+	{
+		return true;
+	}
+
+	// 令牌桶：每秒补充MaxPerSecond个，最多积攒MaxPerSecond个，允许短时间的小批量突发
+	RateTokens = FMath::Min<double>(MaxPerSecond, RateTokens + (Now - LastRateRefillTime) * MaxPerSecond);
+	LastRateRefillTime = Now;
+	if (RateTokens < 1.0)
+	{
+		return false;
+	}
+
+	RateTokens -= 1.0;
+	return true;
+}
+
+void UUtilityExtendNotificationSubsystem::FlushSuppressedSummary(double Now)
+{
+	UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: %d 条通知因频率限制未单独显示，最后一条：%s"), PendingSuppressedCount, *LastSuppressedMessage);
+
+	// 汇总提示仍在显示时累加数量，持续刷屏时屏幕上始终只有一条汇总
+	if (const TSharedPtr<SNotificationItem> SummaryItem = Find(SummaryHandle))
+	{
+		SummarySuppressedCount += PendingSuppressedCount;
+		SummaryItem->SetText(UtilityExtendNotificationSubsystemUtils::FormatSummaryText(SummarySuppressedCount, LastSuppressedMessage));
+		PendingSuppressedCount = 0;
+		return;
+	}
+
+	// 汇总提示同样受频率限制，令牌不足时留到下一次检查
+	if (!TryConsumeRateToken(Now))
+	{
+		return;
+	}
+
+	FNotificationInfo Info(UtilityExtendNotificationSubsystemUtils::FormatSummaryText(PendingSuppressedCount, LastSuppressedMessage));
+	Info.FadeInDuration = 0.1f;
+	Info.FadeOutDuration = 0.5f;
+	Info.ExpireDuration = UtilityExtendNotificationSubsystemUtils::SummaryExpireDuration;
+	Info.bFireAndForget = true;
+	Info.bUseLargeFont = false;
+
+	TSharedPtr<SNotificationItem> SummaryItem = FSlateNotificationManager::Get().AddNotification(Info);
+	if (SummaryItem.IsValid())
+	{
+		SummaryHandle = Register(SummaryItem, true);
+		SummarySuppressedCount = PendingSuppressedCount;
+		PendingSuppressedCount = 0;
+	}
+}
+
+bool UUtilityExtendNotificationSubsystem::TickReclaim(float DeltaTime)
+{
+	if (Slots.Num() > 0 || CoalescedEntries.Num() > 0)
+	{
+		ReclaimExpired();
+	}
+
+	if (PendingSuppressedCount > 0)
+	{
+		FlushSuppressedSummary(FPlatformTime::Seconds());
+	}
+
+	if (FUtilityExtendHeadlessNotifications::IsHeadless())
+	{
+		ReleaseCompletedHeadless();
+		FUtilityExtendHeadlessNotifications::Get().Flush();
+	}
+	return true;
+}
+
+bool UUtilityExtendNotificationSubsystem::TickDrainQueue(float DeltaTime)
+{
+	FUtilityExtendNotificationQueue::Get().Drain(*this);
+	return true;
+}
+
+const UUtilityExtendNotificationSubsystem::FNotificationSlot* UUtilityExtendNotificationSubsystem::FindSlot(FUtilityNotificationHandle Handle) const
+{
+	if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+
+	const FNotificationSlot& Slot = Slots[Handle.Index];
+	return Slot.Serial == Handle.Serial ? &Slot : nullptr;
+}
+
+void UUtilityExtendNotificationSubsystem::UpdateStats() const
+{
+	SET_DWORD_STAT(STAT_UtilityExtend_NotificationsActive, Slots.Num());
+	SET_DWORD_STAT(STAT_UtilityExtend_NotificationsLeaked, LeakedCount);
+	SET_DWORD_STAT(STAT_UtilityExtend_NotificationsReclaimed, ReclaimedCount);
+	SET_DWORD_STAT(STAT_UtilityExtend_NotificationsCoalesced, CoalescedCount);
+	SET_DWORD_STAT(STAT_UtilityExtend_NotificationsRateLimited, SuppressedCount);
+	SET_DWORD_STAT(STAT_UtilityExtend_LoadingNotificationsInUse, ActiveLoadingNotifications.Num());
+	SET_DWORD_STAT(STAT_UtilityExtend_LoadingNotificationsPooled, LoadingNotificationPool.Num());
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityLoadingNotification.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUtilityExtendNotificationLeakTest, "UtilityExtend.Notification.LeakDetection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FUtilityExtendNotificationLeakTest::RunTest(const FString& Parameters)
+{
+	UUtilityExtendNotificationSubsystem* Subsystem = UUtilityExtendNotificationSubsystem::Get();
+	if (!Subsystem || !FSlateApplication::IsInitialized())
+	{
+		AddInfo(TEXT("没有通知子系统或Slate，跳过"));
+		return true;
+	}
+
+	FNotificationInfo Info(FText::FromString(TEXT("泄漏检测")));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 0.0f;
+	const TSharedPtr<SNotificationItem> Item = FSlateNotificationManager::Get().AddNotification(Info);
+	if (!TestTrue(TEXT("创建通知"), Item.IsValid()))
+	{
+		return false;
+	}
+	Item->SetCompletionState(SNotificationItem::CS_Pending);
+
+	UUtilityLoadingNotification* Owner = Subsystem->AcquireLoadingNotification();
+	Owner->bAutoRelease = false;
+	const FUtilityNotificationHandle Handle = Subsystem->Register(Item, false, Owner);
+	Owner->BindNotificationItem(Item, Handle);
+
+	Subsystem->ReclaimExpired();
+	const int32 BaselineLeaked = Subsystem->GetLeakedCount();
+
+	// 对象结束这次使用却没有关闭通知，加载动画会一直停留
+	Owner->ResetForReuse();
+	Subsystem->ReclaimExpired();
+	TestEqual(TEXT("对象结束使用后通知仍在加载中，计为泄漏"), Subsystem->GetLeakedCount(), BaselineLeaked + 1);
+
+	// 通知关闭后不再计为泄漏
+	Item->SetCompletionState(SNotificationItem::CS_None);
+	Subsystem->ReclaimExpired();
+	TestEqual(TEXT("通知关闭后不再计为泄漏"), Subsystem->GetLeakedCount(), BaselineLeaked);
+
+	Subsystem->Remove(Handle);
+	Subsystem->ReleaseLoadingNotification(Owner);
+	return true;
+}
+
+#endif
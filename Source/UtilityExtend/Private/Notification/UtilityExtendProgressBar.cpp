@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityExtendProgressBar.h"
+
+namespace UtilityExtendProgressBarUtils
+{
+	/** 按千分比显示时的总量 */
+	constexpr int32 PermilleWork = 1000;
+}
+
+void FUtilityExtendProgressBar::Update(const FText& DisplayText, int32 Permille, int32 Completed, int32 Total)
+{
+	const int32 TotalWork = Total > 0 ? Total : UtilityExtendProgressBarUtils::PermilleWork;
+	const int32 WorkDone = Total > 0 ? FMath::Clamp(Completed, 0, Total) : FMath::Clamp(Permille, 0, UtilityExtendProgressBarUtils::PermilleWork);
+
+	FSlateNotificationManager& NotificationManager = FSlateNotificationManager::Get();
+	if (!Handle.IsValid())
+	{
+		Handle = NotificationManager.StartProgressNotification(DisplayText, TotalWork);
+		DisplayedWorkDone = 0;
+		DisplayedTotalWork = TotalWork;
+	}
+
+	// 显示内容不变时不更新Slate
+	if (WorkDone != DisplayedWorkDone || TotalWork != DisplayedTotalWork)
+	{
+		NotificationManager.UpdateProgressNotification(Handle, WorkDone, TotalWork != DisplayedTotalWork ? TotalWork : 0, DisplayText);
+		DisplayedWorkDone = WorkDone;
+		DisplayedTotalWork = TotalWork;
+	}
+}
+
+void FUtilityExtendProgressBar::Close()
+{
+	if (Handle.IsValid())
+	{
+		FSlateNotificationManager::Get().CancelProgressNotification(Handle);
+		Handle = FProgressNotificationHandle();
+	}
+	DisplayedWorkDone = INDEX_NONE;
+	DisplayedTotalWork = 0;
+}
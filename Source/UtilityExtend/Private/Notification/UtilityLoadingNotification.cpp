@@ -1,4 +1,6 @@
 #include "Notification/UtilityLoadingNotification.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "Containers/Ticker.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Engine/Engine.h"
@@ -10,6 +12,11 @@ UUtilityLoadingNotification::UUtilityLoadingNotification()
 
 bool UUtilityLoadingNotification::CreateNotification(const FString& Title, const FString& Text, const TArray<FString>& ButtonTexts, bool bShowProgressBar)
 {
+	if (RejectReleasedCall(TEXT("CreateNotification")))
+	{
+		return false;
+	}
+
 	// 如果已经有活跃的通知，先关闭它
 	if (NotificationPtr.IsValid())
 	{
@@ -18,8 +25,18 @@ bool UUtilityLoadingNotification::CreateNotification(const FString& Title, const
 
 	// 缓存按钮文本
 	CachedButtonTexts = ButtonTexts;
+	Message = Text;
 	bIsCompleted = false;
 
+	// 没有Slate时改为无界面输出
+	if (FUtilityExtendHeadlessNotifications::IsHeadless())
+	{
+		FUtilityExtendHeadlessNotifications& Headless = FUtilityExtendHeadlessNotifications::Get();
+		BindHeadless(Headless.AllocateId());
+		Headless.Begin(NotificationId, Title.IsEmpty() ? Text : FString::Printf(TEXT("%s\n%s"), *Title, *Text), FString());
+		return true;
+	}
+
 	// 创建通知信息结构
 	FNotificationInfo Info(FText::FromString(Text));
 	Info.bFireAndForget = false; // 不自动消失
@@ -57,6 +74,19 @@ bool UUtilityLoadingNotification::CreateNotification(const FString& Title, const
 
 void UUtilityLoadingNotification::SetSuccess(const FString& NewText)
 {
+	if (RejectReleasedCall(TEXT("SetSuccess")))
+	{
+		return;
+	}
+
+	if (bHeadless && !bIsCompleted)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(NotificationId, EEditorNotificationType::Success, NewText);
+		bIsCompleted = true;
+		HandleNotificationCompleted(true);
+		return;
+	}
+
 	if (!NotificationPtr.IsValid() || bIsCompleted)
 	{
 		return;
@@ -69,6 +99,7 @@ void UUtilityLoadingNotification::SetSuccess(const FString& NewText)
 	}
 
 	// 设置成功状态
+	StopProgress();
 	NotificationPtr.Pin()->SetCompletionState(SNotificationItem::CS_Success);
 	NotificationPtr.Pin()->ExpireAndFadeout();
 
@@ -78,6 +109,19 @@ void UUtilityLoadingNotification::SetSuccess(const FString& NewText)
 
 void UUtilityLoadingNotification::SetError(const FString& NewText)
 {
+	if (RejectReleasedCall(TEXT("SetError")))
+	{
+		return;
+	}
+
+	if (bHeadless && !bIsCompleted)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(NotificationId, EEditorNotificationType::Error, NewText);
+		bIsCompleted = true;
+		HandleNotificationCompleted(false);
+		return;
+	}
+
 	if (!NotificationPtr.IsValid() || bIsCompleted)
 	{
 		return;
@@ -90,6 +134,7 @@ void UUtilityLoadingNotification::SetError(const FString& NewText)
 	}
 
 	// 设置失败状态
+	StopProgress();
 	NotificationPtr.Pin()->SetCompletionState(SNotificationItem::CS_Fail);
 	NotificationPtr.Pin()->ExpireAndFadeout();
 
@@ -99,20 +144,67 @@ void UUtilityLoadingNotification::SetError(const FString& NewText)
 
 void UUtilityLoadingNotification::UpdateProgress(float Progress)
 {
-	if (!NotificationPtr.IsValid())
+	if (RejectReleasedCall(TEXT("UpdateProgress")))
 	{
 		return;
 	}
 
 	// 限制进度值在 0.0 - 1.0 之间
-	Progress = FMath::Clamp(Progress, 0.0f, 1.0f);
-	
-	// 注意：Slate 通知系统可能不直接支持进度条更新
-	// 这里可以根据需要扩展实现
+	ProgressFraction = FMath::Clamp(Progress, 0.0f, 1.0f);
+	ProgressTotal = 0;
+
+	if (bHeadless)
+	{
+		if (!bIsCompleted)
+		{
+			FUtilityExtendHeadlessNotifications::Get().UpdateProgress(NotificationId, ProgressFraction);
+		}
+		return;
+	}
+
+	// 这里不调用任何Slate接口，同一帧内的多次更新在下一帧合并为一次进度条更新
+	RequestProgressRefresh();
+}
+
+void UUtilityLoadingNotification::UpdateProgressCount(int32 Completed, int32 Total)
+{
+	if (RejectReleasedCall(TEXT("UpdateProgressCount")))
+	{
+		return;
+	}
+
+	ProgressTotal = FMath::Max(Total, 0);
+	ProgressCompleted = FMath::Clamp(Completed, 0, ProgressTotal);
+	ProgressFraction = ProgressTotal > 0 ? static_cast<float>(ProgressCompleted) / ProgressTotal : 0.0f;
+
+	if (bHeadless)
+	{
+		if (!bIsCompleted)
+		{
+			FUtilityExtendHeadlessNotifications::Get().UpdateProgress(NotificationId, ProgressFraction, ProgressCompleted, ProgressTotal);
+		}
+		return;
+	}
+
+	RequestProgressRefresh();
 }
 
 void UUtilityLoadingNotification::UpdateText(const FString& NewText)
 {
+	if (RejectReleasedCall(TEXT("UpdateText")))
+	{
+		return;
+	}
+
+	if (bHeadless)
+	{
+		if (!bIsCompleted)
+		{
+			FUtilityExtendHeadlessNotifications::Get().UpdateText(NotificationId, NewText);
+		}
+		return;
+	}
+
 	if (!NotificationPtr.IsValid())
 	{
 		return;
@@ -123,17 +215,28 @@ void UUtilityLoadingNotification::UpdateText(const FString& NewText)
 
 void UUtilityLoadingNotification::CloseNotification()
 {
+	if (RejectReleasedCall(TEXT("CloseNotification")))
+	{
+		return;
+	}
+
 	if (NotificationPtr.IsValid())
 	{
+		StopProgress();
 		NotificationPtr.Pin()->SetCompletionState(SNotificationItem::CS_None);
 		NotificationPtr.Pin()->ExpireAndFadeout();
 		NotificationPtr.Reset();
 	}
+	else if (bHeadless && !bIsCompleted)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(NotificationId, EEditorNotificationType::Default);
+	}
+	bIsCompleted = true;
 }
 
 bool UUtilityLoadingNotification::IsNotificationActive() const
 {
-	return NotificationPtr.IsValid() && !bIsCompleted;
+	return (NotificationPtr.IsValid() || bHeadless) && !bIsCompleted;
 }
 
 void UUtilityLoadingNotification::HandleButtonClick(int32 ButtonIndex, const FString& ButtonText)
@@ -156,3 +259,119 @@ void UUtilityLoadingNotification::HandleNotificationCompleted(bool bSuccess)
 	// 广播完成事件
 	OnCompleted.Broadcast(bSuccess);
 }
+
+void UUtilityLoadingNotification::Release()
+{
+	if (RejectReleasedCall(TEXT("Release")))
+	{
+		return;
+	}
+
+	UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+	if (NotificationSubsystem && NotificationSubsystem->ReleaseLoadingNotification(this))
+	{
+		return;
+	}
+
+	// 不是从对象池取出的对象，只关闭通知
+	CloseNotification();
+}
+
+void UUtilityLoadingNotification::BindNotificationItem(const TSharedPtr<SNotificationItem>& Item, FUtilityNotificationHandle Handle)
+{
+	NotificationPtr = Item;
+	NotificationHandle = Handle;
+	bIsCompleted = false;
+}
+
+void UUtilityLoadingNotification::BindHeadless(const FString& Id)
+{
+	NotificationPtr.Reset();
+	NotificationId = Id;
+	bHeadless = true;
+	bIsCompleted = false;
+}
+
+void UUtilityLoadingNotification::ResetForReuse()
+{
+	// 进度条属于上一次使用，复用前关闭
+	StopProgress();
+
+	// 无界面通知没有结束就被回收时输出关闭事件，同时释放它的进度抽样记录
+	if (bHeadless && !bIsCompleted)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(NotificationId, EEditorNotificationType::Default);
+	}
+
+	OnButtonClicked.Clear();
+	OnCompleted.Clear();
+	OnLoadingNotificationButtonClicked.Clear();
+	NotificationId.Reset();
+	Message.Reset();
+	bAutoRelease = true;
+
+	NotificationPtr.Reset();
+	NotificationHandle = FUtilityNotificationHandle();
+	CachedButtonTexts.Reset();
+	bIsCompleted = false;
+	bHeadless = false;
+
+	ProgressFraction = 0.0f;
+	ProgressCompleted = 0;
+	ProgressTotal = 0;
+
+	++UseSerial;
+	bReleasedToPool = true;
+	bWarnedReleasedCall = false;
+}
+
+void UUtilityLoadingNotification::MarkAcquired()
+{
+	bReleasedToPool = false;
+}
+
+bool UUtilityLoadingNotification::RejectReleasedCall(const TCHAR* FunctionName) const
+{
+	if (!bReleasedToPool)
+	{
+		return false;
+	}
+
+	// 对象已归还对象池，调用来自上一次使用遗留的引用；直接忽略，不影响对象池中的状态。循环中逐项调用时只警告一次
+	if (!bWarnedReleasedCall)
+	{
+		bWarnedReleasedCall = true;
+		UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 加载通知对象已回收到对象池，忽略 %s 调用"), FunctionName);
+	}
+	return true;
+}
+
+void UUtilityLoadingNotification::RequestProgressRefresh()
+{
+	// 单次Ticker在下一帧把最新进度应用到进度条，之前的多次更新只记录数值
+	if (!ProgressTickerHandle.IsValid() && NotificationPtr.IsValid())
+	{
+		ProgressTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UUtilityLoadingNotification::TickProgress), 0.0f);
+	}
+}
+
+bool UUtilityLoadingNotification::TickProgress(float DeltaTime)
+{
+	ProgressTickerHandle.Reset();
+	if (!bIsCompleted && NotificationPtr.IsValid())
+	{
+		ProgressBar.Update(FText::FromString(Message), FMath::RoundToInt(ProgressFraction * 1000.0f), ProgressCompleted, ProgressTotal);
+	}
+	return false;
+}
+
+void UUtilityLoadingNotification::StopProgress()
+{
+	if (ProgressTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressTickerHandle);
+		ProgressTickerHandle.Reset();
+	}
+	ProgressBar.Close();
+}
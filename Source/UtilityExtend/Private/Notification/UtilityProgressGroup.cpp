@@ -0,0 +1,424 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Notification/UtilityProgressGroup.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace UtilityProgressGroupUtils
+{
+	/** 通知刷新间隔（秒） */
+	constexpr float RefreshInterval = 0.1f;
+
+	/** 速度平滑的时间常数（秒），越大估算越稳定、对速度变化的反应越慢 */
+	constexpr double RateTimeConstant = 3.0;
+
+	/** 开始后经过该时间才显示剩余时间，避免最初几次采样的速度波动 */
+	constexpr double EtaWarmupSeconds = 1.0;
+
+	/** 把秒数格式化为 mm:ss 或 h:mm:ss */
+	FString FormatDuration(double Seconds)
+	{
+		const int64 TotalSeconds = FMath::Max<int64>(0, FMath::CeilToInt64(Seconds));
+		const int64 Hours = TotalSeconds / 3600;
+		const int64 Minutes = (TotalSeconds / 60) % 60;
+		const int64 RemainSeconds = TotalSeconds % 60;
+		return Hours > 0
+			? FString::Printf(TEXT("%lld:%02lld:%02lld"), Hours, Minutes, RemainSeconds)
+			: FString::Printf(TEXT("%02lld:%02lld"), Minutes, RemainSeconds);
+	}
+
+	/** 数量超过int32时截断到int32上限 */
+	int32 ClampItems(int64 Items)
+	{
+		return static_cast<int32>(FMath::Min<int64>(Items, MAX_int32));
+	}
+}
+
+int32 FUtilityProgressGroupState::AddTask(const FString& Name, float Weight, int32 TotalItems)
+{
+	TUniquePtr<FTask> Task = MakeUnique<FTask>();
+	Task->Name = Name;
+	Task->Weight = FMath::Max(Weight, 0.0f);
+	Task->TotalItems = FMath::Max(TotalItems, 0);
+
+	FWriteScopeLock WriteLock(TasksLock);
+	return Tasks.Add(MoveTemp(Task));
+}
+
+void FUtilityProgressGroupState::SetTaskProgress(int32 TaskIndex, float Progress)
+{
+	if (FTask* Task = FindTask(TaskIndex))
+	{
+		Task->ProgressPpm.store(FMath::RoundToInt(FMath::Clamp(Progress, 0.0f, 1.0f) * 1000000.0f), std::memory_order_relaxed);
+	}
+}
+
+void FUtilityProgressGroupState::SetTaskCompletedItems(int32 TaskIndex, int32 CompletedItems)
+{
+	if (FTask* Task = FindTask(TaskIndex))
+	{
+		const int32 Clamped = Task->TotalItems > 0 ? FMath::Clamp(CompletedItems, 0, Task->TotalItems) : FMath::Max(CompletedItems, 0);
+		Task->CompletedItems.store(Clamped, std::memory_order_relaxed);
+		if (Task->TotalItems > 0)
+		{
+			Task->ProgressPpm.store(static_cast<int32>(static_cast<int64>(Clamped) * 1000000 / Task->TotalItems), std::memory_order_relaxed);
+		}
+	}
+}
+
+void FUtilityProgressGroupState::CompleteTask(int32 TaskIndex, bool bSuccess)
+{
+	if (FTask* Task = FindTask(TaskIndex))
+	{
+		Task->ProgressPpm.store(1000000, std::memory_order_relaxed);
+		if (Task->TotalItems > 0)
+		{
+			Task->CompletedItems.store(Task->TotalItems, std::memory_order_relaxed);
+		}
+		Task->State.store(bSuccess ? ETaskState::Succeeded : ETaskState::Failed, std::memory_order_release);
+	}
+}
+
+FUtilityProgressGroupState::FSnapshot FUtilityProgressGroupState::TakeSnapshot() const
+{
+	FSnapshot Snapshot;
+	double TotalWeight = 0.0;
+	double WeightedProgress = 0.0;
+
+	FReadScopeLock ReadLock(TasksLock);
+	Snapshot.TaskCount = Tasks.Num();
+	for (const TUniquePtr<FTask>& Task : Tasks)
+	{
+		const ETaskState TaskState = Task->State.load(std::memory_order_acquire);
+		TotalWeight += Task->Weight;
+		WeightedProgress += Task->Weight * Task->ProgressPpm.load(std::memory_order_relaxed) / 1000000.0;
+
+		if (Task->TotalItems > 0)
+		{
+			Snapshot.TotalItems += Task->TotalItems;
+			Snapshot.CompletedItems += Task->CompletedItems.load(std::memory_order_relaxed);
+		}
+
+		if (TaskState != ETaskState::Running)
+		{
+			++Snapshot.FinishedTaskCount;
+			Snapshot.FailedTaskCount += TaskState == ETaskState::Failed ? 1 : 0;
+		}
+	}
+
+	Snapshot.Fraction = TotalWeight > 0.0 ? FMath::Clamp(WeightedProgress / TotalWeight, 0.0, 1.0) : 0.0;
+	return Snapshot;
+}
+
+FUtilityProgressGroupState::FTask* FUtilityProgressGroupState::FindTask(int32 TaskIndex) const
+{
+	FReadScopeLock ReadLock(TasksLock);
+	return Tasks.IsValidIndex(TaskIndex) ? Tasks[TaskIndex].Get() : nullptr;
+}
+
+bool UUtilityProgressGroup::Start(const FString& InTitle)
+{
+	Title = InTitle;
+
+	TSharedPtr<SNotificationItem> Item;
+	if (FUtilityExtendHeadlessNotifications::IsHeadless())
+	{
+		// 命令行工具和-unattended自动化中没有Slate，开始、进度和结束改写到无界面输出
+		FUtilityExtendHeadlessNotifications& Headless = FUtilityExtendHeadlessNotifications::Get();
+		HeadlessId = Headless.AllocateId();
+		bHeadless = true;
+		Headless.Begin(HeadlessId, Title, FString());
+	}
+	else
+	{
+		FNotificationInfo Info(FText::FromString(Title));
+		Info.bUseThrobber = true;
+		Info.FadeInDuration = 0.1f;
+		Info.FadeOutDuration = 0.5f;
+		Info.ExpireDuration = 0.0f;
+		Info.bUseLargeFont = false;
+		Info.bFireAndForget = false;
+		Info.bAllowThrottleWhenFrameRateIsLow = false;
+
+		Item = FSlateNotificationManager::Get().AddNotification(Info);
+		if (!Item.IsValid())
+		{
+			return false;
+		}
+		Item->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+	{
+		if (Item.IsValid())
+		{
+			NotificationHandle = NotificationSubsystem->Register(Item, false, this);
+		}
+		NotificationSubsystem->AddHistoryRecord(Title, EEditorNotificationType::Default, FString());
+
+		// 蓝图通常只在局部变量中保存进度组，运行期间由子系统持有，避免长时间操作中被回收而提前关闭通知
+		NotificationSubsystem->AddActiveProgressGroup(this);
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	LastSampleTime = StartTime;
+	ProgressTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UUtilityProgressGroup::TickProgress),
+		UtilityProgressGroupUtils::RefreshInterval);
+	return true;
+}
+
+int32 UUtilityProgressGroup::AddTask(const FString& TaskName, float Weight, int32 TotalItems)
+{
+	return State->AddTask(TaskName, Weight, TotalItems);
+}
+
+void UUtilityProgressGroup::SetTaskProgress(int32 TaskIndex, float Progress)
+{
+	State->SetTaskProgress(TaskIndex, Progress);
+	RefreshHeadless(false);
+}
+
+void UUtilityProgressGroup::SetTaskCompletedItems(int32 TaskIndex, int32 CompletedItems)
+{
+	State->SetTaskCompletedItems(TaskIndex, CompletedItems);
+	RefreshHeadless(false);
+}
+
+void UUtilityProgressGroup::CompleteTask(int32 TaskIndex, bool bSuccess)
+{
+	State->CompleteTask(TaskIndex, bSuccess);
+	RefreshHeadless(true);
+}
+
+void UUtilityProgressGroup::SealTasks()
+{
+	bTasksSealed = true;
+	RefreshHeadless(true);
+}
+
+void UUtilityProgressGroup::Finish(bool bSuccess, const FString& FinalText)
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+	StopTicker();
+	ReleaseFromSubsystem();
+
+	const FUtilityProgressGroupState::FSnapshot Snapshot = State->TakeSnapshot();
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	const FString Summary = FString::Printf(TEXT("%d/%d 个任务完成，用时 %s"),
+		Snapshot.FinishedTaskCount, Snapshot.TaskCount, *UtilityProgressGroupUtils::FormatDuration(ElapsedSeconds));
+
+	if (bHeadless)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(HeadlessId,
+			bSuccess ? EEditorNotificationType::Success : EEditorNotificationType::Error,
+			FString::Printf(TEXT("%s\n%s"), FinalText.IsEmpty() ? *Title : *FinalText, *Summary));
+		return;
+	}
+
+	const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+	const TSharedPtr<SNotificationItem> Item = NotificationSubsystem ? NotificationSubsystem->Find(NotificationHandle) : nullptr;
+	if (!Item.IsValid())
+	{
+		return;
+	}
+
+	if (!FinalText.IsEmpty())
+	{
+		Item->SetText(FText::FromString(FinalText));
+	}
+	Item->SetSubText(FText::FromString(Summary));
+	Item->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+	Item->ExpireAndFadeout();
+}
+
+void UUtilityProgressGroup::Cancel()
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+	StopTicker();
+	ReleaseFromSubsystem();
+	CloseNotification();
+}
+
+float UUtilityProgressGroup::GetProgress() const
+{
+	return static_cast<float>(State->TakeSnapshot().Fraction);
+}
+
+float UUtilityProgressGroup::GetEstimatedSecondsRemaining() const
+{
+	if (SmoothedFractionRate <= UE_SMALL_NUMBER || FPlatformTime::Seconds() - StartTime < UtilityProgressGroupUtils::EtaWarmupSeconds)
+	{
+		return -1.0f;
+	}
+	return static_cast<float>((1.0 - CurrentFraction) / SmoothedFractionRate);
+}
+
+void UUtilityProgressGroup::BeginDestroy()
+{
+	// 运行中的进度组由子系统持有，被回收时仍未结束只可能是子系统已经关闭，关闭通知避免加载动画一直停留
+	if (!bFinished && UObjectInitialized())
+	{
+		StopTicker();
+		CloseNotification();
+		bFinished = true;
+	}
+
+	Super::BeginDestroy();
+}
+
+bool UUtilityProgressGroup::TickProgress(float DeltaTime)
+{
+	// 在Ticker回调中结束时由返回值移除Ticker，刷新期间先清空句柄，避免Finish在回调中移除自身
+	const FTSTicker::FDelegateHandle TickerHandle = ProgressTickerHandle;
+	ProgressTickerHandle.Reset();
+	if (!Refresh())
+	{
+		return false;
+	}
+	ProgressTickerHandle = TickerHandle;
+	return true;
+}
+
+void UUtilityProgressGroup::RefreshHeadless(bool bForce)
+{
+	// 命令行工具中Ticker不一定运行，无界面时由上报进度的调用驱动刷新，按刷新间隔节流
+	if (bHeadless && !bFinished
+		&& (bForce || FPlatformTime::Seconds() - LastSampleTime >= UtilityProgressGroupUtils::RefreshInterval))
+	{
+		Refresh();
+	}
+}
+
+bool UUtilityProgressGroup::Refresh()
+{
+	TSharedPtr<SNotificationItem> Item;
+	if (!bHeadless)
+	{
+		const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get();
+		Item = NotificationSubsystem ? NotificationSubsystem->Find(NotificationHandle) : nullptr;
+		if (!Item.IsValid())
+		{
+			// 通知已被关闭
+			ProgressBar.Close();
+			bFinished = true;
+			ReleaseFromSubsystem();
+			return false;
+		}
+	}
+
+	const FUtilityProgressGroupState::FSnapshot Snapshot = State->TakeSnapshot();
+	const double Now = FPlatformTime::Seconds();
+	const double SampleSeconds = Now - LastSampleTime;
+	CurrentFraction = Snapshot.Fraction;
+
+	// 指数平滑：按采样间隔计算平滑系数，刷新间隔抖动时估算依然稳定
+	if (SampleSeconds > UE_SMALL_NUMBER)
+	{
+		const double Alpha = 1.0 - FMath::Exp(-SampleSeconds / UtilityProgressGroupUtils::RateTimeConstant);
+		const double FractionRate = FMath::Max(0.0, Snapshot.Fraction - LastSampleFraction) / SampleSeconds;
+		const double ItemRate = FMath::Max<int64>(0, Snapshot.CompletedItems - LastSampleItems) / SampleSeconds;
+		const bool bFirstSample = LastSampleTime == StartTime;
+		SmoothedFractionRate = bFirstSample ? FractionRate : SmoothedFractionRate + Alpha * (FractionRate - SmoothedFractionRate);
+		SmoothedItemRate = bFirstSample ? ItemRate : SmoothedItemRate + Alpha * (ItemRate - SmoothedItemRate);
+		LastSampleTime = Now;
+		LastSampleFraction = Snapshot.Fraction;
+		LastSampleItems = Snapshot.CompletedItems;
+	}
+
+	// 声明不再添加任务后，所有任务完成时自动结束；未声明时后续可能还会添加任务，等待调用Finish
+	if (bTasksSealed && Snapshot.TaskCount > 0 && Snapshot.FinishedTaskCount == Snapshot.TaskCount)
+	{
+		Finish(Snapshot.FailedTaskCount == 0);
+		return false;
+	}
+
+	if (bHeadless)
+	{
+		// 进度按无界面输出的间隔抽样；文本只在任务数变化时输出，并受无界面输出的频率限制
+		FUtilityExtendHeadlessNotifications& Headless = FUtilityExtendHeadlessNotifications::Get();
+		Headless.UpdateProgress(HeadlessId, static_cast<float>(Snapshot.Fraction),
+			UtilityProgressGroupUtils::ClampItems(Snapshot.CompletedItems), UtilityProgressGroupUtils::ClampItems(Snapshot.TotalItems));
+
+		FString Text = FString::Printf(TEXT("%s（%d/%d 个任务）"), *Title, Snapshot.FinishedTaskCount, Snapshot.TaskCount);
+		if (Text != DisplayedSubText)
+		{
+			DisplayedSubText = MoveTemp(Text);
+			Headless.UpdateText(HeadlessId, DisplayedSubText);
+		}
+		return true;
+	}
+
+	// 进度条按加权后的总进度显示，任务的完成数量只是其中一部分，不能代替总进度
+	const int32 Permille = FMath::RoundToInt(Snapshot.Fraction * 1000.0);
+	ProgressBar.Update(FText::FromString(Title), Permille, 0, 0);
+
+	FString SubText = FString::Printf(TEXT("%d.%d%%  %d/%d 个任务"), Permille / 10, Permille % 10, Snapshot.FinishedTaskCount, Snapshot.TaskCount);
+	if (Snapshot.TotalItems > 0)
+	{
+		SubText.Appendf(TEXT("  (%lld/%lld)"), Snapshot.CompletedItems, Snapshot.TotalItems);
+	}
+	if (Snapshot.TotalItems > 0)
+	{
+		SubText.Appendf(TEXT("  %.1f 项/秒"), SmoothedItemRate);
+	}
+
+	const float EtaSeconds = GetEstimatedSecondsRemaining();
+	if (EtaSeconds >= 0.0f)
+	{
+		SubText.Appendf(TEXT("  剩余 %s"), *UtilityProgressGroupUtils::FormatDuration(EtaSeconds));
+	}
+
+	// 内容不变时不刷新通知
+	if (SubText != DisplayedSubText)
+	{
+		DisplayedSubText = MoveTemp(SubText);
+		Item->SetSubText(FText::FromString(DisplayedSubText));
+	}
+	return true;
+}
+
+void UUtilityProgressGroup::CloseNotification()
+{
+	if (bHeadless)
+	{
+		FUtilityExtendHeadlessNotifications::Get().Complete(HeadlessId, EEditorNotificationType::Default);
+		return;
+	}
+
+	if (const UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+	{
+		if (const TSharedPtr<SNotificationItem> Item = NotificationSubsystem->Find(NotificationHandle))
+		{
+			Item->SetCompletionState(SNotificationItem::CS_None);
+			Item->ExpireAndFadeout();
+		}
+	}
+}
+
+void UUtilityProgressGroup::ReleaseFromSubsystem()
+{
+	if (UUtilityExtendNotificationSubsystem* NotificationSubsystem = UUtilityExtendNotificationSubsystem::Get())
+	{
+		NotificationSubsystem->RemoveActiveProgressGroup(this);
+	}
+}
+
+void UUtilityProgressGroup::StopTicker()
+{
+	if (ProgressTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ProgressTickerHandle);
+		ProgressTickerHandle.Reset();
+	}
+	ProgressBar.Close();
+}
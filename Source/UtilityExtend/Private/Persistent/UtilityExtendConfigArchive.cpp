@@ -0,0 +1,790 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigArchive.h"
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UtilityExtendConfigArchiveUtils
+{
+    /**
+     * 格式标记：高16位固定，低8位为格式版本，8~15位为数据类型
+     * 按旧格式解释时是一个长度为负十亿级的字符串前缀，不可能出现在旧数据中
+     */
+    static constexpr uint32 MarkerMask = 0xFFFF0000;
+    static constexpr uint32 MarkerBits = 0xBC5E0000;
+
+    /** 标记中的数据类型 */
+    enum class EBlockKind : uint8
+    {
+        Button = 0,
+        Item = 1,
+        ConfigList = 2
+    };
+
+    /** 字段类型：变长整数，或带长度前缀的字节块 */
+    enum class EWireType : uint32
+    {
+        Varint = 0,
+        Bytes = 1
+    };
+
+    /** 按钮字段编号，只能新增，不能复用 */
+    enum class EButtonField : uint32
+    {
+        End = 0,
+        Name = 1,
+        Type = 2,
+        Icon = 3,
+        ShowText = 4,
+        ClassPackage = 5,
+        ClassAsset = 6,
+        Items = 7
+    };
+
+    /** 下拉项字段编号，只能新增，不能复用 */
+    enum class EItemField : uint32
+    {
+        End = 0,
+        Name = 1,
+        ClassPackage = 2,
+        ClassAsset = 3
+    };
+
+    /** 引用收集、内存统计等既不读也不写的归档不处理，避免被当作读取而重置数据 */
+    bool IsDataArchive(const FArchive& Ar)
+    {
+        return Ar.IsLoading() || Ar.IsSaving();
+    }
+
+    uint32 MakeMarker(EBlockKind Kind)
+    {
+        return MarkerBits | (static_cast<uint32>(Kind) << 8) | FUtilityExtendConfigArchive::FormatVersion;
+    }
+
+    /** 加载时检查即将读取的数据量是否超出归档剩余大小，防止损坏的数据触发超大分配 */
+    bool IsLoadSizePlausible(FArchive& Ar, int64 ByteCount)
+    {
+        const int64 TotalSize = Ar.TotalSize();
+        const int64 Offset = Ar.Tell();
+        if (TotalSize < 0 || Offset < 0)
+        {
+            // 大小未知的归档无法检查
+            return ByteCount >= 0;
+        }
+        return ByteCount >= 0 && ByteCount <= TotalSize - Offset;
+    }
+
+    // ========================= 变长整数 =========================
+
+    /** 写入LEB128变长整数，小于128的值只占一个字节 */
+    void WriteVarint(FArchive& Ar, uint32 Value)
+    {
+        do
+        {
+            uint8 Byte = static_cast<uint8>(Value & 0x7F);
+            Value >>= 7;
+            if (Value != 0)
+            {
+                Byte |= 0x80;
+            }
+            Ar << Byte;
+        }
+        while (Value != 0);
+    }
+
+    /**
+     * 读取LEB128变长整数
+     * 不使用FArchive::SerializeIntPacked：读过归档末尾时它会继续使用未初始化的字节，损坏的数据可能导致死循环
+     */
+    bool ReadVarint(FArchive& Ar, uint32& OutValue)
+    {
+        OutValue = 0;
+        for (int32 Shift = 0; Shift < 35; Shift += 7)
+        {
+            uint8 Byte = 0;
+            Ar << Byte;
+            if (Ar.IsError())
+            {
+                return false;
+            }
+            OutValue |= static_cast<uint32>(Byte & 0x7F) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+
+        // 超过5个字节的变长整数只可能是损坏的数据
+        Ar.SetError();
+        return false;
+    }
+
+    /** 读取计数，并按每个元素至少占用的字节数检查是否超出归档剩余大小 */
+    bool ReadCount(FArchive& Ar, int32 MinBytesPerElement, int32& OutCount)
+    {
+        uint32 Count = 0;
+        if (!ReadVarint(Ar, Count) || Count > MAX_int32 || !IsLoadSizePlausible(Ar, static_cast<int64>(Count) * MinBytesPerElement))
+        {
+            Ar.SetError();
+            return false;
+        }
+        OutCount = static_cast<int32>(Count);
+        return true;
+    }
+
+    void WriteTag(FArchive& Ar, uint32 Field, EWireType WireType)
+    {
+        WriteVarint(Ar, (Field << 1) | static_cast<uint32>(WireType));
+    }
+
+    /** 跳过不认识的字段 */
+    bool SkipField(FArchive& Ar, EWireType WireType)
+    {
+        uint32 Value = 0;
+        if (!ReadVarint(Ar, Value))
+        {
+            return false;
+        }
+        if (WireType == EWireType::Varint)
+        {
+            return true;
+        }
+
+        if (!IsLoadSizePlausible(Ar, Value))
+        {
+            Ar.SetError();
+            return false;
+        }
+        TArray<uint8> Skipped;
+        Skipped.SetNumUninitialized(Value);
+        Ar.Serialize(Skipped.GetData(), Value);
+        return !Ar.IsError();
+    }
+
+    // ========================= 字符串表 =========================
+
+    /** 字符串表的键区分大小写，按钮名称只差大小写时也要分别保存 */
+    struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, false>
+    {
+        static const FString& GetSetKey(const TPair<FString, uint32>& Element)
+        {
+            return Element.Key;
+        }
+
+        static bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(const FString& Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    /** 写入时收集不重复的字符串，0号固定为空字符串且不写入 */
+    struct FStringTableWriter
+    {
+        TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> Indices;
+
+        uint32 Add(const FString& Value)
+        {
+            if (Value.IsEmpty())
+            {
+                return 0;
+            }
+            if (const uint32* Existing = Indices.Find(Value))
+            {
+                return *Existing;
+            }
+            const uint32 Index = Indices.Num() + 1;
+            Indices.Add(Value, Index);
+            return Index;
+        }
+
+        /** TMap在只添加不删除时保持插入顺序，迭代顺序就是索引顺序 */
+        void Write(FArchive& Ar) const
+        {
+            WriteVarint(Ar, Indices.Num());
+            for (const TPair<FString, uint32>& Pair : Indices)
+            {
+                const FTCHARToUTF8 Utf8(*Pair.Key, Pair.Key.Len());
+                WriteVarint(Ar, Utf8.Length());
+                Ar.Serialize(const_cast<void*>(static_cast<const void*>(Utf8.Get())), Utf8.Length());
+            }
+        }
+    };
+
+    /** 读取字符串表，0号为空字符串 */
+    bool ReadStringTable(FArchive& Ar, TArray<FString>& OutStrings)
+    {
+        int32 Count = 0;
+        if (!ReadCount(Ar, 1, Count))
+        {
+            return false;
+        }
+
+        OutStrings.Reset(Count + 1);
+        OutStrings.AddDefaulted();
+
+        TArray<uint8> Bytes;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            int32 Length = 0;
+            if (!ReadCount(Ar, 1, Length))
+            {
+                return false;
+            }
+            Bytes.SetNumUninitialized(Length, EAllowShrinking::No);
+            Ar.Serialize(Bytes.GetData(), Length);
+            if (Ar.IsError())
+            {
+                return false;
+            }
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Length);
+            OutStrings.Emplace(Converted.Length(), Converted.Get());
+        }
+        return true;
+    }
+
+    /** 读取字符串索引并查表 */
+    bool ReadStringIndex(FArchive& Ar, const TArray<FString>& Strings, const FString*& OutValue)
+    {
+        uint32 Index = 0;
+        if (!ReadVarint(Ar, Index) || Index >= static_cast<uint32>(Strings.Num()))
+        {
+            Ar.SetError();
+            return false;
+        }
+        OutValue = &Strings[Index];
+        return true;
+    }
+
+    // ========================= 脚本类路径 =========================
+
+    /**
+     * 把脚本类路径拆成包路径和资源名两个字符串
+     * 例如/Game/Tools/BS_Tools.BS_Tools_C拆为/Game/Tools/BS_Tools和.BS_Tools_C，同一个包只写一次；
+     * 资源名保留开头的'.'，直接拼接即可还原原路径
+     */
+    void SplitClassPath(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& SoftClass, FString& OutPackage, FString& OutAsset)
+    {
+        OutPackage.Reset();
+        OutAsset.Reset();
+        if (SoftClass.IsNull())
+        {
+            return;
+        }
+
+        const FString ClassPath = FUtilityExtendConfigJson::SoftClassToConfigString(SoftClass);
+        int32 DotIndex = INDEX_NONE;
+        if (ClassPath.FindChar(TEXT('.'), DotIndex))
+        {
+            OutPackage = ClassPath.Left(DotIndex);
+            OutAsset = ClassPath.Mid(DotIndex);
+        }
+        else
+        {
+            OutPackage = ClassPath;
+        }
+    }
+
+    TSoftClassPtr<UUtilityExtendTopBarButtonScript> JoinClassPath(const FString& Package, const FString& Asset)
+    {
+        if (Package.IsEmpty())
+        {
+            return TSoftClassPtr<UUtilityExtendTopBarButtonScript>();
+        }
+        return FUtilityExtendConfigJson::ConfigStringToSoftClass(Package + Asset);
+    }
+
+    // ========================= 字段写入 =========================
+
+    void WriteStringField(FArchive& Ar, FStringTableWriter& Table, uint32 Field, const FString& Value)
+    {
+        const uint32 Index = Table.Add(Value);
+        if (Index != 0)
+        {
+            WriteTag(Ar, Field, EWireType::Varint);
+            WriteVarint(Ar, Index);
+        }
+    }
+
+    /** 写入下拉项字段，字符串只登记到表中，正文写索引 */
+    void WriteItemFields(FArchive& Ar, FStringTableWriter& Table, const FToolbarDropdownItem& Item)
+    {
+        FString Package;
+        FString Asset;
+        SplitClassPath(Item.BoundClass, Package, Asset);
+
+        WriteStringField(Ar, Table, static_cast<uint32>(EItemField::Name), Item.ItemName);
+        WriteStringField(Ar, Table, static_cast<uint32>(EItemField::ClassPackage), Package);
+        WriteStringField(Ar, Table, static_cast<uint32>(EItemField::ClassAsset), Asset);
+        WriteVarint(Ar, static_cast<uint32>(EItemField::End));
+    }
+
+    void WriteButtonFields(FArchive& Ar, FStringTableWriter& Table, const FToolbarButtonConfig& Config)
+    {
+        FString Package;
+        FString Asset;
+        FString Icon;
+        SplitClassPath(Config.BoundClass, Package, Asset);
+        if (!Config.ButtonIconName.IsNone())
+        {
+            Icon = Config.ButtonIconName.ToString();
+        }
+
+        WriteStringField(Ar, Table, static_cast<uint32>(EButtonField::Name), Config.ButtonName);
+        WriteTag(Ar, static_cast<uint32>(EButtonField::Type), EWireType::Varint);
+        WriteVarint(Ar, static_cast<uint32>(Config.ButtonType));
+        WriteStringField(Ar, Table, static_cast<uint32>(EButtonField::Icon), Icon);
+        WriteTag(Ar, static_cast<uint32>(EButtonField::ShowText), EWireType::Varint);
+        WriteVarint(Ar, Config.bShowButtonText ? 1 : 0);
+        WriteStringField(Ar, Table, static_cast<uint32>(EButtonField::ClassPackage), Package);
+        WriteStringField(Ar, Table, static_cast<uint32>(EButtonField::ClassAsset), Asset);
+
+        if (Config.DropdownItems.Num() > 0)
+        {
+            // 下拉项放在带长度的字节块中，旧版本不认识下拉项的新字段时也能整体跳过
+            TArray<uint8> ItemBytes;
+            FMemoryWriter ItemWriter(ItemBytes);
+            WriteVarint(ItemWriter, Config.DropdownItems.Num());
+            for (const FToolbarDropdownItem& Item : Config.DropdownItems)
+            {
+                WriteItemFields(ItemWriter, Table, Item);
+            }
+
+            WriteTag(Ar, static_cast<uint32>(EButtonField::Items), EWireType::Bytes);
+            WriteVarint(Ar, ItemBytes.Num());
+            Ar.Serialize(ItemBytes.GetData(), ItemBytes.Num());
+        }
+
+        WriteVarint(Ar, static_cast<uint32>(EButtonField::End));
+    }
+
+    /** 先写正文收集字符串，再按“标记、字符串表、正文”的顺序输出 */
+    void WriteBlock(FArchive& Ar, EBlockKind Kind, TFunctionRef<void(FArchive&, FStringTableWriter&)> WriteBody)
+    {
+        FStringTableWriter Table;
+        TArray<uint8> Body;
+        {
+            FMemoryWriter BodyWriter(Body);
+            WriteBody(BodyWriter, Table);
+        }
+
+        uint32 Marker = MakeMarker(Kind);
+        Ar << Marker;
+        Table.Write(Ar);
+        Ar.Serialize(Body.GetData(), Body.Num());
+    }
+
+    // ========================= 字段读取 =========================
+
+    /** 读取字段标记，返回false表示读取失败；字段编号为End时结束 */
+    bool ReadTag(FArchive& Ar, uint32& OutField, EWireType& OutWireType)
+    {
+        uint32 Tag = 0;
+        if (!ReadVarint(Ar, Tag))
+        {
+            return false;
+        }
+        OutField = Tag >> 1;
+        OutWireType = static_cast<EWireType>(Tag & 1);
+        return true;
+    }
+
+    bool ReadItemFields(FArchive& Ar, const TArray<FString>& Strings, FToolbarDropdownItem& OutItem)
+    {
+        OutItem = FToolbarDropdownItem();
+        const FString* Package = &Strings[0];
+        const FString* Asset = &Strings[0];
+
+        uint32 Field = 0;
+        EWireType WireType = EWireType::Varint;
+        while (ReadTag(Ar, Field, WireType))
+        {
+            if (Field == static_cast<uint32>(EItemField::End))
+            {
+                OutItem.BoundClass = JoinClassPath(*Package, *Asset);
+                return true;
+            }
+
+            const FString* Value = nullptr;
+            bool bRead = true;
+            if (WireType != EWireType::Varint)
+            {
+                bRead = SkipField(Ar, WireType);
+            }
+            else if (Field == static_cast<uint32>(EItemField::Name))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Value);
+                OutItem.ItemName = bRead ? *Value : FString();
+            }
+            else if (Field == static_cast<uint32>(EItemField::ClassPackage))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Package);
+            }
+            else if (Field == static_cast<uint32>(EItemField::ClassAsset))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Asset);
+            }
+            else
+            {
+                bRead = SkipField(Ar, WireType);
+            }
+
+            if (!bRead)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool ReadItems(FArchive& Ar, const TArray<FString>& Strings, TArray<FToolbarDropdownItem>& OutItems)
+    {
+        uint32 ByteCount = 0;
+        if (!ReadVarint(Ar, ByteCount) || !IsLoadSizePlausible(Ar, ByteCount))
+        {
+            Ar.SetError();
+            return false;
+        }
+
+        TArray<uint8> ItemBytes;
+        ItemBytes.SetNumUninitialized(ByteCount);
+        Ar.Serialize(ItemBytes.GetData(), ByteCount);
+        if (Ar.IsError())
+        {
+            return false;
+        }
+
+        // 字节块中剩余的数据属于更新版本写入的内容，读完已知的下拉项后忽略
+        FMemoryReader ItemReader(ItemBytes);
+        int32 ItemCount = 0;
+        if (!ReadCount(ItemReader, 1, ItemCount))
+        {
+            Ar.SetError();
+            return false;
+        }
+
+        OutItems.SetNum(ItemCount);
+        for (FToolbarDropdownItem& Item : OutItems)
+        {
+            if (!ReadItemFields(ItemReader, Strings, Item))
+            {
+                Ar.SetError();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadButtonFields(FArchive& Ar, const TArray<FString>& Strings, FToolbarButtonConfig& OutConfig)
+    {
+        OutConfig = FToolbarButtonConfig();
+        const FString* Package = &Strings[0];
+        const FString* Asset = &Strings[0];
+
+        uint32 Field = 0;
+        EWireType WireType = EWireType::Varint;
+        while (ReadTag(Ar, Field, WireType))
+        {
+            if (Field == static_cast<uint32>(EButtonField::End))
+            {
+                OutConfig.BoundClass = JoinClassPath(*Package, *Asset);
+                return true;
+            }
+
+            const FString* Value = nullptr;
+            uint32 Number = 0;
+            bool bRead = true;
+            if (Field == static_cast<uint32>(EButtonField::Items) && WireType == EWireType::Bytes)
+            {
+                bRead = ReadItems(Ar, Strings, OutConfig.DropdownItems);
+            }
+            else if (WireType != EWireType::Varint)
+            {
+                bRead = SkipField(Ar, WireType);
+            }
+            else if (Field == static_cast<uint32>(EButtonField::Name))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Value);
+                OutConfig.ButtonName = bRead ? *Value : FString();
+            }
+            else if (Field == static_cast<uint32>(EButtonField::Type))
+            {
+                bRead = ReadVarint(Ar, Number) && Number <= static_cast<uint32>(EToolbarButtonType::DropdownButton);
+                OutConfig.ButtonType = bRead ? static_cast<EToolbarButtonType>(Number) : EToolbarButtonType::SingleButton;
+            }
+            else if (Field == static_cast<uint32>(EButtonField::Icon))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Value);
+                OutConfig.ButtonIconName = bRead && !Value->IsEmpty() ? FName(**Value) : NAME_None;
+            }
+            else if (Field == static_cast<uint32>(EButtonField::ShowText))
+            {
+                bRead = ReadVarint(Ar, Number);
+                OutConfig.bShowButtonText = Number != 0;
+            }
+            else if (Field == static_cast<uint32>(EButtonField::ClassPackage))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Package);
+            }
+            else if (Field == static_cast<uint32>(EButtonField::ClassAsset))
+            {
+                bRead = ReadStringIndex(Ar, Strings, Asset);
+            }
+            else
+            {
+                bRead = SkipField(Ar, WireType);
+            }
+
+            if (!bRead)
+            {
+                Ar.SetError();
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * 读取并校验格式标记
+     * @return 1表示新格式，0表示不带标记的旧格式（归档位置不变），-1表示标记无效
+     */
+    int32 ReadMarker(FArchive& Ar, EBlockKind Kind, bool bAllowLegacy)
+    {
+        const int64 MarkerOffset = Ar.Tell();
+        uint32 Marker = 0;
+        Ar << Marker;
+        if (Ar.IsError())
+        {
+            return -1;
+        }
+
+        if ((Marker & MarkerMask) != MarkerBits)
+        {
+            if (bAllowLegacy && MarkerOffset >= 0)
+            {
+                Ar.Seek(MarkerOffset);
+                return 0;
+            }
+            Ar.SetError();
+            return -1;
+        }
+
+        // 格式版本更高的数据字段含义可能已经变化，不能按当前版本读取
+        const uint32 Version = Marker & 0xFF;
+        const uint32 MarkerKind = (Marker >> 8) & 0xFF;
+        if (MarkerKind != static_cast<uint32>(Kind) || Version < 2 || Version > FUtilityExtendConfigArchive::FormatVersion)
+        {
+            Ar.SetError();
+            return -1;
+        }
+        return 1;
+    }
+
+    // ========================= 旧格式读取 =========================
+
+    /** 读取旧格式的字符串，先校验长度前缀 */
+    bool LoadLegacyString(FArchive& Ar, FString& Value)
+    {
+        if (Ar.TotalSize() >= 0 && Ar.Tell() >= 0)
+        {
+            const int64 LengthOffset = Ar.Tell();
+            int32 SaveNum = 0;
+            Ar << SaveNum;
+            Ar.Seek(LengthOffset);
+
+            // 负数长度表示按UTF-16存储
+            const int64 ByteCount = SaveNum < 0 ? -static_cast<int64>(SaveNum) * 2 : static_cast<int64>(SaveNum);
+            if (Ar.IsError() || !IsLoadSizePlausible(Ar, ByteCount + static_cast<int64>(sizeof(int32))))
+            {
+                Ar.SetError();
+                return false;
+            }
+        }
+
+        Ar << Value;
+        return !Ar.IsError();
+    }
+
+    /** 旧格式中的脚本类路径，"None"表示未设置 */
+    bool LoadLegacyClass(FArchive& Ar, TSoftClassPtr<UUtilityExtendTopBarButtonScript>& OutClass)
+    {
+        FString ClassPath;
+        if (!LoadLegacyString(Ar, ClassPath))
+        {
+            return false;
+        }
+        OutClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(ClassPath);
+        return true;
+    }
+
+    bool LoadLegacyItem(FArchive& Ar, FToolbarDropdownItem& OutItem)
+    {
+        return LoadLegacyString(Ar, OutItem.ItemName) && LoadLegacyClass(Ar, OutItem.BoundClass);
+    }
+
+    bool LoadLegacyButton(FArchive& Ar, FToolbarButtonConfig& OutConfig)
+    {
+        if (!LoadLegacyString(Ar, OutConfig.ButtonName))
+        {
+            return false;
+        }
+
+        uint8 ButtonTypeValue = 0;
+        Ar << ButtonTypeValue;
+        if (Ar.IsError() || ButtonTypeValue > static_cast<uint8>(EToolbarButtonType::DropdownButton))
+        {
+            Ar.SetError();
+            return false;
+        }
+        OutConfig.ButtonType = static_cast<EToolbarButtonType>(ButtonTypeValue);
+
+        FString IconNameStr;
+        if (!LoadLegacyString(Ar, IconNameStr))
+        {
+            return false;
+        }
+        OutConfig.ButtonIconName = FName(*IconNameStr);
+
+        Ar << OutConfig.bShowButtonText;
+        if (!LoadLegacyClass(Ar, OutConfig.BoundClass))
+        {
+            return false;
+        }
+
+        int32 DropdownItemsCount = 0;
+        Ar << DropdownItemsCount;
+
+        // 每个下拉项至少包含两个字符串长度前缀
+        if (Ar.IsError() || !IsLoadSizePlausible(Ar, static_cast<int64>(DropdownItemsCount) * 2 * sizeof(int32)))
+        {
+            Ar.SetError();
+            return false;
+        }
+
+        OutConfig.DropdownItems.SetNum(DropdownItemsCount);
+        for (FToolbarDropdownItem& Item : OutConfig.DropdownItems)
+        {
+            if (!LoadLegacyItem(Ar, Item))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+void FUtilityExtendConfigArchive::SerializeConfigs(FArchive& Ar, TArray<FToolbarButtonConfig>& Configs)
+{
+    using namespace UtilityExtendConfigArchiveUtils;
+
+    if (!IsDataArchive(Ar))
+    {
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        WriteBlock(Ar, EBlockKind::ConfigList, [&Configs](FArchive& Body, FStringTableWriter& Table)
+        {
+            WriteVarint(Body, Configs.Num());
+            for (const FToolbarButtonConfig& Config : Configs)
+            {
+                WriteButtonFields(Body, Table, Config);
+            }
+        });
+        return;
+    }
+
+    if (ReadMarker(Ar, EBlockKind::ConfigList, false) != 1)
+    {
+        return;
+    }
+
+    TArray<FString> Strings;
+    int32 ConfigCount = 0;
+    if (!ReadStringTable(Ar, Strings) || !ReadCount(Ar, 1, ConfigCount))
+    {
+        return;
+    }
+
+    Configs.SetNum(ConfigCount);
+    for (FToolbarButtonConfig& Config : Configs)
+    {
+        if (!ReadButtonFields(Ar, Strings, Config))
+        {
+            Ar.SetError();
+            return;
+        }
+    }
+}
+
+void FUtilityExtendConfigArchive::SerializeButton(FArchive& Ar, FToolbarButtonConfig& Config)
+{
+    using namespace UtilityExtendConfigArchiveUtils;
+
+    if (!IsDataArchive(Ar))
+    {
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        WriteBlock(Ar, EBlockKind::Button, [&Config](FArchive& Body, FStringTableWriter& Table)
+        {
+            WriteButtonFields(Body, Table, Config);
+        });
+        return;
+    }
+
+    const int32 MarkerResult = ReadMarker(Ar, EBlockKind::Button, true);
+    if (MarkerResult == 0)
+    {
+        Config = FToolbarButtonConfig();
+        LoadLegacyButton(Ar, Config);
+        return;
+    }
+
+    TArray<FString> Strings;
+    if (MarkerResult == 1 && ReadStringTable(Ar, Strings) && !ReadButtonFields(Ar, Strings, Config))
+    {
+        Ar.SetError();
+    }
+}
+
+void FUtilityExtendConfigArchive::SerializeItem(FArchive& Ar, FToolbarDropdownItem& Item)
+{
+    using namespace UtilityExtendConfigArchiveUtils;
+
+    if (!IsDataArchive(Ar))
+    {
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        WriteBlock(Ar, EBlockKind::Item, [&Item](FArchive& Body, FStringTableWriter& Table)
+        {
+            WriteItemFields(Body, Table, Item);
+        });
+        return;
+    }
+
+    const int32 MarkerResult = ReadMarker(Ar, EBlockKind::Item, true);
+    if (MarkerResult == 0)
+    {
+        Item = FToolbarDropdownItem();
+        LoadLegacyItem(Ar, Item);
+        return;
+    }
+
+    TArray<FString> Strings;
+    if (MarkerResult == 1 && ReadStringTable(Ar, Strings) && !ReadItemFields(Ar, Strings, Item))
+    {
+        Ar.SetError();
+    }
+}
@@ -0,0 +1,215 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigCache.h"
+#include "Persistent/UtilityExtendConfigArchive.h"
+#include "Persistent/UtilityExtendConfigSchema.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UtilityExtendConfigCacheUtils
+{
+    /** 缓存文件标识 'UECC' */
+    static constexpr uint32 CacheMagic = 0x43434555;
+
+    /** 缓存中保存的是迁移后的配置，配置结构版本变化时旧缓存同样失效 */
+    static constexpr uint32 CacheVersion = FUtilityExtendConfigCache::SchemaVersion | (static_cast<uint32>(FUtilityExtendConfigSchema::CurrentVersion) << 16);
+
+    /** 源文件的缓存键 */
+    struct FSourceKey
+    {
+        FString Path;
+        int64 Size = -1;
+        FDateTime Timestamp;
+        FMD5Hash Hash;
+
+        friend FArchive& operator<<(FArchive& Ar, FSourceKey& Key)
+        {
+            Ar << Key.Path;
+            Ar << Key.Size;
+            Ar << Key.Timestamp;
+            Ar << Key.Hash;
+            return Ar;
+        }
+    };
+
+    /** 读取源文件当前的大小和修改时间（不读内容） */
+    FSourceKey MakeSourceKey(const FString& SourcePath)
+    {
+        FSourceKey Key;
+        Key.Path = FPaths::ConvertRelativePathToFull(SourcePath);
+        FPaths::NormalizeFilename(Key.Path);
+        Key.Size = IFileManager::Get().FileSize(*SourcePath);
+        Key.Timestamp = IFileManager::Get().GetTimeStamp(*SourcePath);
+        return Key;
+    }
+
+    uint32 ComputePayloadCrc(const uint8* Data, int64 Size)
+    {
+        return FCrc::MemCrc32(Data, static_cast<int32>(Size));
+    }
+
+    /**
+     * 写出缓存文件
+     * 临时文件名带GUID后缀，加载时刷新缓存和后台保存可能同时写入，各自的临时文件互不干扰，替换后总是一份完整的缓存
+     */
+    bool WriteCacheFile(FSourceKey& Key, TArray<uint8>& Payload)
+    {
+        TArray<uint8> CacheData;
+        FMemoryWriter Writer(CacheData);
+        uint32 Magic = CacheMagic;
+        uint32 CurrentSchemaVersion = CacheVersion;
+        uint32 PayloadCrc = ComputePayloadCrc(Payload.GetData(), Payload.Num());
+        int64 PayloadSize = Payload.Num();
+        Writer << Magic;
+        Writer << CurrentSchemaVersion;
+        Writer << Key;
+        Writer << PayloadCrc;
+        Writer << PayloadSize;
+        Writer.Serialize(Payload.GetData(), Payload.Num());
+
+        const FString CachePath = FUtilityExtendConfigCache::GetCacheFilePath();
+        const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *CachePath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+        if (!FFileHelper::SaveArrayToFile(CacheData, *TempPath) || !IFileManager::Get().Move(*CachePath, *TempPath, true, true))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法写入配置缓存: %s"), *CachePath);
+            IFileManager::Get().Delete(*TempPath, false, true, true);
+            return false;
+        }
+        return true;
+    }
+}
+
+FString FUtilityExtendConfigCache::GetCacheFilePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UtilityExtend") / TEXT("PersistentConfig.cache");
+}
+
+bool FUtilityExtendConfigCache::TryLoad(const FString& SourcePath, TArray<FToolbarButtonConfig>& OutConfigs)
+{
+    using namespace UtilityExtendConfigCacheUtils;
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FString CachePath = GetCacheFilePath();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*CachePath))
+    {
+        return false;
+    }
+
+    TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*CachePath));
+    TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile.IsValid() ? MappedFile->MapRegion() : nullptr);
+    if (!MappedRegion.IsValid())
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 无法映射配置缓存文件: %s"), *CachePath);
+        return false;
+    }
+
+    FMemoryReaderView Reader(MakeArrayView(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize())));
+
+    uint32 Magic = 0;
+    uint32 CachedSchemaVersion = 0;
+    Reader << Magic;
+    Reader << CachedSchemaVersion;
+    if (Reader.IsError() || Magic != CacheMagic || CachedSchemaVersion != CacheVersion)
+    {
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置缓存版本不匹配，需要重新解析"));
+        return false;
+    }
+
+    FSourceKey CachedKey;
+    Reader << CachedKey;
+
+    // 大小和修改时间一致时直接信任缓存；修改时间变了再比较内容哈希（例如文件只是被touch或重新检出）
+    const FSourceKey CurrentKey = MakeSourceKey(SourcePath);
+    if (Reader.IsError() || CachedKey.Path != CurrentKey.Path || CachedKey.Size != CurrentKey.Size)
+    {
+        return false;
+    }
+    const bool bTimestampChanged = CachedKey.Timestamp != CurrentKey.Timestamp;
+    if (bTimestampChanged && !(FMD5Hash::HashFile(*SourcePath) == CachedKey.Hash))
+    {
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置源文件已修改，配置缓存失效"));
+        return false;
+    }
+
+    uint32 PayloadCrc = 0;
+    int64 PayloadSize = 0;
+    Reader << PayloadCrc;
+    Reader << PayloadSize;
+
+    const int64 PayloadOffset = Reader.Tell();
+    if (Reader.IsError() || PayloadSize < 0 || PayloadOffset + PayloadSize != MappedRegion->GetMappedSize()
+        || ComputePayloadCrc(MappedRegion->GetMappedPtr() + PayloadOffset, PayloadSize) != PayloadCrc)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置缓存文件已损坏，回退到完整解析"));
+        return false;
+    }
+
+    TArray<FToolbarButtonConfig> CachedConfigs;
+    FUtilityExtendConfigArchive::SerializeConfigs(Reader, CachedConfigs);
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置缓存读取失败，回退到完整解析"));
+        return false;
+    }
+
+    if (bTimestampChanged)
+    {
+        // 内容哈希一致，只是修改时间变了：用新的修改时间重写缓存头，之后的启动不必再计算哈希
+        TArray<uint8> Payload(MappedRegion->GetMappedPtr() + PayloadOffset, static_cast<int32>(PayloadSize));
+        MappedRegion.Reset();
+        MappedFile.Reset();
+
+        FSourceKey RefreshedKey = CurrentKey;
+        RefreshedKey.Hash = CachedKey.Hash;
+        if (WriteCacheFile(RefreshedKey, Payload))
+        {
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置源文件内容未变，已刷新配置缓存的修改时间"));
+        }
+    }
+
+    OutConfigs = MoveTemp(CachedConfigs);
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 从配置缓存加载 %d 个按钮配置，耗时 %.2f ms"),
+        OutConfigs.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    return true;
+}
+
+bool FUtilityExtendConfigCache::Store(const FString& SourcePath, const TArray<FToolbarButtonConfig>& Configs)
+{
+    using namespace UtilityExtendConfigCacheUtils;
+
+    FSourceKey Key = MakeSourceKey(SourcePath);
+    Key.Hash = FMD5Hash::HashFile(*SourcePath);
+    if (Key.Size < 0 || !Key.Hash.IsValid())
+    {
+        return false;
+    }
+
+    // 先单独写出配置数据，以便计算校验值
+    TArray<uint8> Payload;
+    FMemoryWriter PayloadWriter(Payload);
+    FUtilityExtendConfigArchive::SerializeConfigs(PayloadWriter, const_cast<TArray<FToolbarButtonConfig>&>(Configs));
+
+    if (!WriteCacheFile(Key, Payload))
+    {
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置缓存已更新，共 %d 个按钮配置"), Configs.Num());
+    return true;
+}
+
+void FUtilityExtendConfigCache::Invalidate()
+{
+    IFileManager::Get().Delete(*GetCacheFilePath(), false, true, true);
+}
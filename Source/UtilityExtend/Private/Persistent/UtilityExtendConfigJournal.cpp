@@ -0,0 +1,213 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigJournal.h"
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+namespace UtilityExtendConfigJournalUtils
+{
+    /** 配置文件内容哈希，用于确认日志基于的是同一份配置文件 */
+    FString HashBaseFile(const FString& BaseConfigPath)
+    {
+        const FMD5Hash Hash = FMD5Hash::HashFile(*BaseConfigPath);
+        return Hash.IsValid() ? LexToString(Hash) : FString();
+    }
+
+    bool ItemsEqual(const FToolbarDropdownItem& A, const FToolbarDropdownItem& B)
+    {
+        return A.ItemName.Equals(B.ItemName, ESearchCase::CaseSensitive) && A.BoundClass == B.BoundClass;
+    }
+
+    /** 逐字段比较，名称区分大小写，改大小写同样需要记录 */
+    bool ConfigsEqual(const FToolbarButtonConfig& A, const FToolbarButtonConfig& B)
+    {
+        if (!A.ButtonName.Equals(B.ButtonName, ESearchCase::CaseSensitive) || A.ButtonType != B.ButtonType
+            || A.ButtonIconName != B.ButtonIconName || A.bShowButtonText != B.bShowButtonText || A.BoundClass != B.BoundClass
+            || A.DropdownItems.Num() != B.DropdownItems.Num())
+        {
+            return false;
+        }
+
+        for (int32 Index = 0; Index < A.DropdownItems.Num(); ++Index)
+        {
+            if (!ItemsEqual(A.DropdownItems[Index], B.DropdownItems[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+FString FUtilityExtendConfigJournal::GetJournalPath(const FString& BaseConfigPath)
+{
+    return FPaths::ChangeExtension(BaseConfigPath, TEXT("journal"));
+}
+
+int64 FUtilityExtendConfigJournal::GetJournalSize(const FString& BaseConfigPath)
+{
+    return IFileManager::Get().FileSize(*GetJournalPath(BaseConfigPath));
+}
+
+int32 FUtilityExtendConfigJournal::Replay(const FString& BaseConfigPath, TArray<FToolbarButtonConfig>& InOutConfigs)
+{
+    const FString JournalPath = GetJournalPath(BaseConfigPath);
+
+    TArray<uint8> JournalData;
+    if (!FFileHelper::LoadFileToArray(JournalData, *JournalPath, FILEREAD_Silent) || JournalData.Num() == 0)
+    {
+        return 0;
+    }
+
+    const FUtf8StringView JournalText(reinterpret_cast<const UTF8CHAR*>(JournalData.GetData()), JournalData.Num());
+
+    TArray<FToolbarButtonConfig> Replayed = InOutConfigs;
+    int32 AppliedCount = 0;
+    bool bHasBase = false;
+    int32 LineStart = 0;
+    while (LineStart < JournalText.Len())
+    {
+        int32 LineEnd = LineStart;
+        while (LineEnd < JournalText.Len() && JournalText[LineEnd] != UTF8CHAR('\n'))
+        {
+            ++LineEnd;
+        }
+
+        const FUtf8StringView Line = JournalText.Mid(LineStart, LineEnd - LineStart).TrimEnd();
+        LineStart = LineEnd + 1;
+        if (Line.IsEmpty())
+        {
+            continue;
+        }
+
+        FUtilityExtendJournalRecord Record;
+        FString ErrorMessage;
+        if (!FUtilityExtendConfigJson::ReadJournalRecord(Line, Record, ErrorMessage))
+        {
+            // 写入中途中断留下的半行：之后的会话都是在跳过它的状态上记录差异，跳过它结果仍然一致
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 跳过不完整的配置变更日志记录: %s (%s)"), *JournalPath, *ErrorMessage);
+            continue;
+        }
+
+        if (!bHasBase)
+        {
+            const FString BaseHash = UtilityExtendConfigJournalUtils::HashBaseFile(BaseConfigPath);
+            if (Record.Op != EUtilityExtendJournalOp::Base || Record.BaseHash != BaseHash)
+            {
+                // 配置文件已被其他人压缩或重写，日志不再适用；改名保留以便手动恢复
+                const FString OrphanedPath = JournalPath + TEXT(".orphaned");
+                IFileManager::Get().Move(*OrphanedPath, *JournalPath, true, true);
+                UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置变更日志与当前配置文件不匹配，已忽略并保留为: %s"), *OrphanedPath);
+                return 0;
+            }
+            bHasBase = true;
+            continue;
+        }
+
+        if (Record.Op == EUtilityExtendJournalOp::Set && Record.Index >= 0 && Record.Index <= Replayed.Num())
+        {
+            if (Record.Index == Replayed.Num())
+            {
+                Replayed.Add(MoveTemp(Record.Button));
+            }
+            else
+            {
+                Replayed[Record.Index] = MoveTemp(Record.Button);
+            }
+        }
+        else if (Record.Op == EUtilityExtendJournalOp::Truncate && Record.Count >= 0 && Record.Count <= Replayed.Num())
+        {
+            Replayed.SetNum(Record.Count);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置变更日志记录与当前状态不符，停止回放: %s"), *JournalPath);
+            break;
+        }
+        ++AppliedCount;
+    }
+
+    InOutConfigs = MoveTemp(Replayed);
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 已回放配置变更日志 %d 条记录，按钮数量: %d"), AppliedCount, InOutConfigs.Num());
+    return AppliedCount;
+}
+
+void FUtilityExtendConfigJournal::Diff(const TArray<FToolbarButtonConfig>& Persisted, const TArray<FToolbarButtonConfig>& Current, TArray<FUtilityExtendJournalRecord>& OutRecords)
+{
+    OutRecords.Reset();
+
+    // 先截断再逐个设置：删除尾部按钮只需一条记录，修改单个按钮也只写这一个按钮
+    if (Current.Num() < Persisted.Num())
+    {
+        FUtilityExtendJournalRecord& Record = OutRecords.AddDefaulted_GetRef();
+        Record.Op = EUtilityExtendJournalOp::Truncate;
+        Record.Count = Current.Num();
+    }
+
+    for (int32 Index = 0; Index < Current.Num(); ++Index)
+    {
+        if (Persisted.IsValidIndex(Index) && UtilityExtendConfigJournalUtils::ConfigsEqual(Persisted[Index], Current[Index]))
+        {
+            continue;
+        }
+
+        FUtilityExtendJournalRecord& Record = OutRecords.AddDefaulted_GetRef();
+        Record.Op = EUtilityExtendJournalOp::Set;
+        Record.Index = Index;
+        Record.Button = Current[Index];
+    }
+}
+
+int64 FUtilityExtendConfigJournal::Append(const FString& BaseConfigPath, const TArray<FUtilityExtendJournalRecord>& Records)
+{
+    const FString JournalPath = GetJournalPath(BaseConfigPath);
+
+    FString Lines;
+    if (IFileManager::Get().FileSize(*JournalPath) > 0)
+    {
+        // 每批记录另起一行，上次写入中断留下的半行不会和新记录连在一起
+        Lines.AppendChar(TEXT('\n'));
+    }
+    else
+    {
+        FUtilityExtendJournalRecord BaseRecord;
+        BaseRecord.Op = EUtilityExtendJournalOp::Base;
+        BaseRecord.BaseHash = UtilityExtendConfigJournalUtils::HashBaseFile(BaseConfigPath);
+        if (BaseRecord.BaseHash.IsEmpty())
+        {
+            UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 无法读取配置文件，不能创建变更日志: %s"), *BaseConfigPath);
+            return -1;
+        }
+        FUtilityExtendConfigJson::WriteJournalRecord(BaseRecord, Lines);
+        Lines.AppendChar(TEXT('\n'));
+    }
+
+    FString Line;
+    for (const FUtilityExtendJournalRecord& Record : Records)
+    {
+        FUtilityExtendConfigJson::WriteJournalRecord(Record, Line);
+        Lines.Append(Line);
+        Lines.AppendChar(TEXT('\n'));
+    }
+
+    // 一次写入整批记录，减少同步目录中的小写入次数
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*JournalPath, FILEWRITE_Append | FILEWRITE_AllowRead));
+    if (!Writer.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 无法打开配置变更日志: %s"), *JournalPath);
+        return -1;
+    }
+
+    const FTCHARToUTF8 Utf8Lines(*Lines, Lines.Len());
+    Writer->Serialize(const_cast<void*>(static_cast<const void*>(Utf8Lines.Get())), Utf8Lines.Length());
+    const bool bWritten = Writer->Close() && !Writer->IsError();
+    return bWritten ? Utf8Lines.Length() : -1;
+}
+
+void FUtilityExtendConfigJournal::Delete(const FString& BaseConfigPath)
+{
+    IFileManager::Get().Delete(*GetJournalPath(BaseConfigPath), false, true, true);
+}
@@ -0,0 +1,471 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "Persistent/UtilityExtendConfigSchema.h"
+#include "Persistent/UtilityExtendConfigJournal.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace UtilityExtendConfigJsonUtils
+{
+    typedef TJsonReader<UTF8CHAR> FConfigJsonReader;
+
+    /** 读取失败时给出带位置的错误信息 */
+    FString MakeReaderError(FConfigJsonReader& Reader, const TCHAR* Context)
+    {
+        const FString& ReaderError = Reader.GetErrorMessage();
+        return FString::Printf(TEXT("%s: %s"), Context, ReaderError.IsEmpty() ? TEXT("JSON结构不完整") : *ReaderError);
+    }
+
+    /** 跳过当前的对象或数组值，标量值本身已经被读取，无需处理 */
+    bool SkipValue(FConfigJsonReader& Reader, EJsonNotation Notation)
+    {
+        if (Notation == EJsonNotation::ObjectStart)
+        {
+            return Reader.SkipObject();
+        }
+        if (Notation == EJsonNotation::ArrayStart)
+        {
+            return Reader.SkipArray();
+        }
+        return Notation != EJsonNotation::Error;
+    }
+
+    /** 读取布尔字段，兼容以字符串保存的布尔值 */
+    bool ReadBoolValue(FConfigJsonReader& Reader, EJsonNotation Notation)
+    {
+        if (Notation == EJsonNotation::Boolean)
+        {
+            return Reader.GetValueAsBoolean();
+        }
+        if (Notation == EJsonNotation::String)
+        {
+            const FString& Value = Reader.GetValueAsString();
+            return Value.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Value == TEXT("1");
+        }
+        if (Notation == EJsonNotation::Number)
+        {
+            return Reader.GetValueAsNumber() != 0.0;
+        }
+        return false;
+    }
+
+    /** 读取一个下拉项对象（ObjectStart已被读取） */
+    bool ReadDropdownItem(FConfigJsonReader& Reader, FToolbarDropdownItem& OutItem, FString& OutError)
+    {
+        EJsonNotation Notation;
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ObjectEnd)
+            {
+                return true;
+            }
+
+            const FString& Identifier = Reader.GetIdentifier();
+            if (Notation == EJsonNotation::String && Identifier == TEXT("ItemName"))
+            {
+                OutItem.ItemName = Reader.GetValueAsString();
+            }
+            else if (Notation == EJsonNotation::String && Identifier == TEXT("BoundClass"))
+            {
+                OutItem.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(Reader.GetValueAsString());
+            }
+            else if (!SkipValue(Reader, Notation))
+            {
+                break;
+            }
+        }
+
+        OutError = MakeReaderError(Reader, TEXT("下拉项解析失败"));
+        return false;
+    }
+
+    /** 读取DropdownItems数组（ArrayStart已被读取） */
+    bool ReadDropdownItems(FConfigJsonReader& Reader, TArray<FToolbarDropdownItem>& OutItems, FString& OutError)
+    {
+        EJsonNotation Notation;
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ArrayEnd)
+            {
+                return true;
+            }
+
+            if (Notation == EJsonNotation::ObjectStart)
+            {
+                if (!ReadDropdownItem(Reader, OutItems.AddDefaulted_GetRef(), OutError))
+                {
+                    return false;
+                }
+            }
+            else if (!SkipValue(Reader, Notation))
+            {
+                break;
+            }
+        }
+
+        OutError = MakeReaderError(Reader, TEXT("下拉项数组解析失败"));
+        return false;
+    }
+
+    /** 读取一个按钮配置对象（ObjectStart已被读取） */
+    bool ReadButtonConfig(FConfigJsonReader& Reader, FToolbarButtonConfig& OutConfig, FString& OutError)
+    {
+        EJsonNotation Notation;
+        while (Reader.ReadNext(Notation))
+        {
+            if (Notation == EJsonNotation::ObjectEnd)
+            {
+                // 与原先的行为保持一致：只有下拉按钮才保留下拉项
+                if (OutConfig.ButtonType != EToolbarButtonType::DropdownButton)
+                {
+                    OutConfig.DropdownItems.Empty();
+                }
+                return true;
+            }
+
+            const FString& Identifier = Reader.GetIdentifier();
+            if (Notation == EJsonNotation::String)
+            {
+                if (Identifier == TEXT("ButtonName"))
+                {
+                    OutConfig.ButtonName = Reader.GetValueAsString();
+                }
+                else if (Identifier == TEXT("ButtonType"))
+                {
+                    OutConfig.ButtonType = Reader.GetValueAsString() == TEXT("SingleButton") ? EToolbarButtonType::SingleButton : EToolbarButtonType::DropdownButton;
+                }
+                else if (Identifier == TEXT("ButtonIconName"))
+                {
+                    OutConfig.ButtonIconName = FName(*Reader.GetValueAsString());
+                }
+                else if (Identifier == TEXT("BoundClass"))
+                {
+                    OutConfig.BoundClass = FUtilityExtendConfigJson::ConfigStringToSoftClass(Reader.GetValueAsString());
+                }
+                else if (Identifier == TEXT("bShowButtonText"))
+                {
+                    OutConfig.bShowButtonText = ReadBoolValue(Reader, Notation);
+                }
+            }
+            else if (Identifier == TEXT("bShowButtonText") && (Notation == EJsonNotation::Boolean || Notation == EJsonNotation::Number))
+            {
+                OutConfig.bShowButtonText = ReadBoolValue(Reader, Notation);
+            }
+            else if (Notation == EJsonNotation::ArrayStart && Identifier == TEXT("DropdownItems"))
+            {
+                if (!ReadDropdownItems(Reader, OutConfig.DropdownItems, OutError))
+                {
+                    return false;
+                }
+            }
+            else if (!SkipValue(Reader, Notation))
+            {
+                break;
+            }
+        }
+
+        OutError = MakeReaderError(Reader, TEXT("按钮配置解析失败"));
+        return false;
+    }
+
+    /** 写出一个按钮配置对象，整文件和单行日志记录共用 */
+    template <class PrintPolicy>
+    void WriteButtonConfig(TJsonWriter<TCHAR, PrintPolicy>& Writer, const FToolbarButtonConfig& Config, const TCHAR* Identifier = nullptr)
+    {
+        if (Identifier)
+        {
+            Writer.WriteObjectStart(Identifier);
+        }
+        else
+        {
+            Writer.WriteObjectStart();
+        }
+        Writer.WriteValue(TEXT("ButtonName"), Config.ButtonName);
+        Writer.WriteValue(TEXT("ButtonType"), Config.ButtonType == EToolbarButtonType::SingleButton ? TEXT("SingleButton") : TEXT("DropdownButton"));
+        Writer.WriteValue(TEXT("ButtonIconName"), Config.ButtonIconName.ToString());
+        Writer.WriteValue(TEXT("bShowButtonText"), Config.bShowButtonText);
+        Writer.WriteValue(TEXT("BoundClass"), FUtilityExtendConfigJson::SoftClassToConfigString(Config.BoundClass));
+
+        if (Config.ButtonType == EToolbarButtonType::DropdownButton)
+        {
+            Writer.WriteArrayStart(TEXT("DropdownItems"));
+            for (const FToolbarDropdownItem& Item : Config.DropdownItems)
+            {
+                Writer.WriteObjectStart();
+                Writer.WriteValue(TEXT("ItemName"), Item.ItemName);
+                Writer.WriteValue(TEXT("BoundClass"), FUtilityExtendConfigJson::SoftClassToConfigString(Item.BoundClass));
+                Writer.WriteObjectEnd();
+            }
+            Writer.WriteArrayEnd();
+        }
+
+        Writer.WriteObjectEnd();
+    }
+
+    /** 日志记录类型的名称 */
+    const TCHAR* LexJournalOp(EUtilityExtendJournalOp Op)
+    {
+        switch (Op)
+        {
+        case EUtilityExtendJournalOp::Base:
+            return TEXT("Base");
+        case EUtilityExtendJournalOp::Truncate:
+            return TEXT("Truncate");
+        default:
+            return TEXT("Set");
+        }
+    }
+}
+
+bool FUtilityExtendConfigJson::ReadButtonConfigs(FUtf8StringView Utf8Json, TArray<FToolbarButtonConfig>& OutConfigs, FString& OutError, int32* OutSchemaVersion)
+{
+    using namespace UtilityExtendConfigJsonUtils;
+
+    OutConfigs.Reset();
+    if (OutSchemaVersion)
+    {
+        *OutSchemaVersion = 0;
+    }
+
+    // 跳过UTF-8 BOM，JSON读取器不识别它
+    if (Utf8Json.Len() >= 3
+        && static_cast<uint8>(Utf8Json[0]) == 0xEF && static_cast<uint8>(Utf8Json[1]) == 0xBB && static_cast<uint8>(Utf8Json[2]) == 0xBF)
+    {
+        Utf8Json.RightChopInline(3);
+    }
+
+    TSharedRef<FConfigJsonReader> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Utf8Json);
+
+    EJsonNotation Notation;
+    if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+    {
+        OutError = MakeReaderError(*Reader, TEXT("根节点不是JSON对象"));
+        return false;
+    }
+
+    bool bFoundButtonConfigs = false;
+    while (Reader->ReadNext(Notation))
+    {
+        if (Notation == EJsonNotation::ObjectEnd)
+        {
+            if (!bFoundButtonConfigs)
+            {
+                OutError = TEXT("JSON配置文件中未找到PersistentButtonConfigs字段");
+                return false;
+            }
+            return true;
+        }
+
+        if (Notation == EJsonNotation::Number && Reader->GetIdentifier() == TEXT("SchemaVersion"))
+        {
+            if (OutSchemaVersion)
+            {
+                *OutSchemaVersion = static_cast<int32>(Reader->GetValueAsNumber());
+            }
+        }
+        else if (Notation == EJsonNotation::ArrayStart && Reader->GetIdentifier() == TEXT("PersistentButtonConfigs"))
+        {
+            bFoundButtonConfigs = true;
+
+            while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd)
+            {
+                if (Notation == EJsonNotation::ObjectStart)
+                {
+                    if (!ReadButtonConfig(*Reader, OutConfigs.AddDefaulted_GetRef(), OutError))
+                    {
+                        return false;
+                    }
+                }
+                else if (!SkipValue(*Reader, Notation))
+                {
+                    OutError = MakeReaderError(*Reader, TEXT("按钮配置数组解析失败"));
+                    return false;
+                }
+            }
+
+            if (Notation != EJsonNotation::ArrayEnd)
+            {
+                OutError = MakeReaderError(*Reader, TEXT("按钮配置数组解析失败"));
+                return false;
+            }
+        }
+        else if (!SkipValue(*Reader, Notation))
+        {
+            break;
+        }
+    }
+
+    OutError = MakeReaderError(*Reader, TEXT("JSON配置文件解析失败"));
+    return false;
+}
+
+bool FUtilityExtendConfigJson::ReadButtonConfigsFromFile(const FString& FilePath, TArray<FToolbarButtonConfig>& OutConfigs, FString& OutError, int32* OutSchemaVersion)
+{
+    // 直接读取原始字节，按UTF-8解析，省去整文件转换为FString
+    TArray<uint8> FileData;
+    if (!FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent))
+    {
+        OutError = FString::Printf(TEXT("无法读取JSON配置文件: %s"), *FilePath);
+        return false;
+    }
+
+    return ReadButtonConfigs(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(FileData.GetData()), FileData.Num()), OutConfigs, OutError, OutSchemaVersion);
+}
+
+void FUtilityExtendConfigJson::WriteButtonConfigs(const TArray<FToolbarButtonConfig>& Configs, FString& OutJson)
+{
+    OutJson.Reset();
+
+    // 字段顺序与原先DOM写出的顺序一致，保证已有配置文件重新保存后没有多余的差异
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("SchemaVersion"), FUtilityExtendConfigSchema::CurrentVersion);
+    Writer->WriteArrayStart(TEXT("PersistentButtonConfigs"));
+
+    for (const FToolbarButtonConfig& Config : Configs)
+    {
+        UtilityExtendConfigJsonUtils::WriteButtonConfig(*Writer, Config);
+    }
+
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+}
+
+void FUtilityExtendConfigJson::WriteJournalRecord(const FUtilityExtendJournalRecord& Record, FString& OutLine)
+{
+    OutLine.Reset();
+
+    // 日志按行分隔，必须使用不换行的紧凑格式
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutLine);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("Op"), UtilityExtendConfigJsonUtils::LexJournalOp(Record.Op));
+
+    switch (Record.Op)
+    {
+    case EUtilityExtendJournalOp::Base:
+        Writer->WriteValue(TEXT("BaseHash"), Record.BaseHash);
+        Writer->WriteValue(TEXT("SchemaVersion"), FUtilityExtendConfigSchema::CurrentVersion);
+        break;
+    case EUtilityExtendJournalOp::Truncate:
+        Writer->WriteValue(TEXT("Count"), Record.Count);
+        break;
+    default:
+        Writer->WriteValue(TEXT("Index"), Record.Index);
+        UtilityExtendConfigJsonUtils::WriteButtonConfig(*Writer, Record.Button, TEXT("Button"));
+        break;
+    }
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+}
+
+bool FUtilityExtendConfigJson::ReadJournalRecord(FUtf8StringView Utf8Line, FUtilityExtendJournalRecord& OutRecord, FString& OutError)
+{
+    using namespace UtilityExtendConfigJsonUtils;
+
+    OutRecord = FUtilityExtendJournalRecord();
+
+    TSharedRef<FConfigJsonReader> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(Utf8Line);
+
+    EJsonNotation Notation;
+    if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+    {
+        OutError = MakeReaderError(*Reader, TEXT("日志记录不是JSON对象"));
+        return false;
+    }
+
+    bool bHasOp = false;
+    while (Reader->ReadNext(Notation))
+    {
+        if (Notation == EJsonNotation::ObjectEnd)
+        {
+            if (!bHasOp)
+            {
+                OutError = TEXT("日志记录缺少Op字段");
+                return false;
+            }
+            return true;
+        }
+
+        const FString& Identifier = Reader->GetIdentifier();
+        if (Notation == EJsonNotation::String && Identifier == TEXT("Op"))
+        {
+            const FString& Op = Reader->GetValueAsString();
+            if (Op == TEXT("Base"))
+            {
+                OutRecord.Op = EUtilityExtendJournalOp::Base;
+            }
+            else if (Op == TEXT("Set"))
+            {
+                OutRecord.Op = EUtilityExtendJournalOp::Set;
+            }
+            else if (Op == TEXT("Truncate"))
+            {
+                OutRecord.Op = EUtilityExtendJournalOp::Truncate;
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("未知的日志记录类型: %s"), *Op);
+                return false;
+            }
+            bHasOp = true;
+        }
+        else if (Notation == EJsonNotation::String && Identifier == TEXT("BaseHash"))
+        {
+            OutRecord.BaseHash = Reader->GetValueAsString();
+        }
+        else if (Notation == EJsonNotation::Number && Identifier == TEXT("Index"))
+        {
+            OutRecord.Index = static_cast<int32>(Reader->GetValueAsNumber());
+        }
+        else if (Notation == EJsonNotation::Number && Identifier == TEXT("Count"))
+        {
+            OutRecord.Count = static_cast<int32>(Reader->GetValueAsNumber());
+        }
+        else if (Notation == EJsonNotation::ObjectStart && Identifier == TEXT("Button"))
+        {
+            if (!ReadButtonConfig(*Reader, OutRecord.Button, OutError))
+            {
+                return false;
+            }
+        }
+        else if (!SkipValue(*Reader, Notation))
+        {
+            break;
+        }
+    }
+
+    OutError = MakeReaderError(*Reader, TEXT("日志记录解析失败"));
+    return false;
+}
+
+FString FUtilityExtendConfigJson::SoftClassToConfigString(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& SoftClass)
+{
+    if (SoftClass.IsValid())
+    {
+        return SoftClass.ToString();
+    }
+
+    if (SoftClass.IsNull())
+    {
+        return TEXT("None");
+    }
+
+    // 未加载状态，保持原路径
+    const FString ClassPath = SoftClass.ToSoftObjectPath().ToString();
+    return ClassPath.IsEmpty() ? TEXT("None") : ClassPath;
+}
+
+TSoftClassPtr<UUtilityExtendTopBarButtonScript> FUtilityExtendConfigJson::ConfigStringToSoftClass(const FString& ClassPath)
+{
+    if (ClassPath.IsEmpty() || ClassPath == TEXT("None"))
+    {
+        return TSoftClassPtr<UUtilityExtendTopBarButtonScript>();
+    }
+
+    return TSoftClassPtr<UUtilityExtendTopBarButtonScript>(FSoftObjectPath(ClassPath));
+}
@@ -0,0 +1,474 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigResolver.h"
+#include "Persistent/UtilityExtendPersistentSettings.h"
+#include "Persistent/UtilityExtendConfigArchive.h"
+#include "Persistent/UtilityExtendConfigCache.h"
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "Persistent/UtilityExtendConfigSchema.h"
+#include "Algo/Sort.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UtilityExtendConfigResolverUtils
+{
+    /** 共享配置缓存文件标识 'UESC' */
+    static constexpr uint32 SharedCacheMagic = 0x43534555;
+
+    /** 与持久化配置缓存使用相同的版本规则：缓存布局或配置结构版本变化时失效 */
+    static constexpr uint32 SharedCacheVersion = FUtilityExtendConfigCache::SchemaVersion | (static_cast<uint32>(FUtilityExtendConfigSchema::CurrentVersion) << 16);
+
+    /** 扫描到的共享配置文件 */
+    struct FFoundFile
+    {
+        FString Path;
+        int64 Size;
+        FDateTime Timestamp;
+    };
+
+    /** 列出一个共享目录中的JSON配置文件，同时取得大小和修改时间，不再逐个查询文件属性 */
+    void FindSharedFiles(const FString& Directory, TArray<FFoundFile>& OutFiles)
+    {
+        const int32 FirstIndex = OutFiles.Num();
+        IFileManager::Get().IterateDirectoryStat(*Directory, [&OutFiles](const TCHAR* FileName, const FFileStatData& StatData)
+        {
+            if (!StatData.bIsDirectory && FPaths::GetExtension(FileName).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+            {
+                FString FullPath = FPaths::ConvertRelativePathToFull(FileName);
+                FPaths::NormalizeFilename(FullPath);
+                OutFiles.Add({ MoveTemp(FullPath), StatData.FileSize, StatData.ModificationTime });
+            }
+            return true;
+        });
+
+        // 目录遍历顺序与平台有关，按文件名排序保证合并顺序稳定
+        TArrayView<FFoundFile> DirectoryFiles = MakeArrayView(OutFiles).Slice(FirstIndex, OutFiles.Num() - FirstIndex);
+        Algo::SortBy(DirectoryFiles, &FFoundFile::Path);
+    }
+}
+
+FUtilityExtendConfigResolver& FUtilityExtendConfigResolver::Get()
+{
+    static FUtilityExtendConfigResolver Resolver;
+    return Resolver;
+}
+
+FString FUtilityExtendConfigResolver::GetUserOverlayPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UtilityExtend") / TEXT("UserToolbarOverlay.json");
+}
+
+FString FUtilityExtendConfigResolver::GetSharedCachePath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UtilityExtend") / TEXT("SharedConfig.cache");
+}
+
+const TCHAR* FUtilityExtendConfigResolver::LexLayerName(EUtilityExtendConfigLayer Layer)
+{
+    switch (Layer)
+    {
+    case EUtilityExtendConfigLayer::Persistent:
+        return TEXT("Persistent");
+    case EUtilityExtendConfigLayer::Shared:
+        return TEXT("Shared");
+    case EUtilityExtendConfigLayer::Project:
+        return TEXT("Project");
+    case EUtilityExtendConfigLayer::User:
+        return TEXT("User");
+    default:
+        return TEXT("Unknown");
+    }
+}
+
+void FUtilityExtendConfigResolver::Invalidate()
+{
+    bHasResolved = false;
+}
+
+FUtilityExtendConfigResolver::FLayerStamps FUtilityExtendConfigResolver::CaptureStamps() const
+{
+    FLayerStamps Stamps;
+
+    if (const UUtilityExtendPersistentSettings* PersistentSettings = UUtilityExtendPersistentSettings::Get())
+    {
+        Stamps.PersistentVersion = PersistentSettings->GetConfigVersion();
+    }
+
+    Stamps.SharedVersion = SharedVersion;
+
+    if (const UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get())
+    {
+        Stamps.ProjectVersion = ProjectSettings->GetConfigVersion();
+    }
+
+    // 用户覆盖文件可能被外部编辑器修改，只比较大小和修改时间，不读取内容
+    const FString OverlayPath = GetUserOverlayPath();
+    Stamps.UserOverlaySize = IFileManager::Get().FileSize(*OverlayPath);
+    if (Stamps.UserOverlaySize >= 0)
+    {
+        Stamps.UserOverlayTimestamp = IFileManager::Get().GetTimeStamp(*OverlayPath);
+    }
+
+    return Stamps;
+}
+
+void FUtilityExtendConfigResolver::LoadUserOverlay(const FLayerStamps& Stamps)
+{
+    if (Stamps.UserOverlaySize == LoadedUserOverlaySize && Stamps.UserOverlayTimestamp == LoadedUserOverlayTimestamp)
+    {
+        return;
+    }
+
+    LoadedUserOverlaySize = Stamps.UserOverlaySize;
+    LoadedUserOverlayTimestamp = Stamps.UserOverlayTimestamp;
+    UserOverlayConfigs.Reset();
+
+    if (Stamps.UserOverlaySize < 0)
+    {
+        return;
+    }
+
+    const FString OverlayPath = GetUserOverlayPath();
+    FString ErrorMessage;
+    int32 OverlaySchemaVersion = 0;
+    if (!FUtilityExtendConfigJson::ReadButtonConfigsFromFile(OverlayPath, UserOverlayConfigs, ErrorMessage, &OverlaySchemaVersion))
+    {
+        // 覆盖文件写坏时忽略整个覆盖层，不影响插件和项目配置
+        UserOverlayConfigs.Reset();
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 用户覆盖配置解析失败，已忽略: %s (%s)"), *OverlayPath, *ErrorMessage);
+        return;
+    }
+
+    // 覆盖文件由用户维护，只在内存中迁移，不回写
+    FUtilityExtendConfigSchema::Migrate(OverlaySchemaVersion, UserOverlayConfigs);
+
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 已加载用户覆盖配置: %s，按钮数量: %d"), *OverlayPath, UserOverlayConfigs.Num());
+}
+
+void FUtilityExtendConfigResolver::LoadSharedCache()
+{
+    using namespace UtilityExtendConfigResolverUtils;
+
+    bSharedCacheLoaded = true;
+
+    TArray<uint8> CacheData;
+    if (!FFileHelper::LoadFileToArray(CacheData, *GetSharedCachePath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(CacheData);
+    uint32 Magic = 0;
+    uint32 CachedVersion = 0;
+    int32 FileCount = 0;
+    Reader << Magic;
+    Reader << CachedVersion;
+    Reader << FileCount;
+    if (Reader.IsError() || Magic != SharedCacheMagic || CachedVersion != SharedCacheVersion || FileCount < 0)
+    {
+        return;
+    }
+
+    TMap<FString, FSharedConfigFile> CachedFiles;
+    for (int32 FileIndex = 0; FileIndex < FileCount && !Reader.IsError(); ++FileIndex)
+    {
+        FString Path;
+        Reader << Path;
+        FSharedConfigFile& File = CachedFiles.Add(MoveTemp(Path));
+        Reader << File.Size;
+        Reader << File.Timestamp;
+        Reader << File.Hash;
+        FUtilityExtendConfigArchive::SerializeConfigs(Reader, File.Configs);
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 共享配置缓存已损坏，将重新解析所有共享配置文件"));
+        return;
+    }
+
+    SharedConfigFiles = MoveTemp(CachedFiles);
+}
+
+void FUtilityExtendConfigResolver::StoreSharedCache() const
+{
+    using namespace UtilityExtendConfigResolverUtils;
+
+    TArray<uint8> CacheData;
+    FMemoryWriter Writer(CacheData);
+    uint32 Magic = SharedCacheMagic;
+    uint32 CurrentVersion = SharedCacheVersion;
+    int32 FileCount = SharedConfigFiles.Num();
+    Writer << Magic;
+    Writer << CurrentVersion;
+    Writer << FileCount;
+    for (const TPair<FString, FSharedConfigFile>& Pair : SharedConfigFiles)
+    {
+        FString Path = Pair.Key;
+        FSharedConfigFile& File = const_cast<FSharedConfigFile&>(Pair.Value);
+        Writer << Path;
+        Writer << File.Size;
+        Writer << File.Timestamp;
+        Writer << File.Hash;
+        FUtilityExtendConfigArchive::SerializeConfigs(Writer, File.Configs);
+    }
+
+    const FString CachePath = GetSharedCachePath();
+    const FString TempPath = CachePath + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(CacheData, *TempPath) || !IFileManager::Get().Move(*CachePath, *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法写入共享配置缓存: %s"), *CachePath);
+        IFileManager::Get().Delete(*TempPath, false, true, true);
+    }
+}
+
+bool FUtilityExtendConfigResolver::RefreshSharedConfigs()
+{
+    using namespace UtilityExtendConfigResolverUtils;
+
+    const double StartTime = FPlatformTime::Seconds();
+    if (!bSharedCacheLoaded)
+    {
+        LoadSharedCache();
+    }
+
+    TArray<FFoundFile> FoundFiles;
+    if (const UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get())
+    {
+        for (const FDirectoryPath& Directory : ProjectSettings->SharedConfigDirectories)
+        {
+            if (!Directory.Path.IsEmpty())
+            {
+                FindSharedFiles(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Directory.Path), FoundFiles);
+            }
+        }
+    }
+
+    bool bChanged = false;
+    bool bCacheDirty = false;
+    int32 ParsedCount = 0;
+    int32 HashMatchedCount = 0;
+
+    TArray<FString> NewOrder;
+    NewOrder.Reserve(FoundFiles.Num());
+    for (const FFoundFile& Found : FoundFiles)
+    {
+        FSharedConfigFile* Existing = SharedConfigFiles.Find(Found.Path);
+        if (Existing && Existing->Size == Found.Size && Existing->Timestamp == Found.Timestamp)
+        {
+            NewOrder.Add(Found.Path);
+            continue;
+        }
+
+        TArray<uint8> FileData;
+        if (!FFileHelper::LoadFileToArray(FileData, *Found.Path, FILEREAD_Silent))
+        {
+            // 同步工具可能正独占着文件，保留上次的内容，下次扫描再试
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法读取共享配置文件: %s"), *Found.Path);
+            if (Existing)
+            {
+                NewOrder.Add(Found.Path);
+            }
+            continue;
+        }
+
+        FMD5 Md5;
+        Md5.Update(FileData.GetData(), FileData.Num());
+        FMD5Hash Hash;
+        Hash.Set(Md5);
+
+        // 同步或重新检出只会改修改时间，内容没变就不重新解析
+        if (Existing && Existing->Hash == Hash)
+        {
+            Existing->Size = Found.Size;
+            Existing->Timestamp = Found.Timestamp;
+            NewOrder.Add(Found.Path);
+            bCacheDirty = true;
+            ++HashMatchedCount;
+            continue;
+        }
+
+        TArray<FToolbarButtonConfig> Configs;
+        FString ErrorMessage;
+        int32 FileSchemaVersion = 0;
+        if (!FUtilityExtendConfigJson::ReadButtonConfigs(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(FileData.GetData()), FileData.Num()),
+                                                        Configs, ErrorMessage, &FileSchemaVersion))
+        {
+            // 文件可能还没同步完整，保留上次成功解析的内容；版本戳不更新，下次扫描会重新检查
+            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 共享配置文件解析失败，%s: %s (%s)"),
+                   Existing ? TEXT("保留上次的内容") : TEXT("已跳过"), *Found.Path, *ErrorMessage);
+            if (Existing)
+            {
+                NewOrder.Add(Found.Path);
+            }
+            continue;
+        }
+
+        // 共享文件由团队维护，只在内存中迁移，不回写
+        FUtilityExtendConfigSchema::Migrate(FileSchemaVersion, Configs);
+
+        FSharedConfigFile& File = Existing ? *Existing : SharedConfigFiles.Add(Found.Path);
+        File.Size = Found.Size;
+        File.Timestamp = Found.Timestamp;
+        File.Hash = Hash;
+        File.Configs = MoveTemp(Configs);
+        NewOrder.Add(Found.Path);
+        bChanged = true;
+        bCacheDirty = true;
+        ++ParsedCount;
+    }
+
+    // 删除已经不在共享目录中的文件
+    if (SharedConfigFiles.Num() != NewOrder.Num())
+    {
+        const TSet<FString> KeptPaths(NewOrder);
+        for (auto It = SharedConfigFiles.CreateIterator(); It; ++It)
+        {
+            if (!KeptPaths.Contains(It.Key()))
+            {
+                It.RemoveCurrent();
+                bChanged = true;
+                bCacheDirty = true;
+            }
+        }
+    }
+
+    // 目录顺序调整同样影响合并结果
+    if (NewOrder != SharedConfigOrder)
+    {
+        SharedConfigOrder = MoveTemp(NewOrder);
+        bChanged = true;
+    }
+
+    if (bCacheDirty)
+    {
+        StoreSharedCache();
+    }
+    if (bChanged)
+    {
+        ++SharedVersion;
+    }
+
+    if (FoundFiles.Num() > 0 || bChanged)
+    {
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 共享配置目录扫描完成，文件 %d 个，重新解析 %d 个，内容未变 %d 个，耗时 %.2f ms"),
+               SharedConfigOrder.Num(), ParsedCount, HashMatchedCount, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    return bChanged;
+}
+
+void FUtilityExtendConfigResolver::MergeLayer(const TArray<FToolbarButtonConfig>& LayerConfigs, EUtilityExtendConfigLayer Layer, TMap<FString, int32>& NameToIndex,
+                                              TArray<FToolbarButtonConfig>& OutConfigs, TArray<EUtilityExtendConfigLayer>& OutLayers)
+{
+    for (const FToolbarButtonConfig& Config : LayerConfigs)
+    {
+        // 空名称的按钮无法按名称覆盖，原样保留，由工具栏创建时跳过
+        if (Config.ButtonName.IsEmpty())
+        {
+            OutConfigs.Add(Config);
+            OutLayers.Add(Layer);
+            continue;
+        }
+
+        // FString作为TMap键时不区分大小写，与工具栏条目的FName名称一致
+        if (const int32* ExistingIndex = NameToIndex.Find(Config.ButtonName))
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 按钮 %s 的%s配置被%s配置覆盖"),
+                   *Config.ButtonName, LexLayerName(OutLayers[*ExistingIndex]), LexLayerName(Layer));
+            OutConfigs[*ExistingIndex] = Config;
+            OutLayers[*ExistingIndex] = Layer;
+            continue;
+        }
+
+        NameToIndex.Add(Config.ButtonName, OutConfigs.Num());
+        OutConfigs.Add(Config);
+        OutLayers.Add(Layer);
+    }
+}
+
+const TArray<FToolbarButtonConfig>& FUtilityExtendConfigResolver::Resolve()
+{
+    check(IsInGameThread());
+
+    FLayerStamps Stamps = CaptureStamps();
+
+    // 共享目录可能位于同步目录中，不在每次Resolve时扫描：
+    // 只在首次合并、强制重新合并或项目设置变化（目录列表可能变化）时扫描
+    if (!bHasResolved || Stamps.ProjectVersion != ResolvedStamps.ProjectVersion)
+    {
+        RefreshSharedConfigs();
+        Stamps.SharedVersion = SharedVersion;
+    }
+
+    if (bHasResolved && Stamps == ResolvedStamps)
+    {
+        return ResolvedConfigs;
+    }
+
+    LoadUserOverlay(Stamps);
+
+    const UUtilityExtendPersistentSettings* PersistentSettings = UUtilityExtendPersistentSettings::Get();
+    const UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get();
+
+    int32 SharedNum = 0;
+    for (const FString& SharedPath : SharedConfigOrder)
+    {
+        SharedNum += SharedConfigFiles.FindChecked(SharedPath).Configs.Num();
+    }
+
+    const int32 ExpectedNum = (PersistentSettings ? PersistentSettings->GetPersistentButtonConfigs().Num() : 0)
+        + SharedNum
+        + (ProjectSettings ? ProjectSettings->ToolbarButtonConfigs.Num() : 0)
+        + UserOverlayConfigs.Num();
+
+    ResolvedConfigs.Reset(ExpectedNum);
+    ResolvedLayers.Reset(ExpectedNum);
+
+    ResolvedNameToIndex.Reset();
+    ResolvedNameToIndex.Reserve(ExpectedNum);
+
+    if (PersistentSettings)
+    {
+        MergeLayer(PersistentSettings->GetPersistentButtonConfigs(), EUtilityExtendConfigLayer::Persistent, ResolvedNameToIndex, ResolvedConfigs, ResolvedLayers);
+    }
+    for (const FString& SharedPath : SharedConfigOrder)
+    {
+        MergeLayer(SharedConfigFiles.FindChecked(SharedPath).Configs, EUtilityExtendConfigLayer::Shared, ResolvedNameToIndex, ResolvedConfigs, ResolvedLayers);
+    }
+    if (ProjectSettings)
+    {
+        MergeLayer(ProjectSettings->ToolbarButtonConfigs, EUtilityExtendConfigLayer::Project, ResolvedNameToIndex, ResolvedConfigs, ResolvedLayers);
+    }
+    MergeLayer(UserOverlayConfigs, EUtilityExtendConfigLayer::User, ResolvedNameToIndex, ResolvedConfigs, ResolvedLayers);
+
+    ResolvedStamps = Stamps;
+    bHasResolved = true;
+    ++ResolvedVersion;
+
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮配置已重新合并（版本 %u），输入 %d 个，合并后 %d 个"),
+           ResolvedVersion, ExpectedNum, ResolvedConfigs.Num());
+
+    return ResolvedConfigs;
+}
+
+bool FUtilityExtendConfigResolver::FindButtonLayer(const FString& ButtonName, EUtilityExtendConfigLayer& OutLayer)
+{
+    Resolve();
+    if (const int32* Index = ResolvedNameToIndex.Find(ButtonName))
+    {
+        OutLayer = ResolvedLayers[*Index];
+        return true;
+    }
+    return false;
+}
+
+const FToolbarButtonConfig* FUtilityExtendConfigResolver::FindResolvedButton(const FString& ButtonName)
+{
+    const TArray<FToolbarButtonConfig>& Configs = Resolve();
+    const int32* Index = ResolvedNameToIndex.Find(ButtonName);
+    return Index ? &Configs[*Index] : nullptr;
+}
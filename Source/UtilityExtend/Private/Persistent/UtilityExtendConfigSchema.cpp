@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigSchema.h"
+#include "UtilityExtendIconRegistry.h"
+
+namespace UtilityExtendConfigSchemaUtils
+{
+    typedef void (*FMigrationStep)(TArray<FToolbarButtonConfig>&);
+
+    /** 问题类型的描述 */
+    const TCHAR* GetIssueText(EUtilityExtendConfigIssue Issue)
+    {
+        switch (Issue)
+        {
+        case EUtilityExtendConfigIssue::EmptyButtonName:
+            return TEXT("按钮名称为空");
+        case EUtilityExtendConfigIssue::DuplicateButtonName:
+            return TEXT("按钮名称重复");
+        case EUtilityExtendConfigIssue::EmptyItemName:
+            return TEXT("下拉项名称为空");
+        case EUtilityExtendConfigIssue::EmptyDropdown:
+            return TEXT("下拉按钮没有下拉项");
+        case EUtilityExtendConfigIssue::MissingBoundClass:
+            return TEXT("未绑定脚本类");
+        case EUtilityExtendConfigIssue::UnknownIcon:
+            return TEXT("图标未注册");
+        default:
+            return TEXT("未知问题");
+        }
+    }
+}
+
+bool FUtilityExtendConfigSchema::Migrate(int32 FromVersion, TArray<FToolbarButtonConfig>& Configs)
+{
+    using namespace UtilityExtendConfigSchemaUtils;
+
+    // 下标为起始版本，MigrationSteps[N]把版本N升级到N+1
+    static const FMigrationStep MigrationSteps[] = {
+        &FUtilityExtendConfigSchema::MigrateV0ToV1,
+    };
+    static_assert(UE_ARRAY_COUNT(MigrationSteps) == CurrentVersion, "每个旧版本都需要一个迁移步骤");
+
+    if (FromVersion >= CurrentVersion)
+    {
+        return false;
+    }
+
+    for (int32 Version = FMath::Max(FromVersion, 0); Version < CurrentVersion; ++Version)
+    {
+        MigrationSteps[Version](Configs);
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置已从版本 %d 迁移到版本 %d"), Version, Version + 1);
+    }
+    return true;
+}
+
+void FUtilityExtendConfigSchema::MigrateV0ToV1(TArray<FToolbarButtonConfig>& Configs)
+{
+    // 旧版本允许在ButtonIconName中直接填写技术名称，当前版本统一保存友好名称
+    TMap<FName, FString> TechnicalToDisplayName;
+    for (const FToolbarIconInfo& IconInfo : FUtilityExtendIconRegistry::GetAllAvailableIconInfos())
+    {
+        TechnicalToDisplayName.Add(IconInfo.IconName, IconInfo.DisplayName);
+    }
+
+    for (FToolbarButtonConfig& Config : Configs)
+    {
+        Config.ButtonName.TrimStartAndEndInline();
+
+        if (const FString* DisplayName = TechnicalToDisplayName.Find(Config.ButtonIconName))
+        {
+            Config.ButtonIconName = FName(**DisplayName);
+        }
+
+        if (Config.ButtonType == EToolbarButtonType::SingleButton)
+        {
+            Config.DropdownItems.Empty();
+        }
+
+        for (FToolbarDropdownItem& Item : Config.DropdownItems)
+        {
+            Item.ItemName.TrimStartAndEndInline();
+        }
+    }
+}
+
+void FUtilityExtendConfigSchema::Validate(const TArray<FToolbarButtonConfig>& Configs, TArray<FUtilityExtendConfigDiagnostic>& OutDiagnostics)
+{
+    OutDiagnostics.Reset();
+
+    TSet<FName> KnownIconNames;
+    for (const FToolbarIconInfo& IconInfo : FUtilityExtendIconRegistry::GetAllAvailableIconInfos())
+    {
+        KnownIconNames.Add(FName(*IconInfo.DisplayName));
+    }
+
+    TSet<FString> SeenButtonNames;
+    SeenButtonNames.Reserve(Configs.Num());
+
+    auto AddDiagnostic = [&OutDiagnostics](EUtilityExtendConfigIssue Issue, int32 ButtonIndex, int32 ItemIndex)
+    {
+        FUtilityExtendConfigDiagnostic& Diagnostic = OutDiagnostics.AddDefaulted_GetRef();
+        Diagnostic.Issue = Issue;
+        Diagnostic.ButtonIndex = ButtonIndex;
+        Diagnostic.ItemIndex = ItemIndex;
+    };
+
+    for (int32 ButtonIndex = 0; ButtonIndex < Configs.Num(); ++ButtonIndex)
+    {
+        const FToolbarButtonConfig& Config = Configs[ButtonIndex];
+
+        if (Config.ButtonName.IsEmpty())
+        {
+            AddDiagnostic(EUtilityExtendConfigIssue::EmptyButtonName, ButtonIndex, INDEX_NONE);
+        }
+        else
+        {
+            bool bAlreadySeen = false;
+            SeenButtonNames.Add(Config.ButtonName, &bAlreadySeen);
+            if (bAlreadySeen)
+            {
+                AddDiagnostic(EUtilityExtendConfigIssue::DuplicateButtonName, ButtonIndex, INDEX_NONE);
+            }
+        }
+
+        if (!Config.ButtonIconName.IsNone() && !KnownIconNames.Contains(Config.ButtonIconName))
+        {
+            AddDiagnostic(EUtilityExtendConfigIssue::UnknownIcon, ButtonIndex, INDEX_NONE);
+        }
+
+        if (Config.ButtonType == EToolbarButtonType::SingleButton)
+        {
+            if (Config.BoundClass.IsNull())
+            {
+                AddDiagnostic(EUtilityExtendConfigIssue::MissingBoundClass, ButtonIndex, INDEX_NONE);
+            }
+            continue;
+        }
+
+        if (Config.DropdownItems.Num() == 0)
+        {
+            AddDiagnostic(EUtilityExtendConfigIssue::EmptyDropdown, ButtonIndex, INDEX_NONE);
+        }
+
+        for (int32 ItemIndex = 0; ItemIndex < Config.DropdownItems.Num(); ++ItemIndex)
+        {
+            const FToolbarDropdownItem& Item = Config.DropdownItems[ItemIndex];
+            if (Item.ItemName.IsEmpty())
+            {
+                AddDiagnostic(EUtilityExtendConfigIssue::EmptyItemName, ButtonIndex, ItemIndex);
+            }
+            if (Item.BoundClass.IsNull())
+            {
+                AddDiagnostic(EUtilityExtendConfigIssue::MissingBoundClass, ButtonIndex, ItemIndex);
+            }
+        }
+    }
+}
+
+FString FUtilityExtendConfigSchema::DescribeDiagnostic(const FUtilityExtendConfigDiagnostic& Diagnostic, const TArray<FToolbarButtonConfig>& Configs)
+{
+    const TCHAR* IssueText = UtilityExtendConfigSchemaUtils::GetIssueText(Diagnostic.Issue);
+    if (!Configs.IsValidIndex(Diagnostic.ButtonIndex))
+    {
+        return FString::Printf(TEXT("按钮[%d]: %s"), Diagnostic.ButtonIndex, IssueText);
+    }
+
+    const FToolbarButtonConfig& Config = Configs[Diagnostic.ButtonIndex];
+    if (Diagnostic.ItemIndex == INDEX_NONE)
+    {
+        return FString::Printf(TEXT("按钮[%d] '%s': %s"), Diagnostic.ButtonIndex, *Config.ButtonName, IssueText);
+    }
+
+    const FString ItemName = Config.DropdownItems.IsValidIndex(Diagnostic.ItemIndex) ? Config.DropdownItems[Diagnostic.ItemIndex].ItemName : FString();
+    return FString::Printf(TEXT("按钮[%d] '%s' 下拉项[%d] '%s': %s"), Diagnostic.ButtonIndex, *Config.ButtonName, Diagnostic.ItemIndex, *ItemName, IssueText);
+}
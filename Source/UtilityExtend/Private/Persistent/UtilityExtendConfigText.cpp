@@ -0,0 +1,304 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Persistent/UtilityExtendConfigText.h"
+
+namespace UtilityExtendConfigTextUtils
+{
+    /** 反斜杠后的字符是否构成转义 */
+    bool IsEscapedChar(TCHAR Char)
+    {
+        return Char == TEXT('"') || Char == TEXT('\\');
+    }
+}
+
+FString FUtilityExtendConfigTextReader::FValue::ToString() const
+{
+    if (!bHasEscapes)
+    {
+        return FString(Text);
+    }
+
+    FString Result;
+    FUtilityExtendConfigText::AppendUnescaped(Result, Text);
+    return Result;
+}
+
+bool FUtilityExtendConfigTextReader::FValue::Equals(const TCHAR* Other) const
+{
+    if (bHasEscapes)
+    {
+        return ToString().Equals(Other, ESearchCase::IgnoreCase);
+    }
+    return Text.Equals(Other, ESearchCase::IgnoreCase);
+}
+
+FUtilityExtendConfigTextReader::FUtilityExtendConfigTextReader(const TCHAR* InText)
+    : Start(InText)
+    , Cursor(InText)
+    , End(nullptr)
+{
+}
+
+FUtilityExtendConfigTextReader::FUtilityExtendConfigTextReader(FStringView InText)
+    : Start(InText.GetData())
+    , Cursor(InText.GetData())
+    , End(InText.GetData() + InText.Len())
+{
+}
+
+void FUtilityExtendConfigTextReader::SetError(const TCHAR* Message)
+{
+    if (Error.IsEmpty())
+    {
+        Error = FString::Printf(TEXT("%s (位置 %d)"), Message, GetOffset());
+    }
+}
+
+void FUtilityExtendConfigTextReader::SkipWhitespace()
+{
+    while (FChar::IsWhitespace(Peek()))
+    {
+        ++Cursor;
+    }
+}
+
+void FUtilityExtendConfigTextReader::SkipSeparators()
+{
+    for (TCHAR Char = Peek(); FChar::IsWhitespace(Char) || Char == TEXT(','); Char = Peek())
+    {
+        ++Cursor;
+    }
+}
+
+bool FUtilityExtendConfigTextReader::IsGroupNext()
+{
+    SkipWhitespace();
+    return Peek() == TEXT('(');
+}
+
+bool FUtilityExtendConfigTextReader::BeginGroup()
+{
+    SkipWhitespace();
+    if (Peek() != TEXT('('))
+    {
+        SetError(TEXT("缺少'('"));
+        return false;
+    }
+    ++Cursor;
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::NextField(FStringView& OutKey)
+{
+    if (HasError())
+    {
+        return false;
+    }
+
+    SkipSeparators();
+
+    TCHAR Char = Peek();
+    if (Char == TEXT(')'))
+    {
+        ++Cursor;
+        return false;
+    }
+    if (Char == 0)
+    {
+        SetError(TEXT("缺少')'"));
+        return false;
+    }
+
+    const TCHAR* KeyStart = Cursor;
+    while (Char != 0 && Char != TEXT('=') && Char != TEXT(',') && Char != TEXT(')') && !FChar::IsWhitespace(Char))
+    {
+        ++Cursor;
+        Char = Peek();
+    }
+    OutKey = FStringView(KeyStart, static_cast<int32>(Cursor - KeyStart));
+
+    SkipWhitespace();
+    if (OutKey.IsEmpty() || Peek() != TEXT('='))
+    {
+        SetError(TEXT("键名后缺少'='"));
+        return false;
+    }
+    ++Cursor;
+
+    // 格式标记由读取器自己处理，调用方只看到之后的字段
+    if (OutKey == FUtilityExtendConfigText::FormatKey)
+    {
+        return ReadFormatMarker() && NextField(OutKey);
+    }
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::ReadFormatMarker()
+{
+    FValue Value;
+    if (!ReadValue(Value))
+    {
+        return false;
+    }
+    bEscapes = FCString::Atoi(*FString(Value.Text)) >= FUtilityExtendConfigText::EscapedFormat;
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::NextElement()
+{
+    if (HasError())
+    {
+        return false;
+    }
+
+    SkipSeparators();
+
+    const TCHAR Char = Peek();
+    if (Char == TEXT(')'))
+    {
+        ++Cursor;
+        return false;
+    }
+    if (Char != TEXT('('))
+    {
+        SetError(Char == 0 ? TEXT("缺少')'") : TEXT("列表元素缺少'('"));
+        return false;
+    }
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::ReadQuoted(FValue& OutValue)
+{
+    using namespace UtilityExtendConfigTextUtils;
+
+    ++Cursor; // 跳过开引号
+    const TCHAR* ValueStart = Cursor;
+    for (TCHAR Char = Peek(); Char != TEXT('"'); Char = Peek())
+    {
+        if (Char == 0)
+        {
+            SetError(TEXT("字符串缺少结束引号"));
+            return false;
+        }
+
+        if (bEscapes && Char == TEXT('\\') && IsEscapedChar((End && Cursor + 1 >= End) ? TCHAR(0) : Cursor[1]))
+        {
+            OutValue.bHasEscapes = true;
+            ++Cursor;
+        }
+        ++Cursor;
+    }
+
+    OutValue.Text = FStringView(ValueStart, static_cast<int32>(Cursor - ValueStart));
+    OutValue.bQuoted = true;
+    ++Cursor; // 跳过结束引号
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::SkipGroup()
+{
+    FValue Unused;
+    int32 Depth = 0;
+    for (TCHAR Char = Peek(); Char != 0; Char = Peek())
+    {
+        if (Char == TEXT('"'))
+        {
+            // 引号内的括号不计入深度
+            if (!ReadQuoted(Unused))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        ++Cursor;
+        if (Char == TEXT('('))
+        {
+            ++Depth;
+        }
+        else if (Char == TEXT(')') && --Depth == 0)
+        {
+            return true;
+        }
+    }
+
+    SetError(TEXT("缺少')'"));
+    return false;
+}
+
+bool FUtilityExtendConfigTextReader::ReadValue(FValue& OutValue)
+{
+    OutValue = FValue();
+    if (HasError())
+    {
+        return false;
+    }
+
+    SkipWhitespace();
+
+    const TCHAR Char = Peek();
+    if (Char == TEXT('"'))
+    {
+        return ReadQuoted(OutValue);
+    }
+
+    const TCHAR* ValueStart = Cursor;
+    if (Char == TEXT('('))
+    {
+        if (!SkipGroup())
+        {
+            return false;
+        }
+        OutValue.Text = FStringView(ValueStart, static_cast<int32>(Cursor - ValueStart));
+        return true;
+    }
+
+    // 无引号的值读到逗号或')'为止，去掉末尾空白（允许值中间带空格）
+    for (TCHAR Next = Peek(); Next != 0 && Next != TEXT(',') && Next != TEXT(')'); Next = Peek())
+    {
+        ++Cursor;
+    }
+    OutValue.Text = FStringView(ValueStart, static_cast<int32>(Cursor - ValueStart)).TrimEnd();
+    return true;
+}
+
+bool FUtilityExtendConfigTextReader::SkipValue()
+{
+    FValue Unused;
+    return ReadValue(Unused);
+}
+
+void FUtilityExtendConfigText::AppendFormatMarker(FString& Out)
+{
+    Out += FormatKey;
+    Out.AppendChar(TEXT('='));
+    Out.AppendInt(EscapedFormat);
+    Out.AppendChar(TEXT(','));
+}
+
+void FUtilityExtendConfigText::AppendQuoted(FString& Out, FStringView Value)
+{
+    Out.AppendChar(TEXT('"'));
+    for (const TCHAR Char : Value)
+    {
+        if (UtilityExtendConfigTextUtils::IsEscapedChar(Char))
+        {
+            Out.AppendChar(TEXT('\\'));
+        }
+        Out.AppendChar(Char);
+    }
+    Out.AppendChar(TEXT('"'));
+}
+
+void FUtilityExtendConfigText::AppendUnescaped(FString& Out, FStringView Text)
+{
+    Out.Reserve(Out.Len() + Text.Len());
+    for (int32 Index = 0; Index < Text.Len(); ++Index)
+    {
+        if (Text[Index] == TEXT('\\') && Index + 1 < Text.Len() && UtilityExtendConfigTextUtils::IsEscapedChar(Text[Index + 1]))
+        {
+            ++Index;
+        }
+        Out.AppendChar(Text[Index]);
+    }
+}
@@ -6,11 +6,40 @@
 #include "Misc/ConfigCacheIni.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
-#include "Engine/World.h"
-#include "TimerManager.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
+#include "Persistent/UtilityExtendConfigJson.h"
+#include "Persistent/UtilityExtendConfigCache.h"
+#include "Persistent/UtilityExtendConfigJournal.h"
+#include "Persistent/UtilityExtendConfigResolver.h"
+#include "Persistent/UtilityExtendConfigText.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "UtilityExtendStats.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Config Save Requests"), STAT_UtilityExtend_ConfigSaveRequests, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Config Save Writes"), STAT_UtilityExtend_ConfigSaveWrites, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Config Saves Avoided"), STAT_UtilityExtend_ConfigSavesAvoided, STATGROUP_UtilityExtend);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Config Journal Appends"), STAT_UtilityExtend_ConfigJournalAppends, STATGROUP_UtilityExtend);
+
+namespace UtilityExtendPersistentSettingsUtils
+{
+    /** 先写入同目录下的临时文件，再整体替换目标文件，写入中途崩溃不会留下半个JSON */
+    bool SaveStringToFileAtomic(const FString& Contents, const FString& FilePath)
+    {
+        const FString TempPath = FilePath + TEXT(".tmp");
+        if (!FFileHelper::SaveStringToFile(Contents, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            return false;
+        }
+        
+        if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+        {
+            IFileManager::Get().Delete(*TempPath, false, true, true);
+            return false;
+        }
+        return true;
+    }
+}
 
 UUtilityExtendPersistentSettings::UUtilityExtendPersistentSettings()
 {
@@ -25,15 +54,11 @@ UUtilityExtendPersistentSettings::UUtilityExtendPersistentSettings()
 
 UUtilityExtendPersistentSettings::~UUtilityExtendPersistentSettings()
 {
-    // 清理延迟保存计时器
-    if (GEditor)
+    // 清理延迟保存Ticker
+    if (DelayedSaveTickerHandle.IsValid())
     {
-        UWorld* EditorWorld = GEditor->GetEditorWorldContext().World();
-        if (EditorWorld && DelayedSaveTimerHandle.IsValid())
-        {
-            EditorWorld->GetTimerManager().ClearTimer(DelayedSaveTimerHandle);
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 析构函数中清理延迟保存计时器"));
-        }
+        FTSTicker::GetCoreTicker().RemoveTicker(DelayedSaveTickerHandle);
+        DelayedSaveTickerHandle.Reset();
     }
 }
 
@@ -54,7 +79,22 @@ void UUtilityExtendPersistentSettings::Initialize()
 
 void UUtilityExtendPersistentSettings::Shutdown()
 {
-    // UDeveloperSettings由引擎管理，无需手动清理
+    // UDeveloperSettings由引擎管理，这里只需确保尚未写入的修改落盘
+    if (UUtilityExtendPersistentSettings* Settings = GetMutableDefault<UUtilityExtendPersistentSettings>())
+    {
+        Settings->FlushPendingSave();
+        
+        // 关闭时把变更日志压缩回配置文件
+        if (FUtilityExtendConfigJournal::GetJournalSize(Settings->PluginConfigPath) > 0)
+        {
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 压缩配置变更日志到配置文件"));
+            Settings->SaveToPluginConfig();
+        }
+        
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 本次会话共 %d 次保存请求，实际写入 %d 次（其中追加变更日志 %d 次），合并掉 %d 次"),
+               Settings->SaveRequestCount, Settings->SaveWriteCount, Settings->JournalAppendCount, Settings->SaveRequestCount - Settings->SaveWriteCount);
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化设置系统清理完成"));
 }
 
@@ -101,12 +141,14 @@ FString UUtilityExtendPersistentSettings::GetPluginDirectory() const
 void UUtilityExtendPersistentSettings::SetPersistentButtonConfigs(const TArray<FToolbarButtonConfig>& NewConfigs)
 {
     PersistentButtonConfigs = NewConfigs;
+    ++ConfigVersion;
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 设置持久化按钮配置，数量: %d"), PersistentButtonConfigs.Num());
 }
 
 void UUtilityExtendPersistentSettings::AddPersistentButtonConfig(const FToolbarButtonConfig& Config)
 {
     PersistentButtonConfigs.Add(Config);
+    ++ConfigVersion;
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 添加持久化按钮配置: %s"), *Config.ButtonName);
 }
 
@@ -116,6 +158,7 @@ void UUtilityExtendPersistentSettings::RemovePersistentButtonConfig(int32 Index)
     {
         FString ButtonName = PersistentButtonConfigs[Index].ButtonName;
         PersistentButtonConfigs.RemoveAt(Index);
+        ++ConfigVersion;
         UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 移除持久化按钮配置: %s"), *ButtonName);
     }
 }
@@ -123,6 +166,7 @@ void UUtilityExtendPersistentSettings::RemovePersistentButtonConfig(int32 Index)
 void UUtilityExtendPersistentSettings::ClearPersistentButtonConfigs()
 {
     PersistentButtonConfigs.Empty();
+    ++ConfigVersion;
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 清空所有持久化按钮配置"));
 }
 
@@ -130,6 +174,9 @@ bool UUtilityExtendPersistentSettings::LoadFromPluginConfig()
 {
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 开始加载插件配置文件"));
     
+    // 先让尚未写入和正在写入的保存落盘，否则可能读到写了一半的文件，或者写入在加载之后完成并覆盖加载的结果
+    FlushPendingSave();
+    
     if (PluginConfigPath.IsEmpty())
     {
         UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 插件配置文件路径为空，尝试重新获取"));
@@ -165,10 +212,43 @@ bool UUtilityExtendPersistentSettings::LoadFromPluginConfig()
         return false;
     }
 
+    // 源文件未变化时直接使用二进制缓存，跳过JSON解析
+    if (FUtilityExtendConfigCache::TryLoad(PluginConfigPath, PersistentButtonConfigs))
+    {
+        // 缓存只保存当前结构版本的配置
+        bConfigFromNewerSchema = false;
+        ++ConfigVersion;
+        ReplayJournal();
+        return true;
+    }
+
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 找到JSON配置文件，开始解析: %s"), *PluginConfigPath);
 
     // 解析JSON配置文件
-    bool bSuccess = ParseJsonConfigFile();
+    bool bMigrated = false;
+    bool bSuccess = ParseJsonConfigFile(bMigrated);
+    if (bSuccess && !bConfigFromNewerSchema)
+    {
+        // 缓存只对应配置文件本身，变更日志在加载后单独回放
+        FUtilityExtendConfigCache::Store(PluginConfigPath, PersistentButtonConfigs);
+    }
+    else
+    {
+        // 更新版本的配置不进缓存，否则下次从缓存加载时会丢失只读标记
+        FUtilityExtendConfigCache::Invalidate();
+    }
+    
+    if (bSuccess)
+    {
+        ReplayJournal();
+    }
+    
+    if (bSuccess && bMigrated)
+    {
+        // 迁移只做一次：回写为当前结构版本（同时刷新缓存、合并变更日志），之后的启动直接读取新格式
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置已迁移到结构版本 %d，回写配置文件"), FUtilityExtendConfigSchema::CurrentVersion);
+        SaveToPluginConfig();
+    }
     
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 从插件配置文件加载完成，解析结果: %s，按钮数量: %d"), 
            bSuccess ? TEXT("成功") : TEXT("失败"), PersistentButtonConfigs.Num());
@@ -183,100 +263,39 @@ bool UUtilityExtendPersistentSettings::SaveToPluginConfig()
         return false;
     }
 
-    // 验证当前配置数据的完整性
-    if (!ValidateConfigData())
+    // 更新版本的配置文件中可能有当前版本不认识的字段，回写会丢失它们
+    if (bConfigFromNewerSchema)
     {
-        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 配置数据验证失败，跳过保存以防止数据损坏"));
+        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 配置文件的结构版本高于当前插件支持的版本 %d，跳过保存以防止数据丢失"), FUtilityExtendConfigSchema::CurrentVersion);
         return false;
     }
 
-    // 备份功能已移除 - 直接保存配置文件
-
-    // 创建JSON对象
-    TSharedPtr<FJsonObject> RootObject = MakeShareable(new FJsonObject);
-    TArray<TSharedPtr<FJsonValue>> ButtonConfigsArray;
-
-    // 将按钮配置转换为JSON
-    for (const FToolbarButtonConfig& Config : PersistentButtonConfigs)
-    {
-        TSharedPtr<FJsonObject> ConfigObject = MakeShareable(new FJsonObject);
-        
-        ConfigObject->SetStringField(TEXT("ButtonName"), Config.ButtonName);
-        ConfigObject->SetStringField(TEXT("ButtonType"), Config.ButtonType == EToolbarButtonType::SingleButton ? TEXT("SingleButton") : TEXT("DropdownButton"));
-        ConfigObject->SetStringField(TEXT("ButtonIconName"), Config.ButtonIconName.ToString());
-        ConfigObject->SetBoolField(TEXT("bShowButtonText"), Config.bShowButtonText);
-        
-        // 单按钮绑定类 - 🔧 修复保存时被清空的问题
-        FString ButtonBoundClassStr;
-        if (Config.BoundClass.IsValid())
-        {
-            ButtonBoundClassStr = Config.BoundClass.ToString();
-        }
-        else if (Config.BoundClass.IsNull())
-        {
-            ButtonBoundClassStr = TEXT("None");
-        }
-        else
-        {
-            // 未加载状态，保持原路径
-            ButtonBoundClassStr = Config.BoundClass.ToSoftObjectPath().ToString();
-            if (ButtonBoundClassStr.IsEmpty())
-            {
-                ButtonBoundClassStr = TEXT("None");
-            }
-        }
-        ConfigObject->SetStringField(TEXT("BoundClass"), ButtonBoundClassStr);
-        
-        // 下拉项
-        if (Config.ButtonType == EToolbarButtonType::DropdownButton)
-        {
-            TArray<TSharedPtr<FJsonValue>> DropdownItemsArray;
-            for (const FToolbarDropdownItem& Item : Config.DropdownItems)
-            {
-                TSharedPtr<FJsonObject> ItemObject = MakeShareable(new FJsonObject);
-                ItemObject->SetStringField(TEXT("ItemName"), Item.ItemName);
-                
-                // 🔧 修复JSON保存时BoundClass被清空的问题
-                FString BoundClassStr;
-                if (Item.BoundClass.IsValid())
-                {
-                    BoundClassStr = Item.BoundClass.ToString();
-                }
-                else if (Item.BoundClass.IsNull())
-                {
-                    BoundClassStr = TEXT("None");
-                }
-                else
-                {
-                    // 未加载状态，保持原路径
-                    BoundClassStr = Item.BoundClass.ToSoftObjectPath().ToString();
-                    if (BoundClassStr.IsEmpty())
-                    {
-                        BoundClassStr = TEXT("None");
-                    }
-                }
-                ItemObject->SetStringField(TEXT("BoundClass"), BoundClassStr);
-                
-                DropdownItemsArray.Add(MakeShareable(new FJsonValueObject(ItemObject)));
-            }
-            ConfigObject->SetArrayField(TEXT("DropdownItems"), DropdownItemsArray);
-        }
-        
-        ButtonConfigsArray.Add(MakeShareable(new FJsonValueObject(ConfigObject)));
-    }
+    GetConfigDiagnostics();
 
-    RootObject->SetArrayField(TEXT("PersistentButtonConfigs"), ButtonConfigsArray);
+    // 备份功能已移除 - 直接保存配置文件
 
-    // 序列化JSON到字符串
+    // 流式写出JSON，不再构建中间的FJsonObject
     FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RootObject.ToSharedRef(), Writer);
+    FUtilityExtendConfigJson::WriteButtonConfigs(PersistentButtonConfigs, OutputString);
 
-    // 保存到文件
-    bool bSaved = FFileHelper::SaveStringToFile(OutputString, *PluginConfigPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    // 同步保存前先等待后台保存结束，避免两次写入交错
+    CompleteInFlightSave();
+    
+    // 这次同步保存已包含所有待保存的修改
+    bSaveRequested = false;
+    
+    // 保存到文件；同步保存同样计为一次请求，与延迟保存的统计口径一致
+    bool bSaved = UtilityExtendPersistentSettingsUtils::SaveStringToFileAtomic(OutputString, PluginConfigPath);
+    ++SaveRequestCount;
+    ++SaveWriteCount;
+    UpdateSaveStats();
     
     if (bSaved)
     {
+        // 内存中的配置就是刚写出的内容，直接刷新缓存，下次启动无需重新解析
+        FUtilityExtendConfigCache::Store(PluginConfigPath, PersistentButtonConfigs);
+        FUtilityExtendConfigJournal::Delete(PluginConfigPath);
+        OnFullSaveSubmitted(PersistentButtonConfigs);
         UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化配置已保存到JSON文件: %s"), *PluginConfigPath);
     }
     else
@@ -294,6 +313,9 @@ void UUtilityExtendPersistentSettings::ReloadConfig()
     // 尝试从JSON文件加载配置
     bool bLoadSuccess = LoadFromPluginConfig();
     
+    // 共享配置目录一并重新扫描，内容哈希未变化的文件不会重新解析
+    FUtilityExtendConfigResolver::Get().Invalidate();
+    
     if (bLoadSuccess)
     {
         UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置重新加载成功，当前按钮数量: %d"), PersistentButtonConfigs.Num());
@@ -304,98 +326,34 @@ void UUtilityExtendPersistentSettings::ReloadConfig()
     }
 }
 
-bool UUtilityExtendPersistentSettings::ParseJsonConfigFile()
+bool UUtilityExtendPersistentSettings::ParseJsonConfigFile(bool& bOutMigrated)
 {
-    // 读取JSON文件内容
-    FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *PluginConfigPath))
-    {
-        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 无法读取JSON配置文件: %s"), *PluginConfigPath);
-        return false;
-    }
+    bOutMigrated = false;
 
-    // 解析JSON
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    // 先解析到临时数组，确保所有数据都正确后再替换
+    TArray<FToolbarButtonConfig> NewConfigs;
+    FString ErrorMessage;
+    int32 FileSchemaVersion = 0;
+    if (!FUtilityExtendConfigJson::ReadButtonConfigsFromFile(PluginConfigPath, NewConfigs, ErrorMessage, &FileSchemaVersion))
     {
-        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: JSON配置文件解析失败: %s"), *PluginConfigPath);
+        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: JSON配置文件解析失败: %s (%s)"), *PluginConfigPath, *ErrorMessage);
         return false;
     }
 
-    // 获取按钮配置数组
-    const TArray<TSharedPtr<FJsonValue>>* ButtonConfigsArray;
-    if (!JsonObject->TryGetArrayField(TEXT("PersistentButtonConfigs"), ButtonConfigsArray))
+    bConfigFromNewerSchema = FileSchemaVersion > FUtilityExtendConfigSchema::CurrentVersion;
+    if (bConfigFromNewerSchema)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: JSON配置文件中未找到PersistentButtonConfigs字段"));
-        return false;
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置文件结构版本 %d 高于当前支持的版本 %d，按只读方式加载"),
+               FileSchemaVersion, FUtilityExtendConfigSchema::CurrentVersion);
     }
-
-    // 先解析到临时数组，确保所有数据都正确后再替换
-    TArray<FToolbarButtonConfig> NewConfigs;
-
-    // 解析每个按钮配置
-    for (const TSharedPtr<FJsonValue>& Value : *ButtonConfigsArray)
+    else
     {
-        TSharedPtr<FJsonObject> ConfigObject = Value->AsObject();
-        if (!ConfigObject.IsValid())
-        {
-            continue;
-        }
-
-        FToolbarButtonConfig ParsedConfig;
-        
-        // 解析基本字段
-        ParsedConfig.ButtonName = ConfigObject->GetStringField(TEXT("ButtonName"));
-        
-        FString ButtonTypeString = ConfigObject->GetStringField(TEXT("ButtonType"));
-        ParsedConfig.ButtonType = (ButtonTypeString == TEXT("SingleButton")) ? EToolbarButtonType::SingleButton : EToolbarButtonType::DropdownButton;
-        
-        ParsedConfig.ButtonIconName = FName(*ConfigObject->GetStringField(TEXT("ButtonIconName")));
-        ParsedConfig.bShowButtonText = ConfigObject->GetBoolField(TEXT("bShowButtonText"));
-        
-        // 解析单按钮绑定类
-        FString BoundClassString = ConfigObject->GetStringField(TEXT("BoundClass"));
-        if (BoundClassString != TEXT("None") && !BoundClassString.IsEmpty())
-        {
-            ParsedConfig.BoundClass = TSoftClassPtr<UUtilityExtendTopBarButtonScript>(FSoftObjectPath(BoundClassString));
-        }
-        
-        // 解析下拉项
-        if (ParsedConfig.ButtonType == EToolbarButtonType::DropdownButton)
-        {
-            const TArray<TSharedPtr<FJsonValue>>* DropdownItemsArray;
-            if (ConfigObject->TryGetArrayField(TEXT("DropdownItems"), DropdownItemsArray))
-            {
-                for (const TSharedPtr<FJsonValue>& ItemValue : *DropdownItemsArray)
-                {
-                    TSharedPtr<FJsonObject> ItemObject = ItemValue->AsObject();
-                    if (!ItemObject.IsValid())
-                    {
-                        continue;
-                    }
-
-                    FToolbarDropdownItem DropdownItem;
-                    DropdownItem.ItemName = ItemObject->GetStringField(TEXT("ItemName"));
-                    
-                    FString ItemBoundClassString = ItemObject->GetStringField(TEXT("BoundClass"));
-                    if (ItemBoundClassString != TEXT("None") && !ItemBoundClassString.IsEmpty())
-                    {
-                        DropdownItem.BoundClass = TSoftClassPtr<UUtilityExtendTopBarButtonScript>(FSoftObjectPath(ItemBoundClassString));
-                    }
-                    
-                    ParsedConfig.DropdownItems.Add(DropdownItem);
-                }
-            }
-        }
-        
-        NewConfigs.Add(ParsedConfig);
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 成功解析JSON按钮配置: %s"), *ParsedConfig.ButtonName);
+        bOutMigrated = FUtilityExtendConfigSchema::Migrate(FileSchemaVersion, NewConfigs);
     }
 
     // 只有在完全成功解析后才替换现有配置
     PersistentButtonConfigs = MoveTemp(NewConfigs);
+    ++ConfigVersion;
     
     UE_LOG(LogTemp, Log, TEXT("UtilityExtend: JSON配置文件解析完成，共加载 %d 个按钮配置"), PersistentButtonConfigs.Num());
     return true;
@@ -473,22 +431,12 @@ void UUtilityExtendPersistentSettings::PostEditChangeProperty(FPropertyChangedEv
     // 不调用Super，防止保存到项目配置文件
     // Super::PostEditChangeProperty(PropertyChangedEvent);
     
-    // 当属性被修改时，立即保存到插件配置文件
+    // 属性修改后安排延迟保存：连续输入时只在停止编辑后写入一次，并在关闭时强制落盘
     if (PropertyChangedEvent.Property)
     {
-        const FName PropertyName = PropertyChangedEvent.Property->GetFName();
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化设置属性已修改: %s，立即保存"), *PropertyName.ToString());
-        
-        // 立即保存，避免延迟保存导致的数据丢失
-        bool bSaveSuccess = SaveToPluginConfig();
-        if (bSaveSuccess)
-        {
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置保存成功"));
-        }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 配置保存失败"));
-        }
+        UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 持久化设置属性已修改: %s"), *PropertyChangedEvent.Property->GetName());
+        ++ConfigVersion;
+        ScheduleDelayedSave();
     }
 }
 
@@ -497,81 +445,34 @@ bool UUtilityExtendPersistentSettings::ParseButtonConfigFromString(const FString
     // 重置输出配置
     OutConfig = FToolbarButtonConfig();
     
-    // 移除最外层括号
-    FString CleanString = ConfigString;
-    CleanString = CleanString.TrimStartAndEnd();
-    
-    if (CleanString.StartsWith(TEXT("(")) && CleanString.EndsWith(TEXT(")")))
+    // 旧格式允许省略最外层括号，只有这种情况才需要拷贝一次
+    FStringView ConfigText = FStringView(ConfigString).TrimStartAndEnd();
+    FString WrappedString;
+    if (!ConfigText.StartsWith(TEXT('(')))
     {
-        CleanString = CleanString.Mid(1, CleanString.Len() - 2);
+        WrappedString.Reserve(ConfigText.Len() + 2);
+        WrappedString.AppendChar(TEXT('('));
+        WrappedString.Append(ConfigText);
+        WrappedString.AppendChar(TEXT(')'));
+        ConfigText = WrappedString;
     }
     
-    // 手动解析参数，因为DropdownItems包含嵌套的括号
-    TArray<FString> Parameters;
-    ParseTopLevelParameters(CleanString, Parameters);
+    // 与ImportTextItem共用同一个单遍读取器，引号内的逗号和括号不会被误拆分
+    FUtilityExtendConfigTextReader Reader(ConfigText);
+    if (!OutConfig.ImportFromReader(Reader))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 解析按钮配置失败: %s"), *Reader.GetError());
+        return false;
+    }
     
-    for (const FString& Parameter : Parameters)
+    // 与旧解析器保持一致：丢弃没有名称的下拉项
+    const int32 RemovedItems = OutConfig.DropdownItems.RemoveAll([](const FToolbarDropdownItem& Item)
     {
-        FString Key, Value;
-        if (Parameter.Split(TEXT("="), &Key, &Value))
-        {
-            Key = Key.TrimStartAndEnd();
-            Value = Value.TrimStartAndEnd();
-            
-            // 移除值的引号
-            Value = Value.Replace(TEXT("\""), TEXT(""));
-            
-            if (Key == TEXT("ButtonName"))
-            {
-                OutConfig.ButtonName = Value;
-            }
-            else if (Key == TEXT("ButtonType"))
-            {
-                // 解析按钮类型
-                if (Value == TEXT("SingleButton") || Value == TEXT("EToolbarButtonType::SingleButton"))
-                {
-                    OutConfig.ButtonType = EToolbarButtonType::SingleButton;
-                }
-                else if (Value == TEXT("DropdownButton") || Value == TEXT("EToolbarButtonType::DropdownButton"))
-                {
-                    OutConfig.ButtonType = EToolbarButtonType::DropdownButton;
-                }
-
-                else
-                {
-                    // 默认为单按钮
-                    OutConfig.ButtonType = EToolbarButtonType::SingleButton;
-                }
-            }
-            else if (Key == TEXT("BoundClass"))
-            {
-                // 解析单个按钮的绑定类
-                if (Value != TEXT("None") && !Value.IsEmpty())
-                {
-                    OutConfig.BoundClass = TSoftClassPtr<UUtilityExtendTopBarButtonScript>(FSoftObjectPath(Value));
-                }
-            }
-            else if (Key == TEXT("ButtonIconName"))
-            {
-                if (!Value.IsEmpty())
-                {
-                    OutConfig.ButtonIconName = FName(*Value);
-                }
-            }
-            else if (Key == TEXT("bShowButtonText"))
-            {
-                // 解析布尔值
-                OutConfig.bShowButtonText = (Value.ToLower() == TEXT("true") || Value == TEXT("1"));
-            }
-            else if (Key == TEXT("DropdownItems"))
-            {
-                // 解析下拉项
-                if (!ParseDropdownItemsFromString(Value, OutConfig.DropdownItems))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 解析下拉项失败: %s"), *Value);
-                }
-            }
-        }
+        return Item.ItemName.IsEmpty();
+    });
+    if (RemovedItems > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 按钮 %s 中有 %d 个下拉项缺少ItemName，已忽略"), *OutConfig.ButtonName, RemovedItems);
     }
     
     // 检查必要字段是否已设置
@@ -599,284 +500,249 @@ bool UUtilityExtendPersistentSettings::ParseButtonConfigFromString(const FString
     return true;
 }
 
-bool UUtilityExtendPersistentSettings::ParseDropdownItemsFromString(const FString& DropdownString, TArray<FToolbarDropdownItem>& OutItems)
+void UUtilityExtendPersistentSettings::ScheduleDelayedSave()
 {
-    OutItems.Empty();
+    bSaveRequested = true;
+    LastSaveRequestTime = FPlatformTime::Seconds();
+    ++SaveRequestCount;
+    UpdateSaveStats();
     
-    // 移除外层括号
-    FString CleanString = DropdownString;
-    CleanString = CleanString.TrimStartAndEnd();
+    // 使用核心Ticker而不是编辑器世界的TimerManager，切换地图或没有世界时同样有效
+    if (!DelayedSaveTickerHandle.IsValid())
+    {
+        DelayedSaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UUtilityExtendPersistentSettings::TickDelayedSave), 0.1f);
+    }
+}
+
+bool UUtilityExtendPersistentSettings::TickDelayedSave(float DeltaTime)
+{
+    if (!bSaveRequested)
+    {
+        DelayedSaveTickerHandle.Reset();
+        return false;
+    }
     
-    // 如果字符串为空或只有括号，返回true（空的下拉项是有效的）
-    if (CleanString.IsEmpty() || CleanString == TEXT("()"))
+    // 仍在编辑，或上一次保存还没写完时继续等待，期间的修改会合并到下一次保存
+    const bool bStillEditing = FPlatformTime::Seconds() - LastSaveRequestTime < SaveDelayTime;
+    const bool bSaveInFlight = InFlightSave.IsValid() && !InFlightSave.IsReady();
+    if (bStillEditing || bSaveInFlight)
     {
         return true;
     }
     
-    // 移除最外层的括号
-    if (CleanString.StartsWith(TEXT("(")) && CleanString.EndsWith(TEXT(")")))
+    StartAsyncSave();
+    DelayedSaveTickerHandle.Reset();
+    return false;
+}
+
+void UUtilityExtendPersistentSettings::StartAsyncSave()
+{
+    // 调用方保证上一次保存已经结束；它失败时已清除日志基准，这次改为整文件写入
+    CompleteInFlightSave();
+    bSaveRequested = false;
+    
+    if (PluginConfigPath.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 插件配置文件路径为空，无法保存"));
+        return;
+    }
+    
+    if (bConfigFromNewerSchema)
     {
-        CleanString = CleanString.Mid(1, CleanString.Len() - 2);
+        UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 配置文件的结构版本高于当前插件支持的版本 %d，跳过保存以防止数据丢失"), FUtilityExtendConfigSchema::CurrentVersion);
+        return;
     }
     
-    // 解析下拉项 - 格式: (ItemName="...",BoundClass=...),(ItemName="...",BoundClass=...)
-    TArray<FString> ItemStrings;
+    GetConfigDiagnostics();
     
-    // 使用简单的括号匹配来分割项目
-    int32 BracketCount = 0;
-    int32 StartIndex = 0;
+    const FString ConfigPath = PluginConfigPath;
     
-    for (int32 i = 0; i < CleanString.Len(); i++)
+    if (ShouldAppendToJournal())
     {
-        TCHAR CurrentChar = CleanString[i];
-        
-        if (CurrentChar == TEXT('('))
+        TArray<FUtilityExtendJournalRecord> Records;
+        FUtilityExtendConfigJournal::Diff(JournalBaseline, PersistentButtonConfigs, Records);
+        if (Records.Num() == 0)
         {
-            BracketCount++;
+            return;
         }
-        else if (CurrentChar == TEXT(')'))
+        
+        // 写入成功后才更新日志基准
+        InFlightBaseline = PersistentButtonConfigs;
+        bInFlightHasBaseline = true;
+        ++SaveWriteCount;
+        ++JournalAppendCount;
+        UpdateSaveStats();
+        
+        InFlightSave = Async(EAsyncExecution::ThreadPool, [Records = MoveTemp(Records), ConfigPath]()
         {
-            BracketCount--;
-            
-            // 当括号匹配完成时，提取一个完整的项目
-            if (BracketCount == 0)
+            const int64 WrittenBytes = FUtilityExtendConfigJournal::Append(ConfigPath, Records);
+            if (WrittenBytes < 0)
             {
-                FString ItemString = CleanString.Mid(StartIndex, i - StartIndex + 1);
-                ItemStrings.Add(ItemString);
-                
-                // 寻找下一个项目的开始（跳过逗号）
-                for (int32 j = i + 1; j < CleanString.Len(); j++)
-                {
-                    if (CleanString[j] == TEXT('('))
-                    {
-                        StartIndex = j;
-                        i = j - 1; // -1 because the loop will increment
-                        break;
-                    }
-                }
+                UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 追加配置变更日志失败: %s"), *ConfigPath);
+                return false;
             }
-        }
+            
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 已追加配置变更日志 %d 条记录（%lld 字节）"), Records.Num(), WrittenBytes);
+            return true;
+        });
+        return;
+    }
+    
+    // 后台线程只接触配置的快照，游戏线程可以继续修改
+    TArray<FToolbarButtonConfig> Snapshot = PersistentButtonConfigs;
+    bInFlightHasBaseline = ShouldKeepJournalBaseline();
+    if (bInFlightHasBaseline)
+    {
+        InFlightBaseline = Snapshot;
     }
+    ++SaveWriteCount;
+    UpdateSaveStats();
     
-    // 解析每个项目
-    for (const FString& ItemString : ItemStrings)
+    InFlightSave = Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), ConfigPath]()
     {
-        FToolbarDropdownItem Item;
-        if (ParseSingleDropdownItem(ItemString, Item))
+        FString OutputString;
+        FUtilityExtendConfigJson::WriteButtonConfigs(Snapshot, OutputString);
+        
+        const bool bSaved = UtilityExtendPersistentSettingsUtils::SaveStringToFileAtomic(OutputString, ConfigPath);
+        if (bSaved)
         {
-            OutItems.Add(Item);
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 成功解析下拉项: %s"), *Item.ItemName);
+            // 配置文件已包含全部修改，变更日志随之作废
+            FUtilityExtendConfigCache::Store(ConfigPath, Snapshot);
+            FUtilityExtendConfigJournal::Delete(ConfigPath);
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化配置已在后台保存: %s"), *ConfigPath);
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 解析下拉项失败: %s"), *ItemString);
+            UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 后台保存持久化配置失败: %s"), *ConfigPath);
         }
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉项解析完成，共解析出 %d 个项目"), OutItems.Num());
-    return true;
+        return bSaved;
+    });
 }
 
-bool UUtilityExtendPersistentSettings::ParseSingleDropdownItem(const FString& ItemString, FToolbarDropdownItem& OutItem)
+void UUtilityExtendPersistentSettings::FlushPendingSave()
 {
-    OutItem = FToolbarDropdownItem();
-    
-    // 移除外层括号
-    FString CleanString = ItemString;
-    CleanString = CleanString.TrimStartAndEnd();
-    
-    if (CleanString.StartsWith(TEXT("(")) && CleanString.EndsWith(TEXT(")")))
+    if (DelayedSaveTickerHandle.IsValid())
     {
-        CleanString = CleanString.Mid(1, CleanString.Len() - 2);
+        FTSTicker::GetCoreTicker().RemoveTicker(DelayedSaveTickerHandle);
+        DelayedSaveTickerHandle.Reset();
     }
     
-    // 按逗号分割参数
-    TArray<FString> Parameters;
-    CleanString.ParseIntoArray(Parameters, TEXT(","), true);
+    // 等待上一次写入完成；它失败时会重新标记为待保存，下面用整文件写入重试
+    CompleteInFlightSave();
     
-    for (const FString& Parameter : Parameters)
+    if (bSaveRequested)
     {
-        FString Key, Value;
-        if (Parameter.Split(TEXT("="), &Key, &Value))
-        {
-            Key = Key.TrimStartAndEnd();
-            Value = Value.TrimStartAndEnd();
-            
-            // 移除值的引号
-            Value = Value.Replace(TEXT("\""), TEXT(""));
-            
-            if (Key == TEXT("ItemName"))
-            {
-                OutItem.ItemName = Value;
-            }
-            else if (Key == TEXT("BoundClass"))
-            {
-                if (Value != TEXT("None") && !Value.IsEmpty())
-                {
-                    // 尝试解析软类引用
-                    OutItem.BoundClass = TSoftClassPtr<UUtilityExtendTopBarButtonScript>(FSoftObjectPath(Value));
-                }
-            }
-        }
-    }
-    
-    // 检查必要字段是否已设置
-    if (OutItem.ItemName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 解析下拉项失败 - 缺少ItemName"));
-        return false;
+        StartAsyncSave();
+        CompleteInFlightSave();
     }
-    
-    return true;
 }
 
-void UUtilityExtendPersistentSettings::ParseTopLevelParameters(const FString& ParameterString, TArray<FString>& OutParameters)
+void UUtilityExtendPersistentSettings::CompleteInFlightSave()
 {
-    OutParameters.Empty();
+    if (!InFlightSave.IsValid())
+    {
+        return;
+    }
     
-    int32 BracketCount = 0;
-    int32 StartIndex = 0;
+    const bool bSaved = InFlightSave.Get();
+    InFlightSave = TFuture<bool>();
     
-    for (int32 i = 0; i < ParameterString.Len(); i++)
+    if (bSaved && bInFlightHasBaseline)
     {
-        TCHAR CurrentChar = ParameterString[i];
-        
-        if (CurrentChar == TEXT('('))
-        {
-            BracketCount++;
-        }
-        else if (CurrentChar == TEXT(')'))
-        {
-            BracketCount--;
-        }
-        else if (CurrentChar == TEXT(',') && BracketCount == 0)
-        {
-            // 在顶层遇到逗号，分割参数
-            FString Parameter = ParameterString.Mid(StartIndex, i - StartIndex);
-            Parameter = Parameter.TrimStartAndEnd();
-            if (!Parameter.IsEmpty())
-            {
-                OutParameters.Add(Parameter);
-            }
-            StartIndex = i + 1;
-        }
+        OnFullSaveSubmitted(InFlightBaseline);
     }
-    
-    // 添加最后一个参数
-    if (StartIndex < ParameterString.Len())
+    else if (bSaved)
     {
-        FString Parameter = ParameterString.Mid(StartIndex);
-        Parameter = Parameter.TrimStartAndEnd();
-        if (!Parameter.IsEmpty())
-        {
-            OutParameters.Add(Parameter);
-        }
+        // 写入时没有保留快照（期间才启用日志模式），下一次保存整文件写入后再建立基准
+        bHasJournalBaseline = false;
+        JournalBaseline.Empty();
     }
+    else
+    {
+        // 磁盘上的内容不确定，日志基准作废，修改保留到下一次保存时整文件写入
+        bHasJournalBaseline = false;
+        JournalBaseline.Empty();
+        bSaveRequested = true;
+    }
+    InFlightBaseline.Empty();
+    bInFlightHasBaseline = false;
 }
 
-void UUtilityExtendPersistentSettings::ScheduleDelayedSave()
+void UUtilityExtendPersistentSettings::UpdateSaveStats() const
 {
-    // 获取编辑器世界，因为这是编辑器插件
-    UWorld* EditorWorld = nullptr;
-    if (GEditor)
+    SET_DWORD_STAT(STAT_UtilityExtend_ConfigSaveRequests, SaveRequestCount);
+    SET_DWORD_STAT(STAT_UtilityExtend_ConfigSaveWrites, SaveWriteCount);
+    SET_DWORD_STAT(STAT_UtilityExtend_ConfigSavesAvoided, FMath::Max(0, SaveRequestCount - SaveWriteCount));
+    SET_DWORD_STAT(STAT_UtilityExtend_ConfigJournalAppends, JournalAppendCount);
+}
+
+void UUtilityExtendPersistentSettings::ReplayJournal()
+{
+    // 即使没有启用日志模式也要回放残留的日志，下一次整文件写入时再把它合并掉
+    if (FUtilityExtendConfigJournal::Replay(PluginConfigPath, PersistentButtonConfigs) > 0)
     {
-        EditorWorld = GEditor->GetEditorWorldContext().World();
+        ++ConfigVersion;
     }
-    
-    if (EditorWorld && DelayedSaveTimerHandle.IsValid())
+    OnFullSaveSubmitted(PersistentButtonConfigs);
+}
+
+bool UUtilityExtendPersistentSettings::ShouldAppendToJournal() const
+{
+    const UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get();
+    if (!ProjectSettings || !ProjectSettings->bUsePersistentConfigJournal || !bHasJournalBaseline)
     {
-        // 如果已经有计时器在运行，清除它
-        EditorWorld->GetTimerManager().ClearTimer(DelayedSaveTimerHandle);
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 清除现有的延迟保存计时器"));
+        return false;
     }
     
-    if (EditorWorld)
+    // 日志超过阈值时压缩回配置文件，避免回放的记录无限增长
+    const int64 CompactBytes = static_cast<int64>(FMath::Max(ProjectSettings->PersistentConfigJournalCompactKB, 1)) * 1024;
+    return FUtilityExtendConfigJournal::GetJournalSize(PluginConfigPath) < CompactBytes;
+}
+
+bool UUtilityExtendPersistentSettings::ShouldKeepJournalBaseline() const
+{
+    const UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get();
+    return ProjectSettings && ProjectSettings->bUsePersistentConfigJournal;
+}
+
+void UUtilityExtendPersistentSettings::OnFullSaveSubmitted(const TArray<FToolbarButtonConfig>& SavedConfigs)
+{
+    // 只在日志模式下保留已保存状态的副本，默认模式不额外占用内存
+    bHasJournalBaseline = ShouldKeepJournalBaseline();
+    if (bHasJournalBaseline)
     {
-        // 设置新的延迟保存计时器
-        EditorWorld->GetTimerManager().SetTimer(
-            DelayedSaveTimerHandle,
-            [this]()
-            {
-                UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 执行延迟保存配置"));
-                bool bSaveSuccess = SaveToPluginConfig();
-                if (bSaveSuccess)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 延迟保存配置成功"));
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Error, TEXT("UtilityExtend: 延迟保存配置失败"));
-                }
-                
-                // 清除计时器句柄
-                DelayedSaveTimerHandle.Invalidate();
-            },
-            SaveDelayTime,
-            false  // 不循环
-        );
-        
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 安排延迟保存，延迟时间: %.1f 秒"), SaveDelayTime);
+        JournalBaseline = SavedConfigs;
     }
     else
     {
-        // 如果无法获取编辑器世界，回退到立即保存
-        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法获取编辑器世界，使用立即保存"));
-        SaveToPluginConfig();
+        JournalBaseline.Empty();
     }
 }
 
-bool UUtilityExtendPersistentSettings::ValidateConfigData() const
+const TArray<FUtilityExtendConfigDiagnostic>& UUtilityExtendPersistentSettings::GetConfigDiagnostics() const
 {
-    // 验证按钮配置数组 - 使用宽松的验证，允许部分配置为空
-    for (int32 i = 0; i < PersistentButtonConfigs.Num(); ++i)
+    if (ValidatedConfigVersion == ConfigVersion)
     {
-        const FToolbarButtonConfig& Config = PersistentButtonConfigs[i];
-        
-        // 只记录警告，不阻止保存 - 用户可能正在配置过程中
-        if (Config.ButtonName.IsEmpty())
-        {
-            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置验证警告 - 按钮 %d 的名称为空，但仍允许保存"), i);
-        }
-        
-        // 如果是下拉按钮，验证下拉项 - 也使用宽松验证
-        if (Config.ButtonType == EToolbarButtonType::DropdownButton)
-        {
-            for (int32 j = 0; j < Config.DropdownItems.Num(); ++j)
-            {
-                const FToolbarDropdownItem& Item = Config.DropdownItems[j];
-                
-                // 下拉项名称为空时只记录警告，不阻止保存
-                if (Item.ItemName.IsEmpty())
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置验证警告 - 按钮 '%s' 的下拉项 %d 名称为空"), *Config.ButtonName, j);
-                }
-                
-                // 绑定类无效时也只记录警告
-                if (Item.BoundClass.IsValid())
-                {
-                    FString ClassPath = Item.BoundClass.ToString();
-                    if (ClassPath.IsEmpty() || ClassPath == TEXT("None"))
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置验证警告 - 按钮 '%s' 的下拉项 '%s' 绑定类路径无效"), *Config.ButtonName, *Item.ItemName);
-                    }
-                }
-            }
-        }
-        else if (Config.ButtonType == EToolbarButtonType::SingleButton)
+        return ConfigDiagnostics;
+    }
+
+    // 每个配置版本只校验一次，保存和工具栏刷新直接使用缓存的结果
+    FUtilityExtendConfigSchema::Validate(PersistentButtonConfigs, ConfigDiagnostics);
+    ValidatedConfigVersion = ConfigVersion;
+    ++ValidationCount;
+
+    // 问题只作为提示，不阻止保存 - 用户可能正在配置过程中
+    if (ConfigDiagnostics.Num() > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置校验发现 %d 个问题，第一个: %s"),
+               ConfigDiagnostics.Num(), *FUtilityExtendConfigSchema::DescribeDiagnostic(ConfigDiagnostics[0], PersistentButtonConfigs));
+        for (const FUtilityExtendConfigDiagnostic& Diagnostic : ConfigDiagnostics)
         {
-            // 对于单个按钮，检查绑定的脚本类路径 - 只警告不阻止
-            if (Config.BoundClass.IsValid())
-            {
-                FString ClassPath = Config.BoundClass.ToString();
-                if (ClassPath.IsEmpty() || ClassPath == TEXT("None"))
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 配置验证警告 - 单个按钮 '%s' 绑定类路径无效"), *Config.ButtonName);
-                }
-            }
+            UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 配置校验 - %s"), *FUtilityExtendConfigSchema::DescribeDiagnostic(Diagnostic, PersistentButtonConfigs));
         }
     }
-    
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 配置数据验证完成，共 %d 个按钮配置"), PersistentButtonConfigs.Num());
-    return true; // 始终返回true，允许保存所有数据
+
+    return ConfigDiagnostics;
 }
 
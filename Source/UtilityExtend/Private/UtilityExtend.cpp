@@ -10,6 +10,8 @@
 #include "Misc/MessageDialog.h"
 #include "ToolMenus.h"
 #include "Blueprint/UtilityExtendBPLibrary.h"  // 添加BPLibrary头文件
+#include "Notification/SUtilityExtendNotificationHistory.h"
+#include "Notification/UtilityExtendHeadlessNotifications.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -43,6 +45,12 @@ void FUtilityExtendModule::StartupModule()
     // 初始化命令
     FUtilityExtendCommands::Register();
 
+    // 注册通知历史面板，没有Slate时（命令行、-nullrhi）没有标签页管理器
+    if (!FUtilityExtendHeadlessNotifications::IsHeadless())
+    {
+        SUtilityExtendNotificationHistory::RegisterTabSpawner();
+    }
+
     // 创建工具栏管理器
     ToolbarManager = NewObject<UUtilityToolbarManager>();
     if (ToolbarManager)
@@ -94,6 +102,12 @@ void FUtilityExtendModule::ShutdownModule()
         UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 工具栏管理器已清理"));
     }
 
+    // 注销通知历史面板
+    SUtilityExtendNotificationHistory::UnregisterTabSpawner();
+
+    // 写出缓冲的无界面通知
+    FUtilityExtendHeadlessNotifications::Get().Shutdown();
+
     // 注销命令
     FUtilityExtendCommands::Unregister();
     
@@ -6,6 +6,7 @@
 #include "UtilityExtendCommands.h"
 #include "UtilityExtendStyle.h"  // 添加样式系统头文件
 #include "UtilityExtendIconRegistry.h"  // 添加图标注册系统头文件
+#include "Persistent/UtilityExtendConfigResolver.h"
 #include "ToolMenus.h"
 #include "ToolMenu.h"
 #include "ToolMenuSection.h"
@@ -32,14 +33,17 @@ UUtilityToolbarManager::~UUtilityToolbarManager()
 
 void UUtilityToolbarManager::Initialize()
 {
+    // 图标文件被修改时只刷新本插件的工具栏
+    FUtilityExtendStyle::OnIconReloaded().AddUObject(this, &UUtilityToolbarManager::HandleIconReloaded);
+    
     // 创建工具栏按钮
     CreateToolbarButtons();
 }
 
 void UUtilityToolbarManager::CreateToolbarButtons()
 {
-    // 获取合并的按钮配置（项目配置 + 持久化配置）
-    TArray<FToolbarButtonConfig> MergedConfigs = GetMergedButtonConfigs();
+    // 获取合并的按钮配置（持久化配置 + 项目配置 + 用户覆盖），直接引用解析器的缓存结果
+    const TArray<FToolbarButtonConfig>& MergedConfigs = FUtilityExtendConfigResolver::Get().Resolve();
     
     if (MergedConfigs.Num() == 0)
     {
@@ -70,6 +74,7 @@ void UUtilityToolbarManager::CreateToolbarButtons()
         ToolbarMenu = ToolMenus->ExtendMenu(FName(*Path));
         if (ToolbarMenu)
         {
+            ExtendedToolbarMenuName = FName(*Path);
             UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 成功扩展工具栏: %s"), *Path);
             break;
         }
@@ -83,29 +88,46 @@ void UUtilityToolbarManager::CreateToolbarButtons()
 
     // 找到或创建PluginTools部分
     FToolMenuSection& Section = ToolbarMenu->FindOrAddSection("PluginTools");
+    Section.Blocks.Reserve(Section.Blocks.Num() + MergedConfigs.Num());
+
+    // 图标映射每次创建工具栏时重建，期间注册的新图标也能找到
+    IconNameLookup.Reset();
+    for (const FToolbarIconInfo& IconInfo : FUtilityExtendIconRegistry::GetAllAvailableIconInfos())
+    {
+        IconNameLookup.Add(FName(*IconInfo.DisplayName), IconInfo.IconName);
+    }
 
-    // 遍历配置创建按钮
-    for (const FToolbarButtonConfig& ButtonConfig : MergedConfigs)
+    // 配置就是解析器的合并结果，下拉按钮不再逐个回查解析器
+    const int32 SkippedCount = AddButtonsToSection(MergedConfigs, Section, true);
+    if (SkippedCount > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 跳过 %d 个空名称的按钮配置"), SkippedCount);
+    }
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮创建完成"));
+}
+
+int32 UUtilityToolbarManager::AddButtonsToSection(const TArray<FToolbarButtonConfig>& ButtonConfigs, FToolMenuSection& Section, bool bFromResolver)
+{
+    // 遍历配置创建按钮，大配置下不逐个输出日志
+    int32 SkippedCount = 0;
+    for (const FToolbarButtonConfig& ButtonConfig : ButtonConfigs)
     {
         if (ButtonConfig.ButtonName.IsEmpty())
         {
-            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 跳过空名称的按钮配置"));
+            ++SkippedCount;
             continue;
         }
 
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 创建按钮: %s"), *ButtonConfig.ButtonName);
-        
         if (ButtonConfig.ButtonType == EToolbarButtonType::SingleButton)
         {
             CreateSingleButton(ButtonConfig, Section);
         }
         else if (ButtonConfig.ButtonType == EToolbarButtonType::DropdownButton)
         {
-            CreateDropdownButton(ButtonConfig, Section);
+            AddDropdownButton(ButtonConfig, Section, bFromResolver);
         }
     }
-
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮创建完成"));
+    return SkippedCount;
 }
 
 void UUtilityToolbarManager::CreateSingleButton(const FToolbarButtonConfig& ButtonConfig, FToolMenuSection& Section)
@@ -113,15 +135,15 @@ void UUtilityToolbarManager::CreateSingleButton(const FToolbarButtonConfig& Butt
     // 创建按钮操作
     FUIAction ButtonAction;
     
-    // 使用lambda函数来包装带参数的函数调用
-    ButtonAction.ExecuteAction = FExecuteAction::CreateLambda([this, ButtonConfig]()
+    // 只捕获点击需要的类引用和名称，不复制整份按钮配置
+    ButtonAction.ExecuteAction = FExecuteAction::CreateLambda([this, BoundClass = ButtonConfig.BoundClass, ButtonName = ButtonConfig.ButtonName]()
     {
-        this->OnButtonClicked(ButtonConfig);
+        this->OnButtonClicked(BoundClass, ButtonName);
     });
     
-    ButtonAction.CanExecuteAction = FCanExecuteAction::CreateLambda([this, ButtonConfig]()
+    ButtonAction.CanExecuteAction = FCanExecuteAction::CreateLambda([this, BoundClass = ButtonConfig.BoundClass]()
     {
-        return this->CanExecuteButton(ButtonConfig);
+        return this->CanExecuteButton(BoundClass);
     });
 
     // 创建单个按钮
@@ -140,32 +162,39 @@ void UUtilityToolbarManager::CreateSingleButton(const FToolbarButtonConfig& Butt
     }
 
     Section.AddEntry(Entry);
-    
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 创建单个按钮: %s"), *ButtonConfig.ButtonName);
 }
 
 void UUtilityToolbarManager::CreateDropdownButton(const FToolbarButtonConfig& ButtonConfig, FToolMenuSection& Section)
 {
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 开始创建下拉按钮: %s, 下拉项数量: %d"), 
-           *ButtonConfig.ButtonName, ButtonConfig.DropdownItems.Num());
-    
-    // 验证下拉项数据
-    for (int32 i = 0; i < ButtonConfig.DropdownItems.Num(); ++i)
+    // 单独传入的配置（例如蓝图调用）需要查询一次是否在合并结果中
+    AddDropdownButton(ButtonConfig, Section, FUtilityExtendConfigResolver::Get().FindResolvedButton(ButtonConfig.ButtonName) != nullptr);
+}
+
+void UUtilityToolbarManager::AddDropdownButton(const FToolbarButtonConfig& ButtonConfig, FToolMenuSection& Section, bool bResolved)
+{
+    // 合并配置中的按钮在菜单打开时按名称取最新配置，只捕获名称；
+    // 不在合并结果中的配置（例如蓝图直接传入的）才保留一份共享副本
+    TSharedPtr<const FToolbarButtonConfig> DetachedConfig;
+    if (!bResolved)
     {
-        const FToolbarDropdownItem& Item = ButtonConfig.DropdownItems[i];
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉按钮[%s]下拉项[%d] - 名称: %s, 类: %s"), 
-               *ButtonConfig.ButtonName, i, *Item.ItemName, *Item.BoundClass.ToString());
+        DetachedConfig = MakeShared<const FToolbarButtonConfig>(ButtonConfig);
     }
     
     // 创建下拉按钮
     FToolMenuEntry Entry = FToolMenuEntry::InitComboButton(
         FName(*ButtonConfig.ButtonName),
         FToolUIActionChoice(), // 空操作
-        FNewToolMenuDelegate::CreateLambda([this, ButtonConfig](UToolMenu* Menu)
+        FNewToolMenuDelegate::CreateLambda([this, ButtonName = ButtonConfig.ButtonName, DetachedConfig](UToolMenu* Menu)
         {
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: Lambda中创建下拉菜单: %s, 下拉项数量: %d"), 
-                   *ButtonConfig.ButtonName, ButtonConfig.DropdownItems.Num());
-            this->CreateDropdownMenu(Menu, ButtonConfig);
+            const FToolbarButtonConfig* MenuConfig = DetachedConfig.IsValid()
+                ? DetachedConfig.Get()
+                : FUtilityExtendConfigResolver::Get().FindResolvedButton(ButtonName);
+            if (!MenuConfig)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 下拉按钮的配置已被移除: %s"), *ButtonName);
+                return;
+            }
+            this->CreateDropdownMenu(Menu, *MenuConfig);
         }),
         FText::FromString(ButtonConfig.ButtonName),
         FText::FromString(GetButtonTooltip(ButtonConfig)),
@@ -179,8 +208,6 @@ void UUtilityToolbarManager::CreateDropdownButton(const FToolbarButtonConfig& Bu
     }
 
     Section.AddEntry(Entry);
-    
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 创建下拉按钮完成: %s"), *ButtonConfig.ButtonName);
 }
 
 UUtilityExtendTopBarButtonScript* UUtilityToolbarManager::CreateButtonInstance(const FString& ClassName)
@@ -229,31 +256,33 @@ void UUtilityToolbarManager::RefreshToolbar()
     }
 }
 
-void UUtilityToolbarManager::OnButtonClicked(const FToolbarButtonConfig& ButtonConfig) const
+void UUtilityToolbarManager::OnButtonClicked(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& BoundClass, const FString& ButtonName) const
 {
     // 处理按钮点击事件
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮被点击: %s"), *ButtonConfig.ButtonName);
+    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮被点击: %s"), *ButtonName);
     
     // 创建按钮实例并执行
-    if (UUtilityExtendTopBarButtonScript* ButtonScript = CreateButtonInstanceFromSoftClass(ButtonConfig.BoundClass))
+    if (UUtilityExtendTopBarButtonScript* ButtonScript = CreateButtonInstanceFromSoftClass(BoundClass))
     {
         ButtonScript->OnButtonClicked();
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法创建按钮实例: %s"), *ButtonConfig.ButtonName);
+        UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法创建按钮实例: %s"), *ButtonName);
     }
 }
 
-bool UUtilityToolbarManager::CanExecuteButton(const FToolbarButtonConfig& ButtonConfig) const
+bool UUtilityToolbarManager::CanExecuteButton(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& BoundClass) const
 {
-    // 检查按钮是否可以执行
-    if (UUtilityExtendTopBarButtonScript* ButtonScript = CreateButtonInstanceFromSoftClass(ButtonConfig.BoundClass))
+    // Slate每帧对每个可见按钮调用一次：只检查引用，类在点击时才加载
+    if (BoundClass.IsNull())
     {
-        // 按钮始终可以执行，除非脚本类无效
-        return true;
+        return false;
     }
-    return false;
+    
+    // 已加载的类可以直接确认类型
+    const UClass* LoadedClass = BoundClass.Get();
+    return !LoadedClass || LoadedClass->IsChildOf<UUtilityExtendTopBarButtonScript>();
 }
 
 void UUtilityToolbarManager::OnDropdownItemClicked(UUtilityExtendTopBarButtonScript* ButtonScript) const
@@ -267,54 +296,53 @@ void UUtilityToolbarManager::OnDropdownItemClicked(UUtilityExtendTopBarButtonScr
 
 void UUtilityToolbarManager::CreateDropdownMenu(UToolMenu* Menu, const FToolbarButtonConfig& ButtonConfig) const
 {
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 创建下拉菜单开始: %s, 下拉项数量: %d"), 
-           *ButtonConfig.ButtonName, ButtonConfig.DropdownItems.Num());
-    
     // 创建下拉菜单部分
     FToolMenuSection& Section = Menu->FindOrAddSection("DropdownItems");
+    Section.Blocks.Reserve(Section.Blocks.Num() + ButtonConfig.DropdownItems.Num());
     
-    // 添加下拉项
-    for (int32 i = 0; i < ButtonConfig.DropdownItems.Num(); ++i)
+    // 所有下拉项共用同一个图标
+    const FSlateIcon ItemIcon(FAppStyle::GetAppStyleSetName(), "Icons.Placeholder");
+    
+    // 添加下拉项，菜单每次打开都会重建，这里不逐项输出日志
+    int32 SkippedCount = 0;
+    for (const FToolbarDropdownItem& DropdownItem : ButtonConfig.DropdownItems)
     {
-        const FToolbarDropdownItem& DropdownItem = ButtonConfig.DropdownItems[i];
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 创建下拉项[%d]: 名称='%s', 类='%s'"), 
-               i, *DropdownItem.ItemName, *DropdownItem.BoundClass.ToString());
-        
         if (DropdownItem.ItemName.IsEmpty())
         {
-            UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 跳过空名称的下拉项[%d]"), i);
+            ++SkippedCount;
             continue;
         }
         
-        // 创建下拉项操作
+        // 创建下拉项操作，只捕获点击需要的类引用和名称
         FUIAction ItemAction;
-        ItemAction.ExecuteAction = FExecuteAction::CreateLambda([this, DropdownItem]()
+        ItemAction.ExecuteAction = FExecuteAction::CreateLambda([this, BoundClass = DropdownItem.BoundClass, ItemName = DropdownItem.ItemName]()
         {
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉项被点击: %s"), *DropdownItem.ItemName);
-            if (UUtilityExtendTopBarButtonScript* ButtonScript = CreateButtonInstanceFromSoftClass(DropdownItem.BoundClass))
+            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉项被点击: %s"), *ItemName);
+            if (UUtilityExtendTopBarButtonScript* ButtonScript = CreateButtonInstanceFromSoftClass(BoundClass))
             {
                 this->OnDropdownItemClicked(ButtonScript);
             }
             else
             {
-                UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法创建下拉项实例: %s"), *DropdownItem.ItemName);
+                UE_LOG(LogTemp, Warning, TEXT("UtilityExtend: 无法创建下拉项实例: %s"), *ItemName);
             }
         });
         
-        FToolMenuEntry MenuEntry = FToolMenuEntry::InitMenuEntry(
+        const FText ItemText = FText::FromString(DropdownItem.ItemName);
+        Section.AddEntry(FToolMenuEntry::InitMenuEntry(
             FName(*DropdownItem.ItemName),
-            FText::FromString(DropdownItem.ItemName),
-            FText::FromString(DropdownItem.ItemName),
-            FSlateIcon(FAppStyle::GetAppStyleSetName(), "Icons.Placeholder"),
+            ItemText,
+            ItemText,
+            ItemIcon,
             FToolUIActionChoice(ItemAction),
             EUserInterfaceActionType::Button
-        );
-        
-        Section.AddEntry(MenuEntry);
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉项创建成功: %s"), *DropdownItem.ItemName);
+        ));
     }
     
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 下拉菜单创建完成: %s"), *ButtonConfig.ButtonName);
+    if (SkippedCount > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("UtilityExtend: 下拉按钮 %s 跳过 %d 个空名称的下拉项"), *ButtonConfig.ButtonName, SkippedCount);
+    }
 }
 
 FSlateIcon UUtilityToolbarManager::GetButtonIcon(const FToolbarButtonConfig& ButtonConfig)
@@ -322,20 +350,37 @@ FSlateIcon UUtilityToolbarManager::GetButtonIcon(const FToolbarButtonConfig& But
     // 如果用户指定了图标名称，使用用户选择的图标
     if (!ButtonConfig.ButtonIconName.IsNone())
     {
-        // 将友好名称转换为技术名称
-        FName TechnicalIconName = FUtilityExtendIconRegistry::GetIconNameFromDisplayName(ButtonConfig.ButtonIconName.ToString());
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮 %s 友好名称: %s, 技术名称: %s"), *ButtonConfig.ButtonName, *ButtonConfig.ButtonIconName.ToString(), *TechnicalIconName.ToString());
+        // 将友好名称转换为技术名称；映射中没有时回退到注册表（会使用默认图标并给出警告），结果同样缓存
+        FName* CachedIconName = IconNameLookup.Find(ButtonConfig.ButtonIconName);
+        const FName TechnicalIconName = CachedIconName
+            ? *CachedIconName
+            : IconNameLookup.Add(ButtonConfig.ButtonIconName, FUtilityExtendIconRegistry::GetIconNameFromDisplayName(ButtonConfig.ButtonIconName.ToString()));
         
         // 使用转换后的技术名称从样式系统获取图标
+        UsedIconStyleNames.Add(TechnicalIconName);
         return FSlateIcon(FUtilityExtendStyle::GetStyleSetName(), TechnicalIconName);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 按钮 %s 未指定图标，使用第一个可用图标"), *ButtonConfig.ButtonName);
-    
     // 如果没有指定图标，使用第一个可用的图标
+    UsedIconStyleNames.Add(TEXT("UtilityExtend.BtnIcon"));
     return FSlateIcon(FUtilityExtendStyle::GetStyleSetName(), TEXT("UtilityExtend.BtnIcon"));
 }
 
+void UUtilityToolbarManager::HandleIconReloaded(FName IconStyleName)
+{
+    // 工具栏没有使用这个图标时不做任何刷新
+    if (!UsedIconStyleNames.Contains(IconStyleName) || ExtendedToolbarMenuName.IsNone())
+    {
+        return;
+    }
+    
+    if (UToolMenus* ToolMenus = UToolMenus::Get())
+    {
+        ToolMenus->RefreshMenuWidget(ExtendedToolbarMenuName);
+        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 图标 %s 已更新，刷新工具栏: %s"), *IconStyleName.ToString(), *ExtendedToolbarMenuName.ToString());
+    }
+}
+
 FString UUtilityToolbarManager::GetButtonTooltip(const FToolbarButtonConfig& ButtonConfig)
 {
     // 返回按钮工具提示
@@ -344,57 +389,8 @@ FString UUtilityToolbarManager::GetButtonTooltip(const FToolbarButtonConfig& But
 
 TArray<FToolbarButtonConfig> UUtilityToolbarManager::GetMergedButtonConfigs() const
 {
-    TArray<FToolbarButtonConfig> MergedConfigs;
-    
-    // 首先添加持久化配置（优先级更高）
-    UUtilityExtendPersistentSettings* PersistentSettings = UUtilityExtendPersistentSettings::Get();
-    if (PersistentSettings)
-    {
-        const TArray<FToolbarButtonConfig>& PersistentConfigs = PersistentSettings->GetPersistentButtonConfigs();
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 获取到 %d 个持久化按钮配置"), PersistentConfigs.Num());
-        
-        // 逐个添加配置并验证数据完整性
-        for (int32 i = 0; i < PersistentConfigs.Num(); ++i)
-        {
-            const FToolbarButtonConfig& Config = PersistentConfigs[i];
-            UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化配置[%d] - 名称: %s, 类型: %d, 下拉项数量: %d"), 
-                   i, *Config.ButtonName, (int32)Config.ButtonType, Config.DropdownItems.Num());
-            
-            // 验证下拉项数据
-            for (int32 j = 0; j < Config.DropdownItems.Num(); ++j)
-            {
-                const FToolbarDropdownItem& Item = Config.DropdownItems[j];
-                UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 持久化配置[%d]下拉项[%d] - 名称: %s, 类: %s"), 
-                       i, j, *Item.ItemName, *Item.BoundClass.ToString());
-            }
-            
-            // 添加到合并配置中
-            MergedConfigs.Add(Config);
-        }
-        
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 添加了 %d 个持久化按钮配置"), PersistentConfigs.Num());
-    }
-    
-    // 然后添加项目配置
-    UUtilityExtendSettings* ProjectSettings = UUtilityExtendSettings::Get();
-    if (ProjectSettings)
-    {
-        TArray<FToolbarButtonConfig> ProjectConfigs = ProjectSettings->ToolbarButtonConfigs;
-        MergedConfigs.Append(ProjectConfigs);
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 添加了 %d 个项目按钮配置"), ProjectConfigs.Num());
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 总共合并了 %d 个按钮配置"), MergedConfigs.Num());
-    
-    // 验证合并后的配置
-    for (int32 i = 0; i < MergedConfigs.Num(); ++i)
-    {
-        const FToolbarButtonConfig& Config = MergedConfigs[i];
-        UE_LOG(LogTemp, Log, TEXT("UtilityExtend: 合并配置[%d] - 名称: %s, 类型: %d, 下拉项数量: %d"), 
-               i, *Config.ButtonName, (int32)Config.ButtonType, Config.DropdownItems.Num());
-    }
-    
-    return MergedConfigs;
+    // 合并结果由解析器按各层版本戳缓存，配置未变化时不会重新合并
+    return FUtilityExtendConfigResolver::Get().Resolve();
 }
 
 TArray<FToolbarButtonConfig> UUtilityToolbarManager::GetPersistentButtonConfigs() const
@@ -3,24 +3,15 @@
 #pragma once
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Icon/UtilityExtendIconImporter.h"
+#include "Notification/UtilityExtendNotificationTypes.h"
 #include "UtilityExtendBPLibrary.generated.h"
 
 // 前向声明
 class UUtilityLoadingNotification;
-
-/**
- * 编辑器通知类型枚举
- */
-UENUM(BlueprintType)
-enum class EEditorNotificationType : uint8
-{
-    /** 默认通知 */
-    Default         UMETA(DisplayName = "默认"),
-    /** 成功通知 */
-    Success         UMETA(DisplayName = "成功"),
-    /** 错误通知 */
-    Error           UMETA(DisplayName = "错误")
-};
+class UUtilityProgressGroup;
+class UUtilityExtendTextFileReader;
+class UUtilityExtendMappedFile;
 
 /**
  * 通知按钮点击事件委托
@@ -69,20 +60,16 @@ class UUtilityExtendBPLibrary : public UBlueprintFunctionLibrary
     GENERATED_BODY()
 
 public:
-    // 跟踪创建的通知
-    static TArray<TSharedPtr<SNotificationItem>> CreatedNotifications;
-    
     // 通知按钮点击事件委托实例
     static FOnNotificationButtonClicked OnNotificationButtonClicked;
     
-    // 通知ID映射表 (NotificationId -> NotificationItem)
-    static TMap<FString, TSharedPtr<SNotificationItem>> NotificationMap;
-    
     // 注册的事件接收者列表
     static TArray<TWeakObjectPtr<UObject>> NotificationEventReceivers;
 
     // ------------------------------------编辑器通知相关函数------------------------------------
     // 创建常规通知节点（不带按钮）
+    // 合并窗口内相同合并键的通知合并为一条并显示重复次数，超出每秒上限的通知汇总显示，此时返回空ID
+    // 没有Slate时（命令行工具、-nullrhi自动化）通知按设置写入日志或JSON Lines文件
     UFUNCTION(BlueprintCallable, meta = (
         DisplayName = "创建编辑器通知", 
         Keywords = "创建编辑器通知 显示通知", 
@@ -92,10 +79,12 @@ public:
         UPARAM(DisplayName = "消息内容") const FString& Message,
         UPARAM(DisplayName = "通知类型") EEditorNotificationType NotificationType = EEditorNotificationType::Default,
         UPARAM(DisplayName = "持续时间") float Duration = 5.0f,
-        UPARAM(DisplayName = "自动过期") bool bAutoExpire = true
+        UPARAM(DisplayName = "自动过期") bool bAutoExpire = true,
+        UPARAM(DisplayName = "合并键 [为空则按类型和内容合并]") const FString& CoalesceKey = TEXT("")
     );
 
     // 创建带加载动画的通知节点（支持按钮）
+    // 没有Slate时通知对象的进度和结果按设置写入日志或JSON Lines文件，按钮不显示
     UFUNCTION(BlueprintCallable, meta = (
         DisplayName = "创建编辑器等待通知", 
         Keywords = "创建等待通知 带按钮",
@@ -109,6 +98,17 @@ public:
         UPARAM(DisplayName = "按钮提示") const FString& ButtonTooltip = TEXT("")
     );
 
+    // 创建进度组通知节点，多个任务的进度汇总到同一条通知中
+    // 任务添加完毕后调用SealTasks，所有任务完成时通知自动结束；也可以随时调用Finish或Cancel结束
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "创建进度组通知", 
+        Keywords = "创建进度组 进度汇总 剩余时间 progress group",
+        Category = "UtilityExtend|编辑器通知"
+    ))
+    static UPARAM(DisplayName = "进度组") UUtilityProgressGroup* CreateProgressGroupNotification(
+        UPARAM(DisplayName = "标题") const FString& Title
+    );
+
     // // 创建复杂通知
     // UFUNCTION(BlueprintCallable, meta = (
     //     DisplayName = "创建复杂通知", 
@@ -134,6 +134,46 @@ public:
         UPARAM(DisplayName = "清除全部") bool bRemoveAll = false
     );
 
+    // 获取通知历史（按时间从新到旧）
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "获取通知历史", 
+        Keywords = "通知历史 历史记录 notification history", 
+        Category = "UtilityExtend|编辑器通知|通知历史"
+    ))
+    static UPARAM(DisplayName = "历史记录") TArray<FUtilityNotificationRecord> GetNotificationHistory(
+        UPARAM(DisplayName = "最多数量 [0为全部]") int32 MaxCount = 0
+    );
+
+    // 按条件查询通知历史（按时间从新到旧）
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "查询通知历史", 
+        Keywords = "查询通知历史 过滤 notification history", 
+        Category = "UtilityExtend|编辑器通知|通知历史"
+    ))
+    static UPARAM(DisplayName = "历史记录") TArray<FUtilityNotificationRecord> QueryNotificationHistory(
+        UPARAM(DisplayName = "关键字 [匹配内容或来源]") const FString& Keyword,
+        UPARAM(DisplayName = "来源脚本") const FString& Source,
+        UPARAM(DisplayName = "按类型过滤") bool bFilterByType = false,
+        UPARAM(DisplayName = "通知类型") EEditorNotificationType NotificationType = EEditorNotificationType::Default,
+        UPARAM(DisplayName = "最多数量 [0为全部]") int32 MaxCount = 0
+    );
+
+    // 清空通知历史
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "清空通知历史", 
+        Keywords = "清空通知历史 clear notification history", 
+        Category = "UtilityExtend|编辑器通知|通知历史"
+    ))
+    static void ClearNotificationHistory();
+
+    // 打开通知历史面板
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "打开通知历史面板", 
+        Keywords = "通知历史面板 open notification history", 
+        Category = "UtilityExtend|编辑器通知|通知历史"
+    ))
+    static void OpenNotificationHistoryPanel();
+
     // ------------------------------------插件相关函数------------------------------------
     // 路径相关函数
     UFUNCTION(BlueprintCallable, BlueprintPure, meta = (
@@ -179,7 +219,7 @@ public:
 // ------------------------------------实验性功能------------------------------------
     // ===============文件读写相关函数===============
 
-    // 文件读写相关函数
+    // 文件读写相关函数，在游戏线程上同步执行；大文件使用UUtilityExtendAsyncTextFile中的异步节点
     UFUNCTION(BlueprintCallable, meta = (
         DisplayName = "用文本方式读取任意文件", 
         Keywords = "Read Text File",
@@ -206,6 +246,28 @@ public:
         UPARAM(DisplayName = "创建目录") bool bCreateDirectories = true
     );
 
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "打开流式文本读取器", 
+        Keywords = "Open Text File Reader 逐行读取 大文件",
+        ToolTip = "打开文本文件用于逐行或分块读取，内存占用与文件大小无关，适合处理大型日志和CSV文件",
+        Category = "UtilityExtend|实验性功能|文件处理|流式读取"
+    ))
+    static UPARAM(DisplayName = "读取器") UUtilityExtendTextFileReader* OpenTextFileReader(
+        UPARAM(DisplayName = "文件路径") const FString& FilePath,
+        UPARAM(DisplayName = "错误信息") FString& OutErrorMessage
+    );
+
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "打开内存映射文件", 
+        Keywords = "Open Mapped File 二进制 内存映射 大文件",
+        ToolTip = "以只读方式映射二进制文件，按偏移读取数值、字符串和字节，不需要把整个文件加载到内存",
+        Category = "UtilityExtend|实验性功能|文件处理|内存映射"
+    ))
+    static UPARAM(DisplayName = "映射文件") UUtilityExtendMappedFile* OpenMappedFile(
+        UPARAM(DisplayName = "文件路径") const FString& FilePath,
+        UPARAM(DisplayName = "错误信息") FString& OutErrorMessage
+    );
+
     UFUNCTION(BlueprintCallable, meta = (
         DisplayName = "检查文件是否存在", 
         Keywords = "check file exists",
@@ -266,6 +328,32 @@ public:
     );
 
 
+    // ===============图标导入相关函数===============
+
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "批量导入图标文件", 
+        Keywords = "Import Icon Files",
+        ToolTip = "并行校验、清理并规范化SVG/PNG文件，按内容去重后复制到插件Resources目录并一次性注册",
+        Category = "UtilityExtend|图标"
+    ))
+    static UPARAM(DisplayName = "开始导入") bool ImportIconFiles(
+        UPARAM(DisplayName = "文件路径列表") const TArray<FString>& FilePaths,
+        UPARAM(DisplayName = "完成回调") const FOnIconImportCompleted& OnCompleted
+    );
+
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "批量导入图标目录", 
+        Keywords = "Import Icon Folder",
+        ToolTip = "导入目录下的所有SVG/PNG文件，支持相对路径和绝对路径",
+        Category = "UtilityExtend|图标"
+    ))
+    static UPARAM(DisplayName = "开始导入") bool ImportIconFolder(
+        UPARAM(DisplayName = "目录路径") const FString& FolderPath,
+        UPARAM(DisplayName = "包含子目录") bool bRecursive,
+        UPARAM(DisplayName = "完成回调") const FOnIconImportCompleted& OnCompleted
+    );
+
+
     // ===============外部软件调用相关函数===============
 
     // 外部软件调用相关函数
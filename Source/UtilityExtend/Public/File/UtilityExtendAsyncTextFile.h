@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include <atomic>
+#include "UtilityExtendAsyncTextFile.generated.h"
+
+/**
+ * 异步文本文件读写完成事件委托
+ * @param Content 读取到的文件内容，写入时为空
+ * @param ErrorMessage 失败或取消时的错误信息
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAsyncTextFileCompleted, const FString&, Content, const FString&, ErrorMessage);
+
+/**
+ * 异步文本文件读写节点
+ * 读写在线程池上进行，完成后回到游戏线程触发成功或失败输出；路径解析、编码和错误信息与同步节点相同。
+ * 调用Cancel后在下一个数据块之前停止，触发失败输出，错误信息为"操作已取消"，写入时目标文件保持不变
+ */
+UCLASS()
+class UTILITYEXTEND_API UUtilityExtendAsyncTextFile : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "异步读取文本文件",
+        Keywords = "Read Text File Async 异步读取",
+        ToolTip = "在后台线程读取文本文件，读取大文件时不阻塞编辑器，支持相对路径和绝对路径",
+        BlueprintInternalUseOnly = "true",
+        Category = "UtilityExtend|实验性功能|文件处理"
+    ))
+    static UUtilityExtendAsyncTextFile* ReadTextFileAsync(
+        UPARAM(DisplayName = "文件路径") const FString& FilePath
+    );
+
+    UFUNCTION(BlueprintCallable, meta = (
+        DisplayName = "异步写入文本文件",
+        Keywords = "Write Text File Async 异步写入",
+        ToolTip = "在后台线程将文本内容保存到文件，支持创建目录和覆盖文件",
+        BlueprintInternalUseOnly = "true",
+        Category = "UtilityExtend|实验性功能|文件处理"
+    ))
+    static UUtilityExtendAsyncTextFile* WriteTextFileAsync(
+        UPARAM(DisplayName = "文件路径") const FString& FilePath,
+        UPARAM(DisplayName = "文件内容") const FString& Content,
+        UPARAM(DisplayName = "覆盖文件") bool bOverwrite = true,
+        UPARAM(DisplayName = "创建目录") bool bCreateDirectories = true
+    );
+
+    /** 取消读写，已经完成时不产生影响 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "取消文件读写", Category = "UtilityExtend|实验性功能|文件处理"))
+    void Cancel();
+
+    /** 是否正在读写 */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "文件读写中", Category = "UtilityExtend|实验性功能|文件处理"))
+    bool IsRunning() const { return bRunning; }
+
+    /** 读写成功 */
+    UPROPERTY(BlueprintAssignable, meta = (DisplayName = "成功"))
+    FOnAsyncTextFileCompleted OnSuccess;
+
+    /** 读写失败或被取消 */
+    UPROPERTY(BlueprintAssignable, meta = (DisplayName = "失败"))
+    FOnAsyncTextFileCompleted OnFailure;
+
+    virtual void Activate() override;
+
+private:
+    /** 工作线程与节点共享的状态，节点被回收后工作线程仍可安全访问 */
+    struct FSharedState
+    {
+        std::atomic<bool> bCancelled { false };
+    };
+
+    /** 在游戏线程上触发输出并结束节点 */
+    void Finish(bool bSuccess, FString&& Content, FString&& ErrorMessage);
+
+    /** 是否为写入 */
+    bool bWrite = false;
+
+    /** 文件路径 */
+    FString FilePath;
+
+    /** 写入的内容，开始写入后移交给工作线程 */
+    FString Content;
+
+    /** 写入选项 */
+    bool bOverwrite = true;
+    bool bCreateDirectories = true;
+
+    /** 是否正在读写 */
+    bool bRunning = false;
+
+    /** 共享状态 */
+    TSharedRef<FSharedState, ESPMode::ThreadSafe> State = MakeShared<FSharedState, ESPMode::ThreadSafe>();
+};
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Async/MappedFileHandle.h"
+#include "UtilityExtendMappedFile.generated.h"
+
+/**
+ * 内存映射的只读二进制文件
+ * 通过IMappedFileHandle把整个文件映射到地址空间，按需由操作系统分页读入，打开大文件不需要先加载到内存；
+ * 按类型读取和查找直接访问映射区域，读取字节数组时只复制请求的范围。
+ * 调用Close后立即解除映射，对象被回收时也会自动解除。读取超出文件范围时返回false
+ */
+UCLASS(BlueprintType)
+class UTILITYEXTEND_API UUtilityExtendMappedFile : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * 映射文件，路径解析和错误信息与读取文本文件节点相同
+     * @param FilePath 文件路径，支持相对路径和绝对路径
+     * @param OutErrorMessage 失败时的错误信息
+     * @return 是否映射成功
+     */
+    bool Open(const FString& FilePath, FString& OutErrorMessage);
+
+    /**
+     * 复制指定范围的字节
+     * @param Offset 起始偏移
+     * @param Count 字节数，单次最多64MB
+     * @param OutBytes 读取到的字节
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取字节", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadBytes(
+        UPARAM(DisplayName = "偏移") int64 Offset,
+        UPARAM(DisplayName = "字节数") int32 Count,
+        UPARAM(DisplayName = "字节数组") TArray<uint8>& OutBytes
+    ) const;
+
+    /** 读取无符号8位整数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Byte", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadByte(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") uint8& OutValue) const;
+
+    /** 读取有符号16位整数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Int16", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadInt16(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") int32& OutValue, UPARAM(DisplayName = "大端序") bool bBigEndian = false) const;
+
+    /** 读取有符号32位整数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Int32", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadInt32(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") int32& OutValue, UPARAM(DisplayName = "大端序") bool bBigEndian = false) const;
+
+    /** 读取有符号64位整数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Int64", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadInt64(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") int64& OutValue, UPARAM(DisplayName = "大端序") bool bBigEndian = false) const;
+
+    /** 读取32位浮点数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Float", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadFloat(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") float& OutValue, UPARAM(DisplayName = "大端序") bool bBigEndian = false) const;
+
+    /** 读取64位浮点数 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取Double", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadDouble(UPARAM(DisplayName = "偏移") int64 Offset, UPARAM(DisplayName = "值") double& OutValue, UPARAM(DisplayName = "大端序") bool bBigEndian = false) const;
+
+    /**
+     * 读取字符串，遇到空字符或读满MaxBytes时结束
+     * @param Offset 起始偏移
+     * @param MaxBytes 最多读取的字节数，超出文件末尾时读到文件末尾
+     * @param bUtf16 是否按UTF-16LE解码，否则按UTF-8解码
+     * @param OutValue 读取到的字符串
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取字符串", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool ReadString(
+        UPARAM(DisplayName = "偏移") int64 Offset,
+        UPARAM(DisplayName = "最大字节数") int32 MaxBytes,
+        UPARAM(DisplayName = "UTF-16") bool bUtf16,
+        UPARAM(DisplayName = "字符串") FString& OutValue
+    ) const;
+
+    /**
+     * 从StartOffset开始查找字节序列
+     * @return 找到的偏移，未找到时返回-1
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "查找字节序列", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    int64 FindBytes(
+        UPARAM(DisplayName = "字节序列") const TArray<uint8>& Pattern,
+        UPARAM(DisplayName = "起始偏移") int64 StartOffset = 0
+    ) const;
+
+    /** 文件大小（字节） */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "获取映射文件大小", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    int64 GetSize() const { return MappedSize; }
+
+    /** 文件是否仍处于映射状态 */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "映射文件是否已打开", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    bool IsOpen() const { return MappedData != nullptr; }
+
+    /** 解除映射并关闭文件 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "关闭映射文件", Category = "UtilityExtend|实验性功能|文件处理|内存映射"))
+    void Close();
+
+    virtual void BeginDestroy() override;
+
+private:
+    /** 按类型读取，大端序时交换字节 */
+    template <typename ValueType>
+    bool ReadValue(int64 Offset, bool bBigEndian, ValueType& OutValue) const;
+
+    /** 检查范围是否在文件内，返回范围起点 */
+    const uint8* GetRange(int64 Offset, int64 Count) const;
+
+    /** 映射的文件 */
+    TUniquePtr<IMappedFileHandle> MappedFileHandle;
+
+    /** 映射的区域，覆盖整个文件 */
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+
+    /** 映射区域的起始地址 */
+    const uint8* MappedData = nullptr;
+
+    /** 映射区域的大小 */
+    int64 MappedSize = 0;
+};
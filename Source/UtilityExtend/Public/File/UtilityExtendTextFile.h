@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * 文本文件读写
+ * 蓝图函数库的同步节点和异步节点共用的路径解析、读写实现和错误信息，可以在任意线程调用；
+ * 读写按块进行，块之间检查取消标记，大文件也能及时取消
+ */
+class UTILITYEXTEND_API FUtilityExtendTextFile
+{
+public:
+    /** 把蓝图传入的路径转换为完整路径，相对路径相对于项目目录 */
+    static FString ResolvePath(const FString& FilePath);
+
+    /**
+     * 读取文本文件，编码识别与FFileHelper::LoadFileToString相同
+     * @param FilePath 文件路径，支持相对路径和绝对路径
+     * @param OutContent 文件内容
+     * @param OutErrorMessage 失败时的错误信息
+     * @param bCancelled 取消标记，为空表示不可取消
+     * @return 是否读取成功，取消时返回false
+     */
+    static bool Read(const FString& FilePath, FString& OutContent, FString& OutErrorMessage, const std::atomic<bool>* bCancelled = nullptr);
+
+    /**
+     * 写入文本文件，编码与FFileHelper::SaveStringToFile默认选项相同；
+     * 内容先写入同目录下的临时文件，完成后再替换目标文件，失败或取消时不会留下写了一半的文件；
+     * 替换失败且原文件已不存在时保留临时文件，错误信息中给出它的路径
+     * @param FilePath 文件路径，支持相对路径和绝对路径
+     * @param Content 文件内容
+     * @param OutErrorMessage 失败时的错误信息
+     * @param bOverwrite 文件已存在时是否覆盖
+     * @param bCreateDirectories 是否创建不存在的目录
+     * @param bCancelled 取消标记，为空表示不可取消
+     * @return 是否写入成功，取消时返回false
+     */
+    static bool Write(const FString& FilePath, const FString& Content, FString& OutErrorMessage, bool bOverwrite, bool bCreateDirectories, const std::atomic<bool>* bCancelled = nullptr);
+
+    /** 取消时的错误信息 */
+    static const TCHAR* CancelledMessage;
+};
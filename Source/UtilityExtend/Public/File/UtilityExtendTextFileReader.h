@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "UtilityExtendTextFileReader.generated.h"
+
+/**
+ * 流式文本文件读取器
+ * 通过固定大小的缓冲区逐行读取，内存占用只与缓冲区和单行长度有关，可以分批处理数GB的日志或CSV文件；
+ * 支持UTF-8（含无BOM的ANSI）和带BOM的UTF-16文件，换行符为LF或CRLF。
+ * 位置均为文件中的字节偏移，读取时返回每行的起始偏移，之后可以通过Seek回到该行。只能在游戏线程使用
+ */
+UCLASS(BlueprintType)
+class UTILITYEXTEND_API UUtilityExtendTextFileReader : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * 打开文件，路径解析和错误信息与读取文本文件节点相同
+     * @param FilePath 文件路径，支持相对路径和绝对路径
+     * @param OutErrorMessage 失败时的错误信息
+     * @return 是否打开成功
+     */
+    bool Open(const FString& FilePath, FString& OutErrorMessage);
+
+    /**
+     * 读取下一行，不包含换行符
+     * 超过单行上限（1MB）的行拆分为多次返回
+     * @return 已到文件末尾时返回false
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取下一行", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    bool ReadLine(UPARAM(DisplayName = "行内容") FString& OutLine);
+
+    /**
+     * 读取最多MaxLines行
+     * @param MaxLines 最多读取的行数
+     * @param OutLines 读取到的行
+     * @param OutLineOffsets 每行起始位置的字节偏移，与OutLines一一对应
+     * @return 读取到的行数，为0表示已到文件末尾
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取多行", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    int32 ReadLines(
+        UPARAM(DisplayName = "最大行数") int32 MaxLines,
+        UPARAM(DisplayName = "行内容") TArray<FString>& OutLines,
+        UPARAM(DisplayName = "行偏移") TArray<int64>& OutLineOffsets
+    );
+
+    /**
+     * 按整行读取一块文本，累计字节数达到MaxBytes后停止，至少读取一行
+     * @param MaxBytes 本次读取的字节数上限
+     * @param OutText 读取到的文本，行之间以换行符分隔
+     * @return 已到文件末尾时返回false
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "读取文本块", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    bool ReadChunk(
+        UPARAM(DisplayName = "最大字节数") int32 MaxBytes,
+        UPARAM(DisplayName = "文本内容") FString& OutText
+    );
+
+    /**
+     * 跳转到指定字节偏移，通常为读取时返回的行偏移；偏移位于行中间时下一次读取从该位置开始
+     * @return 文件未打开或偏移超出文件大小时返回false
+     */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "跳转到偏移", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    bool Seek(UPARAM(DisplayName = "字节偏移") int64 Offset);
+
+    /** 下一次读取的字节偏移 */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "获取读取位置", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    int64 GetPosition() const { return BufferStart + BufferPos; }
+
+    /** 文件大小（字节） */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "获取文件大小", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    int64 GetFileSize() const { return FileSize; }
+
+    /** 是否已经读到文件末尾 */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "是否到达文件末尾", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    bool IsEndOfFile() const { return !IsOpen() || GetPosition() >= FileSize; }
+
+    /** 文件是否已打开 */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta = (DisplayName = "文件是否已打开", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    bool IsOpen() const { return FileHandle.IsValid(); }
+
+    /** 关闭文件，对象被回收时也会自动关闭 */
+    UFUNCTION(BlueprintCallable, meta = (DisplayName = "关闭文件", Category = "UtilityExtend|实验性功能|文件处理|流式读取"))
+    void Close();
+
+    virtual void BeginDestroy() override;
+
+private:
+    /** 文件编码 */
+    enum class EEncoding : uint8
+    {
+        Utf8,
+        Utf16LE,
+        Utf16BE,
+    };
+
+    /** 从当前位置读取下一块到缓冲区，已到文件末尾时返回false */
+    bool FillBuffer();
+
+    /** 在缓冲区中从Start开始查找换行符，返回换行符所在的缓冲区索引 */
+    int32 FindNewline(int32 Start) const;
+
+    /** 把一行的字节解码为字符串，去掉行尾的回车符 */
+    FString DecodeLine(TArray<uint8>& Bytes) const;
+
+    /** 每个字符单元的字节数 */
+    int32 GetUnitSize() const { return Encoding == EEncoding::Utf8 ? 1 : 2; }
+
+    /** 文件句柄 */
+    TUniquePtr<IFileHandle> FileHandle;
+
+    /** 文件编码 */
+    EEncoding Encoding = EEncoding::Utf8;
+
+    /** BOM之后正文的起始偏移 */
+    int64 DataStart = 0;
+
+    /** 文件大小 */
+    int64 FileSize = 0;
+
+    /** 读取缓冲区 */
+    TArray<uint8> Buffer;
+
+    /** 缓冲区第一个字节在文件中的偏移 */
+    int64 BufferStart = 0;
+
+    /** 缓冲区中的有效字节数 */
+    int32 BufferLength = 0;
+
+    /** 缓冲区中的读取位置 */
+    int32 BufferPos = 0;
+
+    /** 正在拼接的行，跨越缓冲区边界的行在这里累积，读取之间复用 */
+    TArray<uint8> LineBytes;
+};
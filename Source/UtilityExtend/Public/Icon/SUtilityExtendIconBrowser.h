@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STileView.h"
+#include "Icon/UtilityExtendIconCatalog.h"
+
+class ITableRow;
+class STableViewBase;
+
+/** 图标被选中时的回调 */
+DECLARE_DELEGATE_OneParam(FOnUtilityExtendIconSelected, TSharedPtr<FUtilityExtendIconCatalogItem>);
+
+/**
+ * 原生图标浏览器
+ * 使用虚拟化的STileView显示图标，只为可见的图块请求缩略图，图块被回收时取消其排队的请求，
+ * 缩略图在线程池上解码，数千个图标也能流畅滚动
+ */
+class UTILITYEXTEND_API SUtilityExtendIconBrowser : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SUtilityExtendIconBrowser)
+        : _TileSize(72.0f)
+        , _ThumbnailSize(64)
+    {}
+        /** 图块边长 */
+        SLATE_ARGUMENT(float, TileSize)
+        /** 缩略图解码尺寸（像素） */
+        SLATE_ARGUMENT(int32, ThumbnailSize)
+        /** 图标来源目录，为空时显示所有已注册的图标 */
+        SLATE_ARGUMENT(FString, SourceDirectory)
+        /** 图标选中事件 */
+        SLATE_EVENT(FOnUtilityExtendIconSelected, OnIconSelected)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+    virtual ~SUtilityExtendIconBrowser() override;
+
+    /** 重新枚举图标 */
+    void RefreshIcons();
+
+    /** 设置来源目录并重新枚举 */
+    void SetSourceDirectory(const FString& InSourceDirectory);
+
+    /** 设置过滤文本 */
+    void SetFilterText(const FText& InFilterText);
+
+    /** 获取当前选中的图标 */
+    TSharedPtr<FUtilityExtendIconCatalogItem> GetSelectedIcon() const;
+
+private:
+    /** 根据过滤文本重建可见列表 */
+    void ApplyFilter();
+
+    /** 生成图块 */
+    TSharedRef<ITableRow> OnGenerateTile(TSharedPtr<FUtilityExtendIconCatalogItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+    /** 图块被回收，取消其尚未开始的缩略图请求 */
+    void OnTileReleased(const TSharedRef<ITableRow>& TableRow);
+
+    /** 选中变化 */
+    void OnSelectionChanged(TSharedPtr<FUtilityExtendIconCatalogItem> Item, ESelectInfo::Type SelectInfo);
+
+    /** 搜索框文本变化 */
+    void OnSearchTextChanged(const FText& InFilterText);
+
+    /** 获取图块显示的画刷 */
+    const FSlateBrush* GetTileBrush(TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem) const;
+
+    /** 缩略图加载完成 */
+    void HandleThumbnailLoaded();
+
+    /** 图标热重载 */
+    void HandleIconReloaded(FName IconStyleName);
+
+    /** 获取状态栏文本 */
+    FText GetStatusText() const;
+
+private:
+    /** 缩略图目录 */
+    TSharedPtr<FUtilityExtendIconCatalog> Catalog;
+
+    /** 全部图标 */
+    TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> AllItems;
+
+    /** 过滤后的图标 */
+    TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> FilteredItems;
+
+    /** 图块视图 */
+    TSharedPtr<STileView<TSharedPtr<FUtilityExtendIconCatalogItem>>> TileView;
+
+    /** 已生成的图块对应的图标，用于在图块回收时找到其请求 */
+    TMap<const ITableRow*, TWeakPtr<FUtilityExtendIconCatalogItem>> GeneratedTiles;
+
+    /** 当前过滤文本 */
+    FString FilterString;
+
+    /** 来源目录 */
+    FString SourceDirectory;
+
+    /** 图块边长 */
+    float TileSize = 72.0f;
+
+    /** 图标选中事件 */
+    FOnUtilityExtendIconSelected OnIconSelected;
+
+    /** 图标热重载委托句柄 */
+    FDelegateHandle IconReloadedHandle;
+};
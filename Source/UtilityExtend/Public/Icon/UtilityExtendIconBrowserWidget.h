@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Widget.h"
+#include "UtilityExtendSettings.h"
+#include "UtilityExtendIconBrowserWidget.generated.h"
+
+class SUtilityExtendIconBrowser;
+struct FUtilityExtendIconCatalogItem;
+
+/**
+ * 图标选中事件委托
+ * @param IconInfo 选中的图标信息
+ * @param FilePath 图标文件路径
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnIconBrowserIconSelected, const FToolbarIconInfo&, IconInfo, const FString&, FilePath);
+
+/**
+ * 图标浏览器UMG控件
+ * 封装SUtilityExtendIconBrowser，供IconRegTool等编辑器工具控件蓝图直接使用，
+ * 替代蓝图中逐个同步加载图标的列表
+ */
+UCLASS(meta = (DisplayName = "UtilityExtend Icon Browser"))
+class UTILITYEXTEND_API UUtilityExtendIconBrowserWidget : public UWidget
+{
+    GENERATED_BODY()
+
+public:
+    /** 图块边长 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UtilityExtend|IconBrowser", meta = (ClampMin = "16", ClampMax = "256"))
+    float TileSize = 72.0f;
+
+    /** 缩略图解码尺寸（像素） */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UtilityExtend|IconBrowser", meta = (ClampMin = "8", ClampMax = "256"))
+    int32 ThumbnailSize = 64;
+
+    /** 图标来源目录，为空时显示所有已注册的图标 */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UtilityExtend|IconBrowser")
+    FString SourceDirectory;
+
+    /** 图标选中事件 */
+    UPROPERTY(BlueprintAssignable, Category = "UtilityExtend|IconBrowser")
+    FOnIconBrowserIconSelected OnIconSelected;
+
+    /** 重新枚举图标 */
+    UFUNCTION(BlueprintCallable, Category = "UtilityExtend|IconBrowser", meta = (DisplayName = "刷新图标列表"))
+    void RefreshIcons();
+
+    /** 设置图标来源目录 */
+    UFUNCTION(BlueprintCallable, Category = "UtilityExtend|IconBrowser", meta = (DisplayName = "设置图标目录"))
+    void SetSourceDirectory(const FString& InSourceDirectory);
+
+    /** 设置过滤文本 */
+    UFUNCTION(BlueprintCallable, Category = "UtilityExtend|IconBrowser", meta = (DisplayName = "设置过滤文本"))
+    void SetFilterText(const FText& InFilterText);
+
+    /** 获取当前选中的图标 */
+    UFUNCTION(BlueprintCallable, Category = "UtilityExtend|IconBrowser", meta = (DisplayName = "获取选中图标"))
+    bool GetSelectedIcon(FToolbarIconInfo& OutIconInfo, FString& OutFilePath) const;
+
+    //~ Begin UVisual Interface
+    virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+    //~ End UVisual Interface
+
+#if WITH_EDITOR
+    virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+    //~ Begin UWidget Interface
+    virtual TSharedRef<SWidget> RebuildWidget() override;
+    //~ End UWidget Interface
+
+private:
+    /** Slate图标选中回调 */
+    void HandleIconSelected(TSharedPtr<FUtilityExtendIconCatalogItem> Item);
+
+private:
+    /** Slate控件 */
+    TSharedPtr<SUtilityExtendIconBrowser> MyIconBrowser;
+};
@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+struct FSlateBrush;
+class IImageWrapperModule;
+
+/**
+ * 缩略图加载状态
+ */
+enum class EUtilityExtendThumbnailState : uint8
+{
+    /** 尚未请求 */
+    NotLoaded,
+    /** 正在后台解码 */
+    Loading,
+    /** 已加载完成 */
+    Loaded,
+    /** 加载失败 */
+    Failed
+};
+
+/**
+ * 图标目录中的一项
+ * 只能在游戏线程上访问，后台线程只接触文件路径的副本
+ */
+struct UTILITYEXTEND_API FUtilityExtendIconCatalogItem
+{
+    /** 图标信息（目录扫描得到的文件IconName为None） */
+    FToolbarIconInfo IconInfo;
+
+    /** 图标文件的绝对路径 */
+    FString FilePath;
+
+    /** 缩略图状态 */
+    EUtilityExtendThumbnailState ThumbnailState = EUtilityExtendThumbnailState::NotLoaded;
+
+    /** 缩略图画刷，加载完成前为空 */
+    TSharedPtr<FSlateBrush> ThumbnailBrush;
+
+    /** 加载代数，失效后递增，用于丢弃过期的解码结果 */
+    int32 LoadGeneration = 0;
+};
+
+/**
+ * 图标目录
+ * 从FUtilityExtendIconRegistry或指定目录枚举图标，并在线程池上异步解码缩略图
+ * 请求按后进先出处理，列表滚动时最新可见的图标会优先解码；
+ * 等待队列有上限，超出时丢弃最早的请求，快速滚动时不会解码所有滑过的图标
+ */
+class UTILITYEXTEND_API FUtilityExtendIconCatalog : public TSharedFromThis<FUtilityExtendIconCatalog>
+{
+public:
+    explicit FUtilityExtendIconCatalog(int32 InThumbnailSize = 64, int32 InMaxConcurrentDecodes = 4, int32 InMaxPendingRequests = 128);
+    ~FUtilityExtendIconCatalog();
+
+    /** 枚举所有已注册的图标 */
+    static TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> EnumerateRegisteredIcons();
+
+    /** 枚举目录下的所有SVG/PNG文件（不递归） */
+    static TArray<TSharedPtr<FUtilityExtendIconCatalogItem>> EnumerateDirectory(const FString& Directory);
+
+    /** 根据图标样式名称获取对应的图标文件路径 */
+    static FString ResolveIconFilePath(FName IconStyleName);
+
+    /** 请求加载缩略图，已加载或正在加载时直接忽略 */
+    void RequestThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item);
+
+    /** 取消尚未开始解码的请求，图块离开可见区域时调用；已经在解码的请求不受影响 */
+    void CancelThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item);
+
+    /** 丢弃已加载的缩略图，下次请求时重新解码 */
+    void InvalidateThumbnail(const TSharedPtr<FUtilityExtendIconCatalogItem>& Item);
+
+    /** 取消所有尚未开始的请求 */
+    void CancelPendingRequests();
+
+    /** 任意缩略图加载完成时广播 */
+    FSimpleMulticastDelegate& OnThumbnailLoaded() { return ThumbnailLoadedEvent; }
+
+private:
+    /** 后台解码结果 */
+    struct FDecodedThumbnail
+    {
+        bool bSuccess = false;
+        bool bIsVector = false;
+        int32 Width = 0;
+        int32 Height = 0;
+        TArray<uint8> BGRA;
+    };
+
+    /** 在后台线程解码图标文件 */
+    static FDecodedThumbnail DecodeThumbnail(IImageWrapperModule* ImageWrapperModule, const FString& FilePath, int32 ThumbnailSize);
+
+    /** 启动队列中的请求，直到达到并发上限 */
+    void PumpQueue();
+
+    /** 解码完成后在游戏线程上创建画刷 */
+    void FinishThumbnail(TWeakPtr<FUtilityExtendIconCatalogItem> WeakItem, int32 Generation, FDecodedThumbnail&& Decoded);
+
+private:
+    /** 缩略图边长（像素） */
+    int32 ThumbnailSize;
+
+    /** 同时进行的最大解码数量 */
+    int32 MaxConcurrentDecodes;
+
+    /** 等待队列的最大长度 */
+    int32 MaxPendingRequests;
+
+    /** 正在解码的数量 */
+    int32 InFlightDecodes;
+
+    /** 等待解码的请求 */
+    TArray<TWeakPtr<FUtilityExtendIconCatalogItem>> PendingRequests;
+
+    /** 图片解码模块（在游戏线程上加载，后台线程直接使用） */
+    IImageWrapperModule* ImageWrapperModule;
+
+    /** 缩略图加载完成事件 */
+    FSimpleMulticastDelegate ThumbnailLoadedEvent;
+};
@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+#include "UtilityExtendIconImporter.generated.h"
+
+/**
+ * 批量导入图标的结果
+ */
+USTRUCT(BlueprintType)
+struct UTILITYEXTEND_API FUtilityExtendIconImportResult
+{
+    GENERATED_BODY()
+
+    /** 成功导入并注册的图标样式名称 */
+    UPROPERTY(BlueprintReadOnly, Category = "UtilityExtend|IconImport")
+    TArray<FString> ImportedIconNames;
+
+    /** 与已有图标内容相同而被跳过的源文件 */
+    UPROPERTY(BlueprintReadOnly, Category = "UtilityExtend|IconImport")
+    TArray<FString> DuplicateFiles;
+
+    /** 导入失败的源文件 */
+    UPROPERTY(BlueprintReadOnly, Category = "UtilityExtend|IconImport")
+    TArray<FString> FailedFiles;
+
+    /** 与FailedFiles一一对应的失败原因 */
+    UPROPERTY(BlueprintReadOnly, Category = "UtilityExtend|IconImport")
+    TArray<FString> FailureReasons;
+
+    /** 注册代码块是否已写回源文件（下次编译后图标仍然可用） */
+    UPROPERTY(BlueprintReadOnly, Category = "UtilityExtend|IconImport")
+    bool bSourceUpdated = false;
+};
+
+/**
+ * 批量导入完成事件委托
+ * @param Result 导入结果
+ */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnIconImportCompleted, const FUtilityExtendIconImportResult&, Result);
+
+/**
+ * 批量导入选项
+ */
+struct UTILITYEXTEND_API FUtilityExtendIconImportOptions
+{
+    /** SVG规范化后的width/height，与样式集中的图标尺寸保持一致 */
+    int32 TargetIconSize = 20;
+
+    /** 单个文件的最大字节数 */
+    int64 MaxFileSizeBytes = 1024 * 1024;
+
+    /** PNG图标允许的最大边长 */
+    int32 MaxRasterDimension = 512;
+
+    /** 是否把注册代码写回<custom_icon>代码块 */
+    bool bWriteRegistrationSource = true;
+};
+
+/**
+ * 图标批量导入管线
+ * 在线程池上并行校验、清理和规范化SVG/PNG文件，按内容哈希去重后写入插件Resources目录，
+ * 最后在游戏线程上一次性注册所有新图标，整个过程只显示一个进度通知
+ */
+class UTILITYEXTEND_API FUtilityExtendIconImporter
+{
+public:
+    /** 导入完成回调（在游戏线程上调用） */
+    typedef TFunction<void(const FUtilityExtendIconImportResult&)> FOnImportFinished;
+
+    /**
+     * 异步导入一批图标文件
+     * @param SourceFiles 源文件路径列表
+     * @param Options 导入选项
+     * @param OnFinished 完成回调
+     * @return 是否成功开始导入（同一时间只允许一个导入任务）
+     */
+    static bool ImportFiles(const TArray<FString>& SourceFiles, const FUtilityExtendIconImportOptions& Options, FOnImportFinished OnFinished);
+
+    /** 收集目录下的所有SVG/PNG文件 */
+    static TArray<FString> CollectIconFiles(const FString& Directory, bool bRecursive);
+
+    /** 是否有导入任务正在进行 */
+    static bool IsImportInProgress();
+
+private:
+    /** 单个文件的处理结果 */
+    struct FPreparedIcon
+    {
+        /** 源文件路径 */
+        FString SourceFile;
+
+        /** 规范化后的文件内容 */
+        TArray<uint8> Data;
+
+        /** 原始文件内容哈希 */
+        FSHAHash SourceHash;
+
+        /** 规范化后的内容哈希 */
+        FSHAHash DataHash;
+
+        /** 小写扩展名（svg/png） */
+        FString Extension;
+
+        /** 目标文件名（不含扩展名） */
+        FString FileBaseName;
+
+        /** 错误信息，为空表示处理成功 */
+        FString Error;
+
+        /** 与已有文件重复时记录该文件名 */
+        FString DuplicateOf;
+    };
+
+    /** 在工作线程上校验、清理并规范化单个文件 */
+    static void PrepareIcon(FPreparedIcon& Icon, const FUtilityExtendIconImportOptions& Options, class IImageWrapperModule* ImageWrapperModule);
+
+    /** 移除SVG中的脚本、事件属性、外部引用等不安全内容 */
+    static bool SanitizeSvg(FString& Svg, FString& OutError);
+
+    /** 规范化SVG根节点的viewBox与width/height */
+    static bool NormalizeSvgRoot(FString& Svg, int32 TargetSize, FString& OutError);
+
+    /** 校验PNG文件 */
+    static bool ValidateRaster(const TArray<uint8>& Data, int32 MaxDimension, class IImageWrapperModule* ImageWrapperModule, FString& OutError);
+
+    /** 把文件名转换为合法的图标名称 */
+    static FString MakeIconBaseName(const FString& SourceFile);
+
+    /** 在<custom_icon>代码块末尾追加注册代码 */
+    static bool AppendCustomIconLines(const FString& SourceFilePath, const TArray<FString>& Lines);
+
+private:
+    /** 是否有导入任务正在进行 */
+    static bool bImportInProgress;
+};
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Notification/UtilityExtendNotificationTypes.h"
+
+class ITableRow;
+class SDockTab;
+class STableViewBase;
+class FSpawnTabArgs;
+
+/**
+ * 通知历史面板
+ * 显示通知子系统历史缓冲区中的记录，按时间从新到旧排列；
+ * 定时检查历史版本号，只有记录变化时才重新查询
+ */
+class UTILITYEXTEND_API SUtilityExtendNotificationHistory : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SUtilityExtendNotificationHistory) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** 通知历史标签页ID */
+	static const FName TabId;
+
+	/** 注册通知历史标签页 */
+	static void RegisterTabSpawner();
+
+	/** 注销通知历史标签页 */
+	static void UnregisterTabSpawner();
+
+private:
+	/** 生成标签页 */
+	static TSharedRef<SDockTab> SpawnTab(const FSpawnTabArgs& Args);
+
+	/** 历史版本号变化时刷新列表 */
+	EActiveTimerReturnType RefreshIfChanged(double InCurrentTime, float InDeltaTime);
+
+	/** 重新查询历史记录 */
+	void RefreshRecords();
+
+	/** 生成列表行 */
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FUtilityNotificationRecord> Record, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** 搜索框文本变化 */
+	void OnSearchTextChanged(const FText& InFilterText);
+
+	/** 清空历史 */
+	FReply OnClearClicked();
+
+	/** 获取状态栏文本 */
+	FText GetStatusText() const;
+
+private:
+	/** 当前显示的记录 */
+	TArray<TSharedPtr<FUtilityNotificationRecord>> Records;
+
+	/** 记录列表 */
+	TSharedPtr<SListView<TSharedPtr<FUtilityNotificationRecord>>> ListView;
+
+	/** 当前过滤文本 */
+	FString FilterString;
+
+	/** 当前显示的历史版本号 */
+	uint32 DisplayedHistoryVersion = MAX_uint32;
+};
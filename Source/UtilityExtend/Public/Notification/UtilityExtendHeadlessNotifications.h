@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Notification/UtilityExtendNotificationTypes.h"
+
+/**
+ * 无界面通知事件
+ */
+struct UTILITYEXTEND_API FUtilityHeadlessNotificationEvent
+{
+	/** 事件类型 */
+	enum class EKind : uint8
+	{
+		/** 常规通知 */
+		Notify,
+		/** 加载通知开始 */
+		Begin,
+		/** 加载通知文本更新 */
+		Text,
+		/** 加载通知进度 */
+		Progress,
+		/** 加载通知结束，Type为成功、失败或默认（关闭） */
+		Complete,
+		/** 因频率限制未输出的通知汇总 */
+		Suppressed,
+	};
+
+	EKind Kind = EKind::Notify;
+	FString Id;
+	FString Message;
+	FString Source;
+	EEditorNotificationType Type = EEditorNotificationType::Default;
+
+	/** 进度 (0.0 - 1.0)，只对进度事件有效 */
+	float Progress = 0.0f;
+
+	/** 已完成数量和总数量，总数量为0时不输出数量 */
+	int32 Completed = 0;
+	int32 Total = 0;
+
+	/** 汇总的通知数量，只对汇总事件有效 */
+	int32 SuppressedCount = 0;
+
+	/** 事件时间（UTC） */
+	FDateTime Timestamp;
+
+	/** 事件类型名称，用于输出 */
+	static const TCHAR* LexKind(EKind Kind);
+};
+
+/**
+ * 无界面通知输出接口
+ * 实现后通过FUtilityExtendHeadlessNotifications::SetSink替换按设置创建的默认输出；
+ * 所有调用都在FUtilityExtendHeadlessNotifications的锁内进行，实现不需要自己加锁
+ */
+class UTILITYEXTEND_API IUtilityExtendNotificationSink
+{
+public:
+	virtual ~IUtilityExtendNotificationSink() = default;
+
+	/** 写入一条事件，可以先缓冲 */
+	virtual void Write(const FUtilityHeadlessNotificationEvent& Event) = 0;
+
+	/** 把缓冲的事件写出 */
+	virtual void Flush() {}
+};
+
+/**
+ * 无界面通知
+ * 没有Slate时（命令行工具、-nullrhi自动化），蓝图函数库和通知队列的通知和进度改写到这里，
+ * 经过频率限制后交给输出接口：新建通知和文本更新受每秒通知上限限制，超出的汇总为一条事件；
+ * 同一通知的进度按设置的间隔输出；开始和结束事件总会输出。可以在任意线程调用。
+ */
+class UTILITYEXTEND_API FUtilityExtendHeadlessNotifications
+{
+public:
+	/** 获取实例 */
+	static FUtilityExtendHeadlessNotifications& Get();
+
+	/** 当前是否没有Slate，需要改用无界面输出 */
+	static bool IsHeadless();
+
+	/** 创建写入LogUtilityExtendNotification日志分类的输出 */
+	static TSharedRef<IUtilityExtendNotificationSink> MakeLogSink();
+
+	/** 创建缓冲写入JSON Lines文件的输出，文件以追加方式打开 */
+	static TSharedRef<IUtilityExtendNotificationSink> MakeJsonLinesSink(const FString& FilePath);
+
+	/**
+	 * 替换输出
+	 * @param InSink 新的输出，为空时恢复按设置创建的默认输出
+	 */
+	void SetSink(TSharedPtr<IUtilityExtendNotificationSink> InSink);
+
+	/** 分配通知ID */
+	FString AllocateId();
+
+	/**
+	 * 输出常规通知
+	 * @return 通知ID，被频率限制时同样返回ID
+	 */
+	FString Notify(const FString& Message, EEditorNotificationType Type, const FString& Source);
+
+	/** 输出加载通知开始 */
+	void Begin(const FString& Id, const FString& Message, const FString& Source);
+
+	/** 输出加载通知文本更新 */
+	void UpdateText(const FString& Id, const FString& Message);
+
+	/** 输出加载通知进度，距离上次输出不足间隔时跳过 */
+	void UpdateProgress(const FString& Id, float Progress, int32 Completed = 0, int32 Total = 0);
+
+	/**
+	 * 输出加载通知结束
+	 * @param Type 成功、失败或默认（关闭）
+	 * @param Message 最终文本，为空时不输出文本
+	 */
+	void Complete(const FString& Id, EEditorNotificationType Type, const FString& Message = FString());
+
+	/** 输出尚未汇总的被限制通知，并把缓冲的事件写出 */
+	void Flush();
+
+	/** 写出缓冲的事件并释放输出，模块关闭时调用 */
+	void Shutdown();
+
+private:
+	/** 补全时间后写入输出，调用前必须持有锁 */
+	void WriteLocked(FUtilityHeadlessNotificationEvent& Event);
+
+	/** 按每秒上限尝试消耗一个令牌，令牌不足时记录为被限制，调用前必须持有锁 */
+	bool TryConsumeRateTokenLocked(const FString& Message);
+
+	/** 输出被限制通知的汇总，调用前必须持有锁 */
+	void FlushSuppressedLocked();
+
+	/** 获取输出，尚未设置时按设置创建，调用前必须持有锁 */
+	IUtilityExtendNotificationSink* GetSinkLocked();
+
+	/** 保护以下全部成员 */
+	FCriticalSection Lock;
+
+	/** 当前输出 */
+	TSharedPtr<IUtilityExtendNotificationSink> Sink;
+
+	/** 是否已按设置创建输出（设置为不输出时Sink为空） */
+	bool bSinkResolved = false;
+
+	/** 下一个通知ID */
+	uint32 NextId = 1;
+
+	/** 频率限制的令牌数和上一次补充令牌的时间 */
+	double RateTokens = -1.0;
+	double LastRateRefillTime = 0.0;
+
+	/** 尚未汇总的被限制通知数量和最后一条内容 */
+	int32 PendingSuppressedCount = 0;
+	FString LastSuppressedMessage;
+
+	/** 每个通知上一次输出进度的时间，通知结束时移除，数量较多时清理已超过输出间隔的记录 */
+	TMap<FString, double> LastProgressTimes;
+};
@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityExtendProgressBar.h"
+#include <atomic>
+
+/**
+ * 线程安全的通知入口
+ * 任意线程都可以创建通知、更新文本和进度、完成通知，调用只把命令压入无锁的多生产者单消费者队列；
+ * 通知子系统每帧在游戏线程上取出队列中的全部命令，同一通知在一帧内被后续命令覆盖的文本和进度只应用最后一次，
+ * 每个通知每帧最多触发一次Slate更新。工作线程不需要再为每条消息手动切换到游戏线程。
+ * 没有Slate，或者没有通知子系统处理队列时（编辑器启动早期、命令行工具），创建的通知直接写入FUtilityExtendHeadlessNotifications，不经过队列。
+ * 去向在创建时确定并记录在通知编号中，之后的更新和完成始终走同一去向；子系统关闭时仍在显示的通知被关闭，之后的命令被丢弃。
+ */
+class UTILITYEXTEND_API FUtilityExtendNotificationQueue
+{
+public:
+	/** 获取队列实例 */
+	static FUtilityExtendNotificationQueue& Get();
+
+	/**
+	 * 创建带加载动画的通知，可在任意线程调用
+	 * @return 通知编号，用于后续更新；通知在下一次处理队列时才真正显示
+	 */
+	uint32 Create(const FString& Message);
+
+	/** 更新通知文本，可在任意线程调用 */
+	void UpdateText(uint32 NotificationId, const FString& Message);
+
+	/** 更新进度 (0.0 - 1.0)，可在任意线程调用 */
+	void UpdateProgress(uint32 NotificationId, float Progress);
+
+	/** 按完成数量更新进度，可在任意线程调用 */
+	void UpdateProgressCount(uint32 NotificationId, int32 Completed, int32 Total);
+
+	/**
+	 * 完成通知并淡出，可在任意线程调用
+	 * @param bSuccess 是否成功
+	 * @param Message 最终显示的文本，为空时保留原文本
+	 */
+	void Complete(uint32 NotificationId, bool bSuccess, const FString& Message = FString());
+
+	/**
+	 * 在游戏线程上处理队列中的全部命令，由通知子系统每帧调用
+	 * @return 处理的命令数量
+	 */
+	int32 Drain(UUtilityExtendNotificationSubsystem& Subsystem);
+
+	/** 应用队列中剩余的命令并关闭仍在显示的通知，子系统关闭时在SetConsumerAvailable(false)之后调用 */
+	void Shutdown(UUtilityExtendNotificationSubsystem& Subsystem);
+
+	/** 设置是否有通知子系统每帧处理队列，子系统初始化和关闭时调用 */
+	void SetConsumerAvailable(bool bAvailable);
+
+private:
+	/** 命令类型 */
+	enum class ECommandType : uint8
+	{
+		Create,
+		UpdateText,
+		UpdateProgress,
+		Complete,
+	};
+
+	/** 队列中的一条命令 */
+	struct FCommand
+	{
+		ECommandType Type = ECommandType::Create;
+		uint32 NotificationId = 0;
+		FString Message;
+		float Progress = 0.0f;
+		int32 Completed = 0;
+		int32 Total = 0;
+		bool bSuccess = false;
+	};
+
+	/** 一帧内合并后的通知状态变化 */
+	struct FPendingChange
+	{
+		bool bCreate = false;
+		bool bHasText = false;
+		bool bHasProgress = false;
+		bool bComplete = false;
+		bool bSuccess = false;
+		FString Message;
+		int32 Permille = 0;
+		int32 Completed = 0;
+		int32 Total = 0;
+	};
+
+	/** 已显示的通知 */
+	struct FLiveNotification
+	{
+		FUtilityNotificationHandle Handle;
+		/** 当前文本，用作进度条上的文本 */
+		FString Message;
+		/** 首次更新进度时创建的进度条 */
+		FUtilityExtendProgressBar ProgressBar;
+	};
+
+	/** 是否有通知子系统处理队列 */
+	bool HasConsumer() const;
+
+	/** 新建的通知是否绕过队列直接写入无界面输出 */
+	bool ShouldBypassQueue() const;
+
+	/** 把命令合并到本帧的状态变化中 */
+	static void MergeCommand(FPendingChange& Change, FCommand&& Command);
+
+	/** 把一个通知本帧的状态变化应用到Slate */
+	void ApplyChange(UUtilityExtendNotificationSubsystem& Subsystem, uint32 NotificationId, FPendingChange& Change);
+
+	/** 多生产者单消费者无锁队列 */
+	TQueue<FCommand, EQueueMode::Mpsc> Commands;
+
+	/** 是否有通知子系统处理队列 */
+	std::atomic<bool> bHasConsumer { false };
+
+	/** 下一个通知编号，0表示无效 */
+	std::atomic<uint32> NextNotificationId { 1 };
+
+	/** 已显示、尚未完成的通知，只在游戏线程访问 */
+	TMap<uint32, FLiveNotification> LiveNotifications;
+};
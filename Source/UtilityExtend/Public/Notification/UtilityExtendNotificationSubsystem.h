@@ -0,0 +1,263 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Notification/UtilityExtendNotificationTypes.h"
+#include "UtilityExtendNotificationSubsystem.generated.h"
+
+class UUtilityLoadingNotification;
+class UUtilityProgressGroup;
+
+/**
+ * 通知句柄
+ * Index为槽位索引，Serial为登记时分配的序号；槽位被回收复用后序号不同，旧句柄不会误指向新通知
+ */
+struct UTILITYEXTEND_API FUtilityNotificationHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	bool operator==(const FUtilityNotificationHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+	bool operator!=(const FUtilityNotificationHandle& Other) const { return !(*this == Other); }
+
+	/** 转为蓝图使用的通知ID字符串 */
+	FString ToString() const;
+
+	/** 从通知ID字符串解析句柄，格式不符时返回无效句柄 */
+	static FUtilityNotificationHandle FromString(const FString& NotificationId);
+};
+
+/**
+ * 编辑器通知管理子系统
+ * 用句柄表跟踪插件创建的通知，登记和移除都是O(1)；
+ * 表中只保存通知项的弱引用，Slate在通知淡出后释放通知项，定时回收时即可发现并释放槽位，
+ * 自动过期的通知不需要调用方手动移除。
+ * 常规通知经过合并和频率限制：合并窗口内的重复通知只更新重复次数，超出每秒上限的通知汇总为一条提示。
+ * 子系统每帧处理FUtilityExtendNotificationQueue中其他线程提交的通知命令。
+ * 最近的通知保存在固定容量的历史环形缓冲区中，通知淡出后仍可查询。
+ * 加载通知对象由对象池提供，使用期间由子系统持有，通知消失后自动归还对象池复用；运行中的进度组同样由子系统持有到结束。
+ */
+UCLASS()
+class UTILITYEXTEND_API UUtilityExtendNotificationSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取子系统实例，编辑器未启动时返回nullptr */
+	static UUtilityExtendNotificationSubsystem* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * 显示常规通知，经过合并和频率限制
+	 * @param Info 通知信息
+	 * @param CompletionState 完成状态
+	 * @param CoalesceKey 合并键，为空时按通知类型和消息内容合并
+	 * @param Source 发出通知的脚本，记录到通知历史
+	 * @return 通知句柄；合并到已有通知时返回已有通知的句柄，被频率限制时返回无效句柄
+	 */
+	FUtilityNotificationHandle ShowNotification(const FNotificationInfo& Info, SNotificationItem::ECompletionState CompletionState, const FString& CoalesceKey = FString(), const FString& Source = FString());
+
+	/**
+	 * 登记通知
+	 * @param Item 已添加到通知管理器的通知项
+	 * @param bFireAndForget 是否会自动过期
+	 * @param Owner 负责关闭通知的对象，为空表示只能通过句柄关闭
+	 * @return 通知句柄
+	 */
+	FUtilityNotificationHandle Register(const TSharedPtr<SNotificationItem>& Item, bool bFireAndForget, UObject* Owner = nullptr);
+
+	/** 淡出并移除指定通知，句柄已失效时返回false */
+	bool Remove(FUtilityNotificationHandle Handle);
+
+	/** 淡出并移除所有通知 */
+	void RemoveAll();
+
+	/** 查找通知项，通知已淡出或句柄已失效时返回空指针 */
+	TSharedPtr<SNotificationItem> Find(FUtilityNotificationHandle Handle) const;
+
+	/** 立即回收已经淡出的通知，返回回收数量 */
+	int32 ReclaimExpired();
+
+	/** 当前跟踪的通知数量 */
+	int32 GetActiveCount() const { return Slots.Num(); }
+
+	/** 负责关闭的对象已被回收或已结束使用、但通知仍在显示且不会自动过期的数量，每次回收时重新统计 */
+	int32 GetLeakedCount() const { return LeakedCount; }
+
+	/**
+	 * 添加通知历史记录，缓冲区已满时覆盖最旧的记录
+	 * @return 记录序号，历史容量为0时返回0
+	 */
+	uint64 AddHistoryRecord(const FString& Message, EEditorNotificationType Type, const FString& Source, bool bRateLimited = false);
+
+	/**
+	 * 查询通知历史，按时间从新到旧排列
+	 * @param Keyword 关键字，匹配内容或来源，为空时不过滤
+	 * @param Source 来源脚本关键字，为空时不过滤
+	 * @param TypeFilter 通知类型，未设置时不过滤
+	 * @param MaxCount 最多返回数量，0表示不限制
+	 */
+	TArray<FUtilityNotificationRecord> QueryHistory(const FString& Keyword = FString(), const FString& Source = FString(),
+		TOptional<EEditorNotificationType> TypeFilter = TOptional<EEditorNotificationType>(), int32 MaxCount = 0) const;
+
+	/** 清空通知历史 */
+	void ClearHistory();
+
+	/** 历史版本号，每次添加、更新或清空记录后递增，供历史面板判断是否需要刷新 */
+	uint32 GetHistoryVersion() const { return HistoryVersion; }
+
+	/** 从对象池取出加载通知对象，使用期间由子系统持有，不会被垃圾回收 */
+	UUtilityLoadingNotification* AcquireLoadingNotification();
+
+	/** 关闭通知并把加载通知对象归还对象池，对象不是从对象池取出时返回false */
+	bool ReleaseLoadingNotification(UUtilityLoadingNotification* Notification);
+
+	/** 持有运行中的进度组，结束或取消前不会被垃圾回收 */
+	void AddActiveProgressGroup(UUtilityProgressGroup* ProgressGroup);
+
+	/** 进度组结束或取消后释放持有 */
+	void RemoveActiveProgressGroup(UUtilityProgressGroup* ProgressGroup);
+
+private:
+	/** 句柄表中的一个槽位 */
+	struct FNotificationSlot
+	{
+		TWeakPtr<SNotificationItem> Item;
+		TWeakObjectPtr<UObject> Owner;
+		uint32 Serial = 0;
+		bool bFireAndForget = false;
+		bool bHasOwner = false;
+		bool bLeakReported = false;
+	};
+
+	/** 合并窗口内的一条通知 */
+	struct FCoalescedEntry
+	{
+		FUtilityNotificationHandle Handle;
+		uint64 HistorySequence = 0;
+		int32 RepeatCount = 1;
+		double LastTime = 0.0;
+
+		/** 自动消失的通知开始淡出的时间，之后不再合并；0表示通知不会自动消失 */
+		double FadeStartTime = 0.0;
+
+		/** 通知显示的时长，合并时据此重新计时 */
+		float ExpireDuration = 0.0f;
+	};
+
+	/** 按序号查找仍在缓冲区中的历史记录 */
+	FUtilityNotificationRecord* FindHistoryRecord(uint64 Sequence);
+
+	/** 调整历史容量，保留最新的记录 */
+	void ResizeHistory(int32 NewCapacity);
+
+	/** 按每秒上限补充令牌并尝试消耗一个，令牌不足时返回false */
+	bool TryConsumeRateToken(double Now);
+
+	/** 把被频率限制的通知汇总显示，已有汇总提示仍在显示时只更新数量 */
+	void FlushSuppressedSummary(double Now);
+
+	/** 定时回收已淡出的通知 */
+	bool TickReclaim(float DeltaTime);
+
+	/** 每帧处理线程安全通知队列 */
+	bool TickDrainQueue(float DeltaTime);
+
+	/** 查找句柄对应的槽位，序号不匹配时返回nullptr */
+	const FNotificationSlot* FindSlot(FUtilityNotificationHandle Handle) const;
+
+	/** 所属对象仍然存在，但已经结束这次使用而通知仍在加载中 */
+	bool IsOwnerDetached(const FNotificationSlot& Slot, FUtilityNotificationHandle Handle) const;
+
+	/** 槽位被移除后，如果所属对象是开启了自动回收的加载通知，把它归还对象池 */
+	void AutoReleaseOwner(const FNotificationSlot& Slot, FUtilityNotificationHandle Handle);
+
+	/** 把加载通知对象重置后放回对象池 */
+	void ReturnToPool(UUtilityLoadingNotification* Notification);
+
+	/** 无界面加载通知没有通知项，完成后直接归还对象池 */
+	void ReleaseCompletedHeadless();
+
+	/** 更新统计项 */
+	void UpdateStats() const;
+
+	/** 句柄表，移除后的空位由下一次登记复用 */
+	TSparseArray<FNotificationSlot> Slots;
+
+	/** 合并键到合并窗口内通知的映射，窗口过期后在定时回收时清理 */
+	TMap<FString, FCoalescedEntry> CoalescedEntries;
+
+	/** 频率限制的令牌数，上限为每秒通知上限 */
+	double RateTokens = 0.0;
+
+	/** 上一次补充令牌的时间 */
+	double LastRateRefillTime = 0.0;
+
+	/** 尚未汇总显示的被限制通知数量 */
+	int32 PendingSuppressedCount = 0;
+
+	/** 最后一条被限制的通知内容，汇总提示中显示 */
+	FString LastSuppressedMessage;
+
+	/** 汇总提示的句柄 */
+	FUtilityNotificationHandle SummaryHandle;
+
+	/** 汇总提示当前显示的数量 */
+	int32 SummarySuppressedCount = 0;
+
+	/** 累计合并的通知数量 */
+	int32 CoalescedCount = 0;
+
+	/** 累计被频率限制的通知数量 */
+	int32 SuppressedCount = 0;
+
+	/** 下一个分配的序号，从1开始，0表示无效 */
+	uint32 NextSerial = 1;
+
+	/** 历史环形缓冲区，序号为S的记录位于S % HistoryCapacity */
+	TArray<FUtilityNotificationRecord> History;
+
+	/** 历史容量 */
+	int32 HistoryCapacity = 0;
+
+	/** 缓冲区中有效的记录数量 */
+	int32 HistoryCount = 0;
+
+	/** 下一条历史记录的序号，从1开始 */
+	uint64 NextHistorySequence = 1;
+
+	/** 历史版本号 */
+	uint32 HistoryVersion = 0;
+
+	/** 泄漏的通知数量，每次回收时重新统计 */
+	int32 LeakedCount = 0;
+
+	/** 累计自动回收的通知数量 */
+	int32 ReclaimedCount = 0;
+
+	/** 正在使用的加载通知对象 */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<UUtilityLoadingNotification>> ActiveLoadingNotifications;
+
+	/** 空闲的加载通知对象 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUtilityLoadingNotification>> LoadingNotificationPool;
+
+	/** 运行中的进度组 */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<UUtilityProgressGroup>> ActiveProgressGroups;
+
+	/** 定时回收的Ticker句柄 */
+	FTSTicker::FDelegateHandle ReclaimTickerHandle;
+
+	/** 每帧处理通知队列的Ticker句柄 */
+	FTSTicker::FDelegateHandle DrainTickerHandle;
+};
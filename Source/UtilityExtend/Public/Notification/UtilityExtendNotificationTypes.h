@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendNotificationTypes.generated.h"
+
+/**
+ * 编辑器通知类型枚举
+ */
+UENUM(BlueprintType)
+enum class EEditorNotificationType : uint8
+{
+	/** 默认通知 */
+	Default         UMETA(DisplayName = "默认"),
+	/** 成功通知 */
+	Success         UMETA(DisplayName = "成功"),
+	/** 错误通知 */
+	Error           UMETA(DisplayName = "错误")
+};
+
+/**
+ * 无界面时的通知输出方式
+ * 命令行工具和-nullrhi自动化中没有Slate，通知和进度改为写入日志或JSON Lines文件
+ */
+UENUM()
+enum class EUtilityHeadlessNotificationOutput : uint8
+{
+	/** 丢弃通知 */
+	None            UMETA(DisplayName = "不输出"),
+	/** 写入LogUtilityExtendNotification日志分类 */
+	Log             UMETA(DisplayName = "日志"),
+	/** 每条通知写为JSON文件中的一行 */
+	JsonLines       UMETA(DisplayName = "JSON Lines文件")
+};
+
+/**
+ * 通知历史记录
+ * 通知淡出后内容仍保留在通知子系统的历史环形缓冲区中，可通过蓝图查询或在通知历史面板中查看
+ */
+USTRUCT(BlueprintType)
+struct UTILITYEXTEND_API FUtilityNotificationRecord
+{
+	GENERATED_BODY()
+
+	/** 通知内容，过长时截断 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	FString Message;
+
+	/** 通知类型 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	EEditorNotificationType Type = EEditorNotificationType::Default;
+
+	/** 首次创建时间 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	FDateTime CreatedTime;
+
+	/** 最近一次更新时间，合并的重复通知会刷新该时间 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	FDateTime LastUpdatedTime;
+
+	/** 发出通知的脚本，无法确定时为空 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	FString Source;
+
+	/** 合并后的重复次数 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	int32 RepeatCount = 1;
+
+	/** 是否因频率限制没有单独显示 */
+	UPROPERTY(BlueprintReadOnly, Category = "Notification History")
+	bool bRateLimited = false;
+
+	/** 记录序号，单调递增 */
+	uint64 Sequence = 0;
+};
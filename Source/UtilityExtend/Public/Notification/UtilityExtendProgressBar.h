@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Notifications/NotificationManager.h"
+
+/**
+ * 编辑器进度条
+ * 通过FSlateNotificationManager的进度通知显示真正的进度条，有总数量时按完成数量显示，否则按千分比显示；
+ * 显示内容不变时不调用Slate，同一帧内的多次更新由调用方合并。只能在游戏线程使用
+ */
+class UTILITYEXTEND_API FUtilityExtendProgressBar
+{
+public:
+	/**
+	 * 更新进度，首次调用时创建进度条
+	 * @param DisplayText 进度条上显示的文本
+	 * @param Permille 进度千分比 (0 - 1000)，总数量为0时使用
+	 * @param Completed 已完成数量
+	 * @param Total 总数量，为0时按千分比显示
+	 */
+	void Update(const FText& DisplayText, int32 Permille, int32 Completed, int32 Total);
+
+	/** 关闭进度条 */
+	void Close();
+
+	/** 进度条是否正在显示 */
+	bool IsActive() const { return Handle.IsValid(); }
+
+private:
+	/** 进度通知句柄 */
+	FProgressNotificationHandle Handle;
+
+	/** 已显示的完成量和总量 */
+	int32 DisplayedWorkDone = INDEX_NONE;
+	int32 DisplayedTotalWork = 0;
+};
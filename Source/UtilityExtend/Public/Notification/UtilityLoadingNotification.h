@@ -4,6 +4,9 @@
 #include "UObject/NoExportTypes.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityExtendProgressBar.h"
+#include "Containers/Ticker.h"
 #include "UtilityLoadingNotification.generated.h"
 
 // 委托声明 - 按钮点击事件（使用不同名称避免冲突）
@@ -15,6 +18,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLoadingNotificationCompleted, boo
 /**
  * 加载通知对象类
  * 提供更优雅的事件绑定方式，无需实现接口
+ * 通过蓝图函数库创建的对象来自通知子系统的对象池，使用期间由子系统持有，不会被垃圾回收；
+ * 完成后通知淡出时自动回收到对象池，回收后不应再使用该对象；回收后、再次取出前的调用会被忽略。
+ * 没有Slate时通知和进度改为输出到FUtilityExtendHeadlessNotifications
  */
 UCLASS(BlueprintType, Blueprintable)
 class UTILITYEXTEND_API UUtilityLoadingNotification : public UObject
@@ -41,6 +47,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Notification Info")
 	FString Message;
 
+	// 完成（成功、失败或关闭）后通知淡出时是否自动回收到对象池，关闭后需要手动调用Release
+	UPROPERTY(BlueprintReadWrite, Category = "Notification Info")
+	bool bAutoRelease = true;
+
 	/**
 	 * 创建加载通知
 	 * @param Title 通知标题
@@ -68,11 +78,20 @@ public:
 
 	/**
 	 * 更新进度条进度
+	 * 只记录进度值，下一帧合并为一次进度条更新，可以在大循环中逐项调用
 	 * @param Progress 进度值 (0.0 - 1.0)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Utility Notification")
 	void UpdateProgress(float Progress);
 
+	/**
+	 * 按完成数量更新进度，进度条按完成数量和总数显示
+	 * @param Completed 已完成数量
+	 * @param Total 总数量
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification")
+	void UpdateProgressCount(int32 Completed, int32 Total);
+
 	/**
 	 * 更新通知文本
 	 * @param NewText 新的文本内容
@@ -92,6 +111,36 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Utility Notification", BlueprintPure)
 	bool IsNotificationActive() const;
 
+	/**
+	 * 关闭通知并把对象归还对象池，之后不应再使用该对象
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification")
+	void Release();
+
+	/** 绑定由外部创建的通知项 */
+	void BindNotificationItem(const TSharedPtr<SNotificationItem>& Item, FUtilityNotificationHandle Handle);
+
+	/** 以无界面方式使用，之后的更新输出到FUtilityExtendHeadlessNotifications */
+	void BindHeadless(const FString& Id);
+
+	/** 是否以无界面方式使用 */
+	bool IsHeadless() const { return bHeadless; }
+
+	/** 是否已经完成 */
+	bool IsCompleted() const { return bIsCompleted; }
+
+	/** 重置为初始状态，对象归还对象池时调用，之后的调用会被忽略 */
+	void ResetForReuse();
+
+	/** 对象从对象池中取出时调用，恢复接受调用 */
+	void MarkAcquired();
+
+	/** 通知句柄 */
+	FUtilityNotificationHandle GetNotificationHandle() const { return NotificationHandle; }
+
+	/** 使用序号，每次复用时递增，按钮回调据此忽略上一次使用遗留的点击 */
+	uint32 GetUseSerial() const { return UseSerial; }
+
 protected:
 	// 内部按钮点击处理函数
 	void HandleButtonClick(int32 ButtonIndex, const FString& ButtonText);
@@ -102,6 +151,18 @@ protected:
 	// 通知完成处理函数
 	void HandleNotificationCompleted(bool bSuccess);
 
+	// 请求在下一帧把进度应用到进度条
+	void RequestProgressRefresh();
+
+	// 把最新的进度应用到进度条，单次执行
+	bool TickProgress(float DeltaTime);
+
+	// 关闭进度条并取消尚未执行的刷新
+	void StopProgress();
+
+	// 对象已归还对象池时忽略调用并输出警告，返回是否忽略
+	bool RejectReleasedCall(const TCHAR* FunctionName) const;
+
 private:
 	// 通知项的弱引用
 	TWeakPtr<SNotificationItem> NotificationPtr;
@@ -112,7 +173,31 @@ private:
 	// 是否已经完成
 	bool bIsCompleted;
 
-public:
-	// 通知项的共享指针（用于蓝图库访问）
-	TSharedPtr<SNotificationItem> NotificationItem;
+	// 通知子系统中的句柄
+	FUtilityNotificationHandle NotificationHandle;
+
+	// 使用序号
+	uint32 UseSerial = 0;
+
+	// 是否以无界面方式使用
+	bool bHeadless = false;
+
+	// 是否已归还对象池
+	bool bReleasedToPool = false;
+
+	// 归还后是否已经警告过遗留的调用
+	mutable bool bWarnedReleasedCall = false;
+
+	// 进度值 (0.0 - 1.0)
+	float ProgressFraction = 0.0f;
+
+	// 已完成数量和总数量，总数量为0时按进度值显示
+	int32 ProgressCompleted = 0;
+	int32 ProgressTotal = 0;
+
+	// 编辑器进度条，首次刷新进度时创建
+	FUtilityExtendProgressBar ProgressBar;
+
+	// 等待下一帧刷新进度条的单次Ticker
+	FTSTicker::FDelegateHandle ProgressTickerHandle;
 };
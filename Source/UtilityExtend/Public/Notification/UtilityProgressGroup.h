@@ -0,0 +1,226 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeRWLock.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Notification/UtilityExtendNotificationSubsystem.h"
+#include "Notification/UtilityExtendProgressBar.h"
+#include <atomic>
+#include "UtilityProgressGroup.generated.h"
+
+/**
+ * 进度组的线程安全状态
+ * 工作线程持有共享指针即可上报进度，上报只写原子变量；任务列表只在添加任务时加写锁
+ */
+class UTILITYEXTEND_API FUtilityProgressGroupState : public TSharedFromThis<FUtilityProgressGroupState, ESPMode::ThreadSafe>
+{
+public:
+	/** 进度快照，由游戏线程定时读取 */
+	struct FSnapshot
+	{
+		/** 按权重加权的总进度 (0.0 - 1.0) */
+		double Fraction = 0.0;
+		/** 所有带数量的任务已完成的数量 */
+		int64 CompletedItems = 0;
+		/** 所有带数量的任务的总数量 */
+		int64 TotalItems = 0;
+		int32 TaskCount = 0;
+		int32 FinishedTaskCount = 0;
+		int32 FailedTaskCount = 0;
+	};
+
+	/**
+	 * 添加任务，可在任意线程调用
+	 * @param Name 任务名称
+	 * @param Weight 任务在总进度中的权重
+	 * @param TotalItems 任务的总数量，为0时只能按比例上报进度
+	 * @return 任务索引
+	 */
+	int32 AddTask(const FString& Name, float Weight, int32 TotalItems);
+
+	/** 按比例上报任务进度 (0.0 - 1.0)，可在任意线程调用 */
+	void SetTaskProgress(int32 TaskIndex, float Progress);
+
+	/** 按完成数量上报任务进度，可在任意线程调用 */
+	void SetTaskCompletedItems(int32 TaskIndex, int32 CompletedItems);
+
+	/** 标记任务完成，可在任意线程调用 */
+	void CompleteTask(int32 TaskIndex, bool bSuccess);
+
+	/** 读取当前进度 */
+	FSnapshot TakeSnapshot() const;
+
+private:
+	/** 任务完成状态 */
+	enum class ETaskState : uint8
+	{
+		Running,
+		Succeeded,
+		Failed,
+	};
+
+	/** 单个任务，地址在添加后保持不变 */
+	struct FTask
+	{
+		FString Name;
+		float Weight = 1.0f;
+		int32 TotalItems = 0;
+		/** 进度，单位为百万分之一 */
+		std::atomic<int32> ProgressPpm { 0 };
+		std::atomic<int32> CompletedItems { 0 };
+		std::atomic<ETaskState> State { ETaskState::Running };
+	};
+
+	/** 按索引查找任务，索引无效时返回nullptr */
+	FTask* FindTask(int32 TaskIndex) const;
+
+	/** 任务列表的读写锁，上报进度和读取快照只加读锁 */
+	mutable FRWLock TasksLock;
+
+	/** 任务列表 */
+	TArray<TUniquePtr<FTask>> Tasks;
+};
+
+/**
+ * 进度组
+ * 多个任务按权重汇总到同一条通知中，显示总进度、每秒完成数量和按平滑速度估算的剩余时间；
+ * 任务可以边执行边添加，调用SealTasks声明不再添加任务后，所有任务完成时通知自动以成功或失败结束，否则需要调用Finish。
+ * 运行期间由通知子系统持有，结束或取消前不会被垃圾回收。原生工作线程可以通过GetState()获取线程安全状态直接上报进度。
+ * 没有Slate时（命令行工具、-unattended）开始、进度和结束写入无界面通知输出。
+ */
+UCLASS(BlueprintType)
+class UTILITYEXTEND_API UUtilityProgressGroup : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 显示进度组通知
+	 * @param InTitle 通知标题
+	 * @return 是否创建成功
+	 */
+	bool Start(const FString& InTitle);
+
+	/**
+	 * 添加任务
+	 * @param TaskName 任务名称
+	 * @param Weight 任务在总进度中的权重
+	 * @param TotalItems 任务的总数量，为0时只能按比例上报进度
+	 * @return 任务索引
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	int32 AddTask(const FString& TaskName, float Weight = 1.0f, int32 TotalItems = 0);
+
+	/** 按比例上报任务进度 (0.0 - 1.0) */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void SetTaskProgress(int32 TaskIndex, float Progress);
+
+	/** 按完成数量上报任务进度 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void SetTaskCompletedItems(int32 TaskIndex, int32 CompletedItems);
+
+	/** 标记任务完成，调用过SealTasks时所有任务完成后通知自动结束 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void CompleteTask(int32 TaskIndex, bool bSuccess = true);
+
+	/** 声明所有任务都已添加，之后所有任务完成时通知自动结束 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void SealTasks();
+
+	/**
+	 * 结束进度组并淡出通知
+	 * @param bSuccess 是否成功
+	 * @param FinalText 最终显示的文本，为空时保留标题
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void Finish(bool bSuccess = true, const FString& FinalText = TEXT(""));
+
+	/** 取消进度组并关闭通知，不显示成功或失败 */
+	UFUNCTION(BlueprintCallable, Category = "Utility Notification|Progress Group")
+	void Cancel();
+
+	/** 获取总进度 (0.0 - 1.0) */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Utility Notification|Progress Group")
+	float GetProgress() const;
+
+	/** 获取估算的剩余时间（秒），尚无法估算时返回-1 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Utility Notification|Progress Group")
+	float GetEstimatedSecondsRemaining() const;
+
+	/** 是否已经结束 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Utility Notification|Progress Group")
+	bool IsFinished() const { return bFinished; }
+
+	/** 获取线程安全状态，供原生工作线程上报进度 */
+	TSharedRef<FUtilityProgressGroupState, ESPMode::ThreadSafe> GetState() const { return State; }
+
+	virtual void BeginDestroy() override;
+
+private:
+	/** 定时汇总进度并刷新通知 */
+	bool TickProgress(float DeltaTime);
+
+	/** 汇总进度并刷新通知或无界面输出，结束时返回false */
+	bool Refresh();
+
+	/** 无界面时由上报进度的调用驱动刷新 */
+	void RefreshHeadless(bool bForce);
+
+	/** 停止定时刷新并关闭进度条 */
+	void StopTicker();
+
+	/** 关闭仍在显示的通知，不显示成功或失败 */
+	void CloseNotification();
+
+	/** 结束后释放子系统的持有 */
+	void ReleaseFromSubsystem();
+
+	/** 线程安全状态 */
+	TSharedRef<FUtilityProgressGroupState, ESPMode::ThreadSafe> State = MakeShared<FUtilityProgressGroupState, ESPMode::ThreadSafe>();
+
+	/** 通知标题 */
+	FString Title;
+
+	/** 通知句柄 */
+	FUtilityNotificationHandle NotificationHandle;
+
+	/** 是否输出到无界面通知 */
+	bool bHeadless = false;
+
+	/** 无界面通知ID */
+	FString HeadlessId;
+
+	/** 显示总进度的编辑器进度条 */
+	FUtilityExtendProgressBar ProgressBar;
+
+	/** 刷新通知的Ticker句柄 */
+	FTSTicker::FDelegateHandle ProgressTickerHandle;
+
+	/** 开始时间 */
+	double StartTime = 0.0;
+
+	/** 上一次采样的时间和进度 */
+	double LastSampleTime = 0.0;
+	double LastSampleFraction = 0.0;
+	int64 LastSampleItems = 0;
+
+	/** 平滑后的进度速度（每秒）和数量速度（每秒） */
+	double SmoothedFractionRate = 0.0;
+	double SmoothedItemRate = 0.0;
+
+	/** 最近一次快照的总进度 */
+	double CurrentFraction = 0.0;
+
+	/** 当前显示的副文本（无界面时为已输出的文本），内容不变时不刷新 */
+	FString DisplayedSubText;
+
+	/** 是否已经结束 */
+	bool bFinished = false;
+
+	/** 是否已声明不再添加任务 */
+	bool bTasksSealed = false;
+};
@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+/**
+ * 按钮配置的紧凑二进制格式
+ * 按钮名称、图标名称以及脚本类的包路径和资源名写入共享字符串表，正文只保存表索引，
+ * 同一个包下的多个脚本类只写一次包路径；计数和索引使用变长整数，每个字段带编号和类型，
+ * 读取时跳过不认识的字段，后续版本新增字段不会破坏旧版本的读取。
+ * 单个结构体的Serialize使用独立的字符串表；缓存等批量写入使用SerializeConfigs，所有按钮共用一张表，
+ * 归档大小和读取时间随不重复的内容增长，而不是随下拉项数量增长。
+ * 读取时仍然兼容不带格式标记的旧格式。
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigArchive
+{
+public:
+    /**
+     * 格式版本，写在每段数据开头的标记中
+     * 1为不带标记的旧格式；只新增字段时不需要递增，字段含义变化时才递增
+     */
+    static constexpr uint32 FormatVersion = 2;
+
+    /**
+     * 序列化一组按钮配置，所有按钮共用一张字符串表
+     * 读取失败时错误记录在归档上，Configs内容未定义
+     */
+    static void SerializeConfigs(FArchive& Ar, TArray<FToolbarButtonConfig>& Configs);
+
+    /** 序列化单个按钮配置，读取时自动识别旧格式 */
+    static void SerializeButton(FArchive& Ar, FToolbarButtonConfig& Config);
+
+    /** 序列化单个下拉项，读取时自动识别旧格式 */
+    static void SerializeItem(FArchive& Ar, FToolbarDropdownItem& Item);
+};
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+/**
+ * 持久化配置的二进制缓存
+ * 把解析并校验后的按钮配置保存到项目Saved目录，启动时以内存映射方式直接读取，
+ * 只有源文件的大小、修改时间和内容哈希都对不上，或缓存格式版本变化时才回退到完整解析
+ *
+ * 只缓存插件JSON这一层。项目层（UUtilityExtendSettings::ToolbarButtonConfigs）是config属性，
+ * 引擎在模块加载、创建设置类默认对象时就按ini层级（Base、Default、平台、Saved）读取并逐项调用ImportTextItem，
+ * 早于插件的任何代码，缓存无法跳过这次解析；改为由插件自行读写又会失去项目设置的"设为默认"和ini层级覆盖。
+ * 项目层的解析开销由ImportTextItem的单遍读取器控制，合并结果由FUtilityExtendConfigResolver按配置版本缓存
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigCache
+{
+public:
+    /**
+     * 缓存格式版本
+     * 修改缓存文件布局或按钮配置二进制格式后必须递增
+     * 2：配置数据改为共用字符串表的紧凑格式
+     */
+    static constexpr uint32 SchemaVersion = 2;
+
+    /**
+     * 尝试从缓存读取配置
+     * 修改时间变化但内容哈希一致时会顺带刷新缓存头
+     * @param SourcePath 配置源文件路径
+     * @param OutConfigs 缓存中的配置，失败时不修改
+     * @return 缓存是否有效并读取成功
+     */
+    static bool TryLoad(const FString& SourcePath, TArray<FToolbarButtonConfig>& OutConfigs);
+
+    /**
+     * 把配置写入缓存（先写唯一命名的临时文件再替换，多个线程同时写入也不会留下不完整的缓存）
+     * @param SourcePath 配置源文件路径
+     * @param Configs 已解析的配置
+     * @return 是否写入成功
+     */
+    static bool Store(const FString& SourcePath, const TArray<FToolbarButtonConfig>& Configs);
+
+    /** 删除缓存文件 */
+    static void Invalidate();
+
+    /** 缓存文件路径 */
+    static FString GetCacheFilePath();
+};
@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+/**
+ * 变更日志记录类型
+ */
+enum class EUtilityExtendJournalOp : uint8
+{
+    /** 日志头，记录日志所基于的配置文件内容哈希 */
+    Base,
+    /** 设置指定位置的按钮配置（位置等于数量时追加） */
+    Set,
+    /** 把按钮配置截断到指定数量 */
+    Truncate
+};
+
+/**
+ * 一条变更日志记录
+ * 记录的都是绝对状态（某个位置的完整按钮、截断后的数量），重复回放结果不变
+ */
+struct FUtilityExtendJournalRecord
+{
+    /** 记录类型 */
+    EUtilityExtendJournalOp Op = EUtilityExtendJournalOp::Set;
+
+    /** Set的目标位置 */
+    int32 Index = INDEX_NONE;
+
+    /** Truncate后的数量 */
+    int32 Count = 0;
+
+    /** Base记录中的配置文件内容哈希 */
+    FString BaseHash;
+
+    /** Set记录中的按钮配置 */
+    FToolbarButtonConfig Button;
+};
+
+/**
+ * 持久化配置的追加式变更日志
+ * 插件放在同步的网络目录时，每次修改都整体重写JSON会产生大量同步和多人写入冲突；
+ * 日志模式下修改只以单行记录追加到配置文件旁的.journal文件，加载时在配置文件之上回放，
+ * 关闭编辑器或日志超过阈值时再压缩回配置文件并删除日志
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigJournal
+{
+public:
+    /** 配置文件对应的日志文件路径 */
+    static FString GetJournalPath(const FString& BaseConfigPath);
+
+    /** 日志文件大小，不存在时返回-1 */
+    static int64 GetJournalSize(const FString& BaseConfigPath);
+
+    /**
+     * 在配置文件内容之上回放日志
+     * 日志头的哈希与当前配置文件不一致（配置文件已被别处重写）时不回放，并把日志改名保留，避免修改被静默丢弃
+     * @param BaseConfigPath 配置文件路径
+     * @param InOutConfigs 配置文件中的按钮配置，回放后为最新状态
+     * @return 回放的记录数
+     */
+    static int32 Replay(const FString& BaseConfigPath, TArray<FToolbarButtonConfig>& InOutConfigs);
+
+    /**
+     * 计算从已保存状态到当前状态需要的记录
+     * @param Persisted 配置文件加日志对应的状态
+     * @param Current 内存中的当前状态
+     * @param OutRecords 需要追加的记录，没有变化时为空
+     */
+    static void Diff(const TArray<FToolbarButtonConfig>& Persisted, const TArray<FToolbarButtonConfig>& Current, TArray<FUtilityExtendJournalRecord>& OutRecords);
+
+    /**
+     * 追加记录，日志不存在时先写入基于当前配置文件的日志头
+     * 可以在后台线程调用
+     * @return 写入的字节数，失败时返回-1
+     */
+    static int64 Append(const FString& BaseConfigPath, const TArray<FUtilityExtendJournalRecord>& Records);
+
+    /** 删除日志（压缩回配置文件之后调用） */
+    static void Delete(const FString& BaseConfigPath);
+};
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+struct FUtilityExtendJournalRecord;
+
+/**
+ * 持久化配置JSON的流式读写
+ * 直接在词法单元与FToolbarButtonConfig之间转换，不构建FJsonObject DOM，
+ * 读写结果与原先基于DOM的实现保持一致
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigJson
+{
+public:
+    /**
+     * 从UTF-8 JSON文本解析按钮配置
+     * @param Utf8Json JSON文本（可以带UTF-8 BOM）
+     * @param OutConfigs 解析出的按钮配置，失败时内容未定义
+     * @param OutError 失败原因
+     * @param OutSchemaVersion 文件记录的结构版本，没有SchemaVersion字段时为0
+     * @return 是否解析成功
+     */
+    static bool ReadButtonConfigs(FUtf8StringView Utf8Json, TArray<FToolbarButtonConfig>& OutConfigs, FString& OutError, int32* OutSchemaVersion = nullptr);
+
+    /**
+     * 从文件解析按钮配置
+     * @param FilePath JSON文件路径
+     * @param OutConfigs 解析出的按钮配置，失败时内容未定义
+     * @param OutError 失败原因
+     * @param OutSchemaVersion 文件记录的结构版本，没有SchemaVersion字段时为0
+     * @return 是否解析成功
+     */
+    static bool ReadButtonConfigsFromFile(const FString& FilePath, TArray<FToolbarButtonConfig>& OutConfigs, FString& OutError, int32* OutSchemaVersion = nullptr);
+
+    /**
+     * 把按钮配置写成格式化的JSON文本，总是写入当前的结构版本
+     * @param Configs 按钮配置
+     * @param OutJson 输出的JSON文本
+     */
+    static void WriteButtonConfigs(const TArray<FToolbarButtonConfig>& Configs, FString& OutJson);
+
+    /**
+     * 把一条变更日志记录写成单行JSON（不含换行）
+     * @param Record 日志记录
+     * @param OutLine 输出的JSON文本
+     */
+    static void WriteJournalRecord(const FUtilityExtendJournalRecord& Record, FString& OutLine);
+
+    /**
+     * 解析一行变更日志记录
+     * @param Utf8Line 单行JSON文本
+     * @param OutRecord 解析出的记录
+     * @param OutError 失败原因
+     * @return 是否解析成功
+     */
+    static bool ReadJournalRecord(FUtf8StringView Utf8Line, FUtilityExtendJournalRecord& OutRecord, FString& OutError);
+
+    /** 软类引用转为配置中的字符串（空引用写为None，未加载的引用保留原路径） */
+    static FString SoftClassToConfigString(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& SoftClass);
+
+    /** 配置中的字符串转为软类引用 */
+    static TSoftClassPtr<UUtilityExtendTopBarButtonScript> ConfigStringToSoftClass(const FString& ClassPath);
+};
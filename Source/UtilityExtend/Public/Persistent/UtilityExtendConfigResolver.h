@@ -0,0 +1,168 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+#include "Misc/SecureHash.h"
+
+/**
+ * 按钮配置的来源层，数值越大优先级越高
+ */
+enum class EUtilityExtendConfigLayer : uint8
+{
+    /** 插件持久化配置（随插件分发） */
+    Persistent,
+    /** 团队共享配置（项目设置中指定的共享目录） */
+    Shared,
+    /** 项目配置（项目设置中编辑） */
+    Project,
+    /** 用户本地覆盖（项目Saved目录，不进版本库） */
+    User
+};
+
+/**
+ * 分层按钮配置解析器
+ * 依次合并插件持久化配置、共享目录配置、项目配置和可选的用户本地覆盖，按钮名称相同（不区分大小写）时
+ * 高层的配置替换低层的配置，并保留按钮第一次出现的位置，避免工具栏顺序跳动。
+ * 合并结果按各层的版本戳缓存，只有某一层发生变化时才重新合并。
+ * 共享目录中的文件按内容哈希判断是否变化，解析结果缓存在项目Saved目录，未变化的文件启动时也不重新解析。
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigResolver
+{
+public:
+    /** 获取解析器实例 */
+    static FUtilityExtendConfigResolver& Get();
+
+    /**
+     * 获取合并后的按钮配置
+     * 返回的引用在下一次Resolve重新合并之前有效，只能在游戏线程上使用
+     */
+    const TArray<FToolbarButtonConfig>& Resolve();
+
+    /** 合并结果的版本号，每次重新合并后递增 */
+    uint32 GetResolvedVersion() const { return ResolvedVersion; }
+
+    /**
+     * 查询按钮最终来自哪一层
+     * @param ButtonName 按钮名称
+     * @param OutLayer 来源层
+     * @return 是否存在该按钮
+     */
+    bool FindButtonLayer(const FString& ButtonName, EUtilityExtendConfigLayer& OutLayer);
+
+    /**
+     * 按名称查找合并后的按钮配置（不区分大小写，O(1)）
+     * 下拉菜单打开时据此读取最新配置，注册按钮时不必为每个菜单复制整份配置
+     * @return 按钮配置，不存在时返回nullptr；指针在下一次重新合并之前有效
+     */
+    const FToolbarButtonConfig* FindResolvedButton(const FString& ButtonName);
+
+    /**
+     * 把一层配置按名称合并进结果
+     * @param LayerConfigs 这一层的配置
+     * @param Layer 来源层
+     * @param NameToIndex 已合并按钮的名称到位置的映射
+     * @param OutConfigs 合并结果
+     * @param OutLayers 与OutConfigs一一对应的来源层
+     */
+    static void MergeLayer(const TArray<FToolbarButtonConfig>& LayerConfigs, EUtilityExtendConfigLayer Layer, TMap<FString, int32>& NameToIndex,
+                           TArray<FToolbarButtonConfig>& OutConfigs, TArray<EUtilityExtendConfigLayer>& OutLayers);
+
+    /** 用户本地覆盖文件路径（格式与持久化JSON配置相同） */
+    static FString GetUserOverlayPath();
+
+    /** 共享配置解析结果的缓存文件路径 */
+    static FString GetSharedCachePath();
+
+    /**
+     * 重新扫描共享配置目录
+     * 大小和修改时间都未变化的文件不读取；内容哈希未变化的文件不重新解析
+     * @return 共享配置是否发生变化
+     */
+    bool RefreshSharedConfigs();
+
+    /** 丢弃缓存的合并结果，下次Resolve时重新扫描共享目录并强制重新合并 */
+    void Invalidate();
+
+    /** 来源层的显示名称 */
+    static const TCHAR* LexLayerName(EUtilityExtendConfigLayer Layer);
+
+private:
+    /** 各层的版本戳 */
+    struct FLayerStamps
+    {
+        uint32 PersistentVersion = 0;
+        uint32 SharedVersion = 0;
+        uint32 ProjectVersion = 0;
+        int64 UserOverlaySize = -1;
+        FDateTime UserOverlayTimestamp;
+
+        bool operator==(const FLayerStamps& Other) const
+        {
+            return PersistentVersion == Other.PersistentVersion
+                && SharedVersion == Other.SharedVersion
+                && ProjectVersion == Other.ProjectVersion
+                && UserOverlaySize == Other.UserOverlaySize
+                && UserOverlayTimestamp == Other.UserOverlayTimestamp;
+        }
+    };
+
+    /** 读取各层当前的版本戳（用户覆盖层只读取文件大小和修改时间） */
+    FLayerStamps CaptureStamps() const;
+
+    /** 重新读取用户覆盖文件 */
+    void LoadUserOverlay(const FLayerStamps& Stamps);
+
+    /** 共享目录中的单个配置文件 */
+    struct FSharedConfigFile
+    {
+        int64 Size = -1;
+        FDateTime Timestamp;
+        FMD5Hash Hash;
+        TArray<FToolbarButtonConfig> Configs;
+    };
+
+    /** 读取共享配置的解析缓存 */
+    void LoadSharedCache();
+
+    /** 写入共享配置的解析缓存 */
+    void StoreSharedCache() const;
+
+    /** 合并后的按钮配置 */
+    TArray<FToolbarButtonConfig> ResolvedConfigs;
+
+    /** 与ResolvedConfigs一一对应的来源层 */
+    TArray<EUtilityExtendConfigLayer> ResolvedLayers;
+
+    /** 合并结果中按钮名称到位置的映射（FString键不区分大小写） */
+    TMap<FString, int32> ResolvedNameToIndex;
+
+    /** 用户覆盖层的配置 */
+    TArray<FToolbarButtonConfig> UserOverlayConfigs;
+
+    /** 共享配置文件，按完整路径索引 */
+    TMap<FString, FSharedConfigFile> SharedConfigFiles;
+
+    /** 共享配置文件的合并顺序（目录按设置顺序，目录内按文件名） */
+    TArray<FString> SharedConfigOrder;
+
+    /** 共享配置版本号，共享文件内容每次变化后递增 */
+    uint32 SharedVersion = 0;
+
+    /** 是否已读取共享配置的解析缓存 */
+    bool bSharedCacheLoaded = false;
+
+    /** 生成ResolvedConfigs时的版本戳 */
+    FLayerStamps ResolvedStamps;
+
+    /** 用户覆盖文件最近一次读取时的版本戳 */
+    int64 LoadedUserOverlaySize = -1;
+    FDateTime LoadedUserOverlayTimestamp;
+
+    /** 合并结果版本号 */
+    uint32 ResolvedVersion = 0;
+
+    /** 缓存是否有效 */
+    bool bHasResolved = false;
+};
@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UtilityExtendSettings.h"
+
+/**
+ * 配置校验发现的问题类型
+ */
+enum class EUtilityExtendConfigIssue : uint8
+{
+    /** 按钮名称为空 */
+    EmptyButtonName,
+    /** 按钮名称与前面的按钮重复（同名按钮会互相覆盖） */
+    DuplicateButtonName,
+    /** 下拉项名称为空 */
+    EmptyItemName,
+    /** 下拉按钮没有任何下拉项 */
+    EmptyDropdown,
+    /** 按钮或下拉项没有绑定脚本类 */
+    MissingBoundClass,
+    /** 图标名称不是已注册图标的友好名称 */
+    UnknownIcon
+};
+
+/**
+ * 一条校验结果
+ * 只记录问题类型和位置，需要显示时再结合配置格式化，整个列表保持紧凑
+ */
+struct FUtilityExtendConfigDiagnostic
+{
+    /** 问题类型 */
+    EUtilityExtendConfigIssue Issue = EUtilityExtendConfigIssue::EmptyButtonName;
+
+    /** 按钮索引 */
+    int32 ButtonIndex = INDEX_NONE;
+
+    /** 下拉项索引，按钮级问题为INDEX_NONE */
+    int32 ItemIndex = INDEX_NONE;
+};
+
+/**
+ * 按钮配置的结构版本
+ * 所有读取入口在解析后统一经过Migrate升级到当前版本，新增或调整字段时只需在这里追加一个迁移步骤，
+ * 各个解析器不再各自兼容旧格式
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigSchema
+{
+public:
+    /**
+     * 当前配置结构版本
+     * 没有SchemaVersion字段的旧文件视为版本0
+     */
+    static constexpr int32 CurrentVersion = 1;
+
+    /**
+     * 把配置从指定版本依次升级到当前版本
+     * @param FromVersion 配置文件中记录的版本
+     * @param Configs 需要升级的配置
+     * @return 是否执行了迁移（调用方据此决定是否回写文件）
+     */
+    static bool Migrate(int32 FromVersion, TArray<FToolbarButtonConfig>& Configs);
+
+    /**
+     * 校验配置，只收集问题不输出日志
+     * @param Configs 需要校验的配置
+     * @param OutDiagnostics 发现的问题
+     */
+    static void Validate(const TArray<FToolbarButtonConfig>& Configs, TArray<FUtilityExtendConfigDiagnostic>& OutDiagnostics);
+
+    /** 把一条校验结果格式化为可读的描述 */
+    static FString DescribeDiagnostic(const FUtilityExtendConfigDiagnostic& Diagnostic, const TArray<FToolbarButtonConfig>& Configs);
+
+private:
+    /** 版本0 -> 1：规范化手写配置中的名称空白和图标技术名称，移除单个按钮上的下拉项 */
+    static void MigrateV0ToV1(TArray<FToolbarButtonConfig>& Configs);
+};
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 配置文本（UE结构体导出格式）的单遍读取器
+ * 格式: (Key=Value,Key="带,逗号(和括号)的值",List=((...),(...)))
+ * 只在原始文本上移动游标，键和值都以视图返回，不做中间子串拷贝；
+ * 引号内的逗号和括号不参与分隔；组内以格式标记 TextFormat=1 开头时，之后引号内的 \" 和 \\ 按转义读取，
+ * 没有标记的旧文本中反斜杠原样保留（例如 "C:\\Path" 或以反斜杠结尾的路径）
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigTextReader
+{
+public:
+    /** 读取到的值，视图指向原始文本 */
+    struct FValue
+    {
+        /** 值的原始文本（不含引号，未反转义） */
+        FStringView Text;
+
+        /** 值是否带引号 */
+        bool bQuoted = false;
+
+        /** 值中是否有需要反转义的字符 */
+        bool bHasEscapes = false;
+
+        /** 转换为字符串（处理转义） */
+        FString ToString() const;
+
+        /** 与字符串比较（不区分大小写，与FString的==一致） */
+        bool Equals(const TCHAR* Other) const;
+    };
+
+    /** 读取以\0结尾的文本，ImportTextItem的缓冲区没有长度信息 */
+    explicit FUtilityExtendConfigTextReader(const TCHAR* InText);
+
+    /** 读取指定范围的文本 */
+    explicit FUtilityExtendConfigTextReader(FStringView InText);
+
+    /** 读取一个'('，开始一组键值对或列表 */
+    bool BeginGroup();
+
+    /**
+     * 读取当前组的下一个键和'='
+     * @param OutKey 键名
+     * @return 是否读到键；遇到并读取了')'或出错时返回false
+     */
+    bool NextField(FStringView& OutKey);
+
+    /**
+     * 定位到列表的下一个元素（元素本身是一组，'('留给调用方读取）
+     * @return 是否还有元素；遇到并读取了')'或出错时返回false
+     */
+    bool NextElement();
+
+    /** 读取一个标量值；遇到'('时返回整组的原始文本 */
+    bool ReadValue(FValue& OutValue);
+
+    /** 跳过一个值（标量或整组） */
+    bool SkipValue();
+
+    /** 下一个非空白字符是否为'(' */
+    bool IsGroupNext();
+
+    /** 当前读取位置，ImportTextItem用它回写缓冲区指针 */
+    const TCHAR* GetCursor() const { return Cursor; }
+
+    /** 已读取的字符数 */
+    int32 GetOffset() const { return static_cast<int32>(Cursor - Start); }
+
+    /** 是否出错 */
+    bool HasError() const { return !Error.IsEmpty(); }
+
+    /** 错误信息（包含出错位置） */
+    const FString& GetError() const { return Error; }
+
+private:
+    /** 当前字符，到达结尾时返回0 */
+    TCHAR Peek() const { return (End && Cursor >= End) ? TCHAR(0) : *Cursor; }
+
+    /** 跳过空白 */
+    void SkipWhitespace();
+
+    /** 跳过空白和分隔用的逗号 */
+    void SkipSeparators();
+
+    /** 跳过一个括号平衡的组（'('已经是当前字符） */
+    bool SkipGroup();
+
+    /** 读取引号字符串（'"'已经是当前字符） */
+    bool ReadQuoted(FValue& OutValue);
+
+    /** 记录错误，只保留第一个错误 */
+    void SetError(const TCHAR* Message);
+
+    /** 读取格式标记的值（'='之后），决定之后的引号值是否处理转义 */
+    bool ReadFormatMarker();
+
+    const TCHAR* Start = nullptr;
+    const TCHAR* Cursor = nullptr;
+
+    /** 文本结尾，为空表示以\0结尾 */
+    const TCHAR* End = nullptr;
+
+    /** 是否处理引号内的转义，读到格式标记后开启 */
+    bool bEscapes = false;
+
+    FString Error;
+};
+
+/**
+ * 配置文本的写出辅助
+ */
+class UTILITYEXTEND_API FUtilityExtendConfigText
+{
+public:
+    /** 格式标记的键名，读取器在NextField中处理该键，不返回给调用方 */
+    static constexpr const TCHAR* FormatKey = TEXT("TextFormat");
+
+    /** 引号内的值带转义的格式版本 */
+    static constexpr int32 EscapedFormat = 1;
+
+    /** 在组的'('之后追加格式标记，之后用AppendQuoted写出的值才能被正确反转义 */
+    static void AppendFormatMarker(FString& Out);
+
+    /** 追加带引号的值，转义其中的引号和反斜杠，保证能被FUtilityExtendConfigTextReader原样读回 */
+    static void AppendQuoted(FString& Out, FStringView Value);
+
+    /** 反转义引号内的文本（只处理 \" 和 \\，其余反斜杠原样保留），只用于带格式标记的文本 */
+    static void AppendUnescaped(FString& Out, FStringView Text);
+};
@@ -6,7 +6,10 @@
 #include "Engine/DeveloperSettings.h"
 #include "Engine/Engine.h"
 #include "UtilityExtendSettings.h"
+#include "Persistent/UtilityExtendConfigSchema.h"
 #include "Interfaces/IPluginManager.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
 #include "UtilityExtendPersistentSettings.generated.h"
 
 /**
@@ -102,6 +105,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "UtilityExtend|Persistent")
     FString GetIconDisplayNameFromName(const FName& IconName) const;
 
+    /** 配置版本号，按钮配置每次变化后递增，供合并结果缓存判断是否失效 */
+    uint32 GetConfigVersion() const { return ConfigVersion; }
+
+    /** 当前配置的校验结果，每个配置版本只校验一次 */
+    const TArray<FUtilityExtendConfigDiagnostic>& GetConfigDiagnostics() const;
+
+    /** 实际执行校验的次数，用于确认校验结果被缓存 */
+    int32 GetValidationCount() const { return ValidationCount; }
+
+    /** 从旧格式的配置字符串解析按钮配置（与ImportTextItem共用配置文本读取器） */
+    static bool ParseButtonConfigFromString(const FString& ConfigString, FToolbarButtonConfig& OutConfig);
+
 protected:
     /** 持久化按钮配置数组 - 从插件配置文件中读取 */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Persistent Button Configs", 
@@ -112,8 +127,53 @@ protected:
     /** 插件配置文件路径 */
     FString PluginConfigPath;
 
-    /** 延迟保存定时器句柄 */
-    FTimerHandle DelayedSaveTimerHandle;
+    /** 延迟保存的Ticker句柄，不依赖编辑器世界的TimerManager */
+    FTSTicker::FDelegateHandle DelayedSaveTickerHandle;
+
+    /** 正在后台写入的保存任务 */
+    TFuture<bool> InFlightSave;
+
+    /** 是否有尚未写入的修改 */
+    bool bSaveRequested = false;
+
+    /** 最近一次修改的时间，停止编辑超过SaveDelayTime后才真正写入 */
+    double LastSaveRequestTime = 0.0;
+
+    /** 保存请求次数 */
+    int32 SaveRequestCount = 0;
+
+    /** 实际写入文件的次数 */
+    int32 SaveWriteCount = 0;
+
+    /** 以变更日志追加代替整文件写入的次数 */
+    int32 JournalAppendCount = 0;
+
+    /** 配置文件加变更日志对应的状态，变更日志模式下据此计算需要追加的记录 */
+    TArray<FToolbarButtonConfig> JournalBaseline;
+
+    /** JournalBaseline是否与磁盘上的内容一致 */
+    bool bHasJournalBaseline = false;
+
+    /** 正在写入的保存成功后对应的已保存状态，写入成功后才成为JournalBaseline */
+    TArray<FToolbarButtonConfig> InFlightBaseline;
+
+    /** InFlightBaseline是否保存了正在写入的快照 */
+    bool bInFlightHasBaseline = false;
+
+    /** 配置版本号 */
+    uint32 ConfigVersion = 0;
+
+    /** 配置文件的结构版本比插件支持的更新，为避免丢失字段禁止回写 */
+    bool bConfigFromNewerSchema = false;
+
+    /** 缓存的校验结果 */
+    mutable TArray<FUtilityExtendConfigDiagnostic> ConfigDiagnostics;
+
+    /** 校验结果对应的配置版本 */
+    mutable uint32 ValidatedConfigVersion = MAX_uint32;
+
+    /** 实际执行校验的次数 */
+    mutable int32 ValidationCount = 0;
 
     /** 保存延迟时间（秒） */
     static constexpr float SaveDelayTime = 0.5f;
@@ -127,27 +187,42 @@ public:
 private:
 
 
-    /** 解析JSON配置文件 */
-    bool ParseJsonConfigFile();
+    /**
+     * 解析JSON配置文件，旧版本的配置在这里迁移到当前结构版本
+     * @param bOutMigrated 是否执行了迁移，调用方需要回写文件
+     */
+    bool ParseJsonConfigFile(bool& bOutMigrated);
+
+    /** 在配置文件之上回放变更日志，并记录回放后的已保存状态 */
+    void ReplayJournal();
+
+    /** 本次保存是否只追加变更日志（未启用日志模式或日志超过压缩阈值时整文件写入） */
+    bool ShouldAppendToJournal() const;
+
+    /** 整文件写入成功后，变更日志已经合并进配置文件 */
+    void OnFullSaveSubmitted(const TArray<FToolbarButtonConfig>& SavedConfigs);
+
+    /** 是否启用了变更日志模式，需要保留已保存状态的副本 */
+    bool ShouldKeepJournalBaseline() const;
+
+    /** 等待后台保存结束并处理结果：成功时更新已保存状态，失败时保留修改等待下一次保存 */
+    void CompleteInFlightSave();
 
     /** 获取插件根目录路径 */
     FString GetPluginDirectory() const;
     
-    /** 从配置字符串解析按钮配置 */
-    bool ParseButtonConfigFromString(const FString& ConfigString, FToolbarButtonConfig& OutConfig);
-    
-    /** 从字符串解析下拉项配置 */
-    bool ParseDropdownItemsFromString(const FString& DropdownString, TArray<FToolbarDropdownItem>& OutItems);
-    
-    /** 解析单个下拉项 */
-    bool ParseSingleDropdownItem(const FString& ItemString, FToolbarDropdownItem& OutItem);
-    
-    /** 解析顶层参数（处理嵌套括号） */
-    void ParseTopLevelParameters(const FString& ParameterString, TArray<FString>& OutParameters);
-    
-    /** 延迟保存配置（避免频繁保存导致的数据丢失） */
+    /** 延迟保存配置：连续的修改合并为一次写入 */
     void ScheduleDelayedSave();
-    
-    /** 验证配置数据的完整性 */
-    bool ValidateConfigData() const;
+
+    /** 延迟保存Ticker回调 */
+    bool TickDelayedSave(float DeltaTime);
+
+    /** 在后台线程序列化并写入当前配置的快照 */
+    void StartAsyncSave();
+
+    /** 等待后台保存完成，并立即写入尚未保存的修改 */
+    void FlushPendingSave();
+
+    /** 更新保存统计 */
+    void UpdateSaveStats() const;
 };
@@ -44,6 +44,13 @@ public:
     /** 获取下拉按钮图标名称 */
     static FName GetDropdownButtonIconName();
 
+    /**
+     * 运行时注册一批图标（批量导入后一次性调用）
+     * @param NewIconInfos 新图标信息，已存在的图标名称会被忽略
+     * @return 实际新增的图标数量
+     */
+    static int32 RegisterIcons(const TArray<FToolbarIconInfo>& NewIconInfos);
+
 
 
 private:
@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
 #include "Blueprint/ButtonScript/UtilityExtendTopBarButtonScript.h"
+#include "Notification/UtilityExtendNotificationTypes.h"
 #include "UtilityExtendSettings.generated.h"
 
+class FUtilityExtendConfigTextReader;
+
 /**
  * 工具栏图标信息结构体
  */
@@ -82,6 +86,9 @@ struct FToolbarDropdownItem
     /** 配置导出支持 - 确保在项目设置中正确显示和保存 */
     bool ExportTextItem(FString& ValueStr, FToolbarDropdownItem const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
     bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
+    /** 从共享的配置文本读取器读取一个下拉项，读取器停在该项的')'之后 */
+    bool ImportFromReader(FUtilityExtendConfigTextReader& Reader);
 };
 
 // 告诉UE这个结构体有自定义序列化
@@ -149,9 +156,8 @@ struct FToolbarButtonConfig
     bool ExportTextItem(FString& ValueStr, FToolbarButtonConfig const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
     bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
 
-private:
-    /** 从字符串解析下拉项数组 */
-    void ParseDropdownItemsFromString(const FString& DropdownString);
+    /** 从共享的配置文本读取器读取一个按钮配置（包括嵌套的下拉项），读取器停在该配置的')'之后 */
+    bool ImportFromReader(FUtilityExtendConfigTextReader& Reader);
 };
 
 // 告诉UE FToolbarButtonConfig也有自定义序列化
@@ -186,6 +192,58 @@ public:
                       ToolTip = "配置要在顶部工具栏中显示的按钮"))
     TArray<FToolbarButtonConfig> ToolbarButtonConfigs;
 
+    /** 持久化配置的修改以变更日志追加保存，插件位于同步的网络目录时减少整文件重写 */
+    UPROPERTY(config, EditAnywhere, Category = "Persistent Config",
+               meta = (DisplayName = "启用变更日志",
+                      ToolTip = "修改持久化配置时只向配置文件旁的.journal文件追加记录，关闭编辑器或日志超过阈值时再压缩回配置文件"))
+    bool bUsePersistentConfigJournal = false;
+
+    /** 变更日志超过该大小后压缩回配置文件 */
+    UPROPERTY(config, EditAnywhere, Category = "Persistent Config",
+               meta = (DisplayName = "变更日志压缩阈值(KB)", ClampMin = "1", EditCondition = "bUsePersistentConfigJournal"))
+    int32 PersistentConfigJournalCompactKB = 256;
+
+    /** 团队共享配置目录，目录中的每个JSON配置文件合并在插件持久化配置之后、项目配置之前 */
+    UPROPERTY(config, EditAnywhere, Category = "Shared Config",
+               meta = (DisplayName = "共享配置目录",
+                      ToolTip = "本机或团队同步目录，文件格式与DefaultUtilityExtendPersistent.json相同；同一目录中按文件名顺序合并，相对路径相对于项目目录"))
+    TArray<FDirectoryPath> SharedConfigDirectories;
+
+    /** 相同合并键（未指定时为相同内容）的通知在该时间窗口内合并为一条，并显示重复次数 */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "通知合并窗口(秒)", ClampMin = "0",
+                      ToolTip = "脚本循环中重复发出的通知只更新已有通知的重复次数，不再新建通知；0表示不合并"))
+    float NotificationCoalesceWindow = 2.0f;
+
+    /** 每秒最多新建的通知数量，超出的通知汇总为一条提示 */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "每秒通知上限", ClampMin = "0",
+                      ToolTip = "超出上限的通知不单独显示，数量和最后一条内容汇总到一条提示中；0表示不限制"))
+    int32 MaxNotificationsPerSecond = 5;
+
+    /** 通知历史保留的最近通知数量，占用内存固定，超出后覆盖最旧的记录 */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "通知历史容量", ClampMin = "0", ClampMax = "65536",
+                      ToolTip = "通知淡出后仍可在通知历史面板或通过蓝图查询；0表示不记录"))
+    int32 NotificationHistoryCapacity = 256;
+
+    /** 没有Slate时（命令行工具、-nullrhi自动化）通知和进度的输出方式 */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "无界面通知输出",
+                      ToolTip = "新建通知同样受每秒通知上限限制，超出的通知汇总为一条记录"))
+    EUtilityHeadlessNotificationOutput HeadlessNotificationOutput = EUtilityHeadlessNotificationOutput::Log;
+
+    /** JSON Lines输出文件，为空时写入项目日志目录下的UtilityExtendNotifications.jsonl */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "无界面通知文件", FilePathFilter = "jsonl",
+                      EditCondition = "HeadlessNotificationOutput == EUtilityHeadlessNotificationOutput::JsonLines"))
+    FFilePath HeadlessNotificationFile;
+
+    /** 无界面时同一通知两次输出进度的最小间隔，进度到达100%时总会输出 */
+    UPROPERTY(config, EditAnywhere, Category = "Notification",
+               meta = (DisplayName = "无界面进度输出间隔(秒)", ClampMin = "0"))
+    float HeadlessProgressInterval = 1.0f;
+
     /** 获取设置实例 */
     static UUtilityExtendSettings* Get();
 
@@ -194,8 +252,14 @@ public:
 
     /** 获取设置显示名称 */
     virtual FText GetDisplayName() const;
-    
 
+    /** 配置版本号，按钮配置每次变化后递增，供合并结果缓存判断是否失效 */
+    uint32 GetConfigVersion() const { return ConfigVersion; }
 
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
 
+private:
+    /** 配置版本号 */
+    uint32 ConfigVersion = 0;
 };
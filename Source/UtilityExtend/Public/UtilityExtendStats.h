@@ -0,0 +1,9 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/** UtilityExtend插件的统计分组，各模块的统计项都挂在这个分组下，编辑器中使用 stat UtilityExtend 查看 */
+DECLARE_STATS_GROUP(TEXT("UtilityExtend"), STATGROUP_UtilityExtend, STATCAT_Advanced);
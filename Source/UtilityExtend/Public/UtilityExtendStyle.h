@@ -4,6 +4,11 @@
 
 #include "Styling/SlateStyle.h"
 
+struct FFileChangeData;
+
+/** 单个图标画刷热重载完成时广播，参数为图标的样式名称 */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnUtilityExtendIconReloaded, FName /*IconStyleName*/);
+
 /**
  * UtilityExtend插件的样式管理类
  * 负责注册和管理插件的SVG图标资源
@@ -17,9 +22,27 @@ public:
     /** 关闭样式系统 */
     static void Shutdown();
 
-    /** 重新加载纹理资源 */
+    /** 重新加载纹理资源（仅重载本插件的图标画刷，不再触发全局纹理重载） */
     static void ReloadTextures();
 
+    /**
+     * 重新加载单个图标文件对应的画刷
+     * @param IconFilePath Resources目录下的图标文件路径
+     * @return 是否有画刷被重新加载
+     */
+    static bool ReloadIcon(const FString& IconFilePath);
+
+    /**
+     * 为一批新导入的图标文件创建画刷
+     * @param IconFiles 图标样式名称与Resources目录下图标文件路径的对应关系
+     * @param ImageSize 画刷尺寸
+     * @return 实际新增的画刷数量
+     */
+    static int32 RegisterIconBrushes(const TArray<TPair<FName, FString>>& IconFiles, const FVector2D& ImageSize);
+
+    /** 图标热重载事件，使用该图标的控件可以在此处自行失效重绘 */
+    static FOnUtilityExtendIconReloaded& OnIconReloaded();
+
     /** 获取样式集实例 */
     static const ISlateStyle& Get();
 
@@ -38,7 +61,37 @@ private:
     /** 创建样式集 */
     static TSharedRef< class FSlateStyleSet > Create();
 
+    /** 建立图标文件到样式名称的映射 */
+    static void BuildIconFileMap();
+
+    /** 注册Resources目录监听 */
+    static void RegisterResourcesWatcher();
+
+    /** 注销Resources目录监听 */
+    static void UnregisterResourcesWatcher();
+
+    /** Resources目录文件变化回调 */
+    static void OnResourcesDirectoryChanged(const TArray<FFileChangeData>& FileChanges);
+
+    /** 规范化图标文件路径，作为映射表的键 */
+    static FString MakeIconFileKey(const FString& FilePath);
+
 private:
     /** 样式集实例 */
     static TSharedPtr< class FSlateStyleSet > StyleInstance;
+
+    /** 图标文件路径 -> 使用该文件的样式名称 */
+    static TMap<FString, TArray<FName>> IconFileToStyleNames;
+
+    /** 每个图标文件的重载次数，用于生成不重复的缓存文件名 */
+    static TMap<FString, int32> IconFileRevisions;
+
+    /** Resources目录监听句柄 */
+    static FDelegateHandle ResourcesWatcherHandle;
+
+    /** 被监听的Resources目录 */
+    static FString WatchedResourcesDir;
+
+    /** 图标热重载事件 */
+    static FOnUtilityExtendIconReloaded IconReloadedEvent;
 };
@@ -44,10 +44,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Toolbar Manager")
     UUtilityExtendTopBarButtonScript* CreateButtonInstanceFromSoftClass(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& SoftClass) const;
 
+    /**
+     * 把一组按钮配置注册到工具栏分段
+     * @param bFromResolver 配置是否为解析器的合并结果；是则下拉按钮只捕获名称，否则每个下拉按钮保留一份配置副本
+     * @return 跳过的空名称配置数量
+     */
+    int32 AddButtonsToSection(const TArray<FToolbarButtonConfig>& ButtonConfigs, FToolMenuSection& Section, bool bFromResolver);
+
     /** 刷新工具栏 */
     void RefreshToolbar();
 
-    /** 获取合并的按钮配置（项目配置 + 持久化配置） */
+    /** 获取合并的按钮配置（持久化配置 < 项目配置 < 用户覆盖，同名按钮由高层覆盖） */
     UFUNCTION(BlueprintCallable, Category = "Toolbar Manager")
     TArray<FToolbarButtonConfig> GetMergedButtonConfigs() const;
 
@@ -64,14 +71,17 @@ private:
     void CreateToolbarButtons();
 
     /** 处理按钮点击事件 */
-    void OnButtonClicked(const FToolbarButtonConfig& ButtonConfig) const;
+    void OnButtonClicked(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& BoundClass, const FString& ButtonName) const;
 
-    /** 检查按钮是否可以执行 */
-    bool CanExecuteButton(const FToolbarButtonConfig& ButtonConfig) const;
+    /** 检查按钮是否可以执行（每帧都会调用，不能加载类或创建实例） */
+    bool CanExecuteButton(const TSoftClassPtr<UUtilityExtendTopBarButtonScript>& BoundClass) const;
 
     /** 处理下拉项点击事件 */
     void OnDropdownItemClicked(UUtilityExtendTopBarButtonScript* ButtonScript) const;
     
+    /** 创建下拉按钮，bResolved表示配置在解析器的合并结果中，菜单打开时按名称取最新配置 */
+    void AddDropdownButton(const FToolbarButtonConfig& ButtonConfig, FToolMenuSection& Section, bool bResolved);
+
     // 创建下拉菜单
     void CreateDropdownMenu(UToolMenu* Menu, const FToolbarButtonConfig& ButtonConfig) const;
 
@@ -80,4 +90,16 @@ private:
 
     /** 获取按钮工具提示 */
     FString GetButtonTooltip(const FToolbarButtonConfig& ButtonConfig);
+
+    /** 图标热重载回调，仅刷新使用了该图标的工具栏 */
+    void HandleIconReloaded(FName IconStyleName);
+
+    /** 已扩展的工具栏菜单名称 */
+    FName ExtendedToolbarMenuName;
+
+    /** 工具栏按钮正在使用的图标样式名称 */
+    TSet<FName> UsedIconStyleNames;
+
+    /** 图标友好名称到技术名称的映射，创建工具栏时构建一次，避免每个按钮线性查找图标注册表 */
+    TMap<FName, FName> IconNameLookup;
 };
@@ -32,6 +32,7 @@ public class UtilityExtend : ModuleRules
 				"Blutility",
 				"Projects",
 				"Json",
+				"UMG",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -56,6 +57,8 @@ public class UtilityExtend : ModuleRules
 				"EditorSubsystem",
 				"UMGEditor",
 				"ToolWidgets",
+				"DirectoryWatcher",
+				"ImageWrapper",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);